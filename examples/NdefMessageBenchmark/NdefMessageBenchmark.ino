@@ -0,0 +1,115 @@
+/**
+  ******************************************************************************
+  * @file           : NdefMessageBenchmark.ino
+  * @brief          : Measure the NDEF message build, information and encode timings
+  *                   for messages made of a large number of records
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "ndef_message.h"
+#include "ndef_record.h"
+
+#define BENCHMARK_RECORD_MAX   200U  /* Largest message, in records      */
+#define BENCHMARK_PAYLOAD_LEN  8U    /* Payload length of each record    */
+#define BENCHMARK_RECORD_LEN   (3U + 1U + BENCHMARK_PAYLOAD_LEN) /* Short record header + type "T" + payload */
+
+static const uint8_t benchmarkType[]    = { 'T' };
+static const uint8_t benchmarkPayload[] = { 0x02, 'e', 'n', 'N', 'D', 'E', 'F', '!' };
+
+static ndefRecord benchmarkRecords[BENCHMARK_RECORD_MAX];
+static uint8_t    benchmarkBuffer[BENCHMARK_RECORD_MAX * BENCHMARK_RECORD_LEN];
+
+static const uint32_t benchmarkCounts[] = { 100U, 150U, BENCHMARK_RECORD_MAX };
+
+void benchmarkRun(uint32_t recordCount)
+{
+  ndefConstBuffer8 bufType    = { benchmarkType, sizeof(benchmarkType) };
+  ndefConstBuffer8 bufId      = { NULL, 0 };
+  ndefConstBuffer  bufPayload = { benchmarkPayload, sizeof(benchmarkPayload) };
+  ndefBuffer       bufEncode  = { benchmarkBuffer, sizeof(benchmarkBuffer) };
+  ndefMessage      message;
+  ndefMessageInfo  info;
+  uint32_t         start;
+  uint32_t         tAppend;
+  uint32_t         tInfoFirst;
+  uint32_t         tInfoCached;
+  uint32_t         tInfoChanged;
+  uint32_t         tEncode;
+  uint32_t         i;
+
+  (void)ndefMessageInit(&message);
+
+  for (i = 0; i < recordCount; i++) {
+    (void)ndefRecordInit(&benchmarkRecords[i], NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufType, &bufId, &bufPayload);
+  }
+
+  /* Append: the message length is maintained on each append */
+  start = micros();
+  for (i = 0; i < recordCount; i++) {
+    (void)ndefMessageAppend(&message, &benchmarkRecords[i]);
+  }
+  tAppend = micros() - start;
+
+  start = micros();
+  (void)ndefMessageGetInfo(&message, &info);
+  tInfoFirst = micros() - start;
+
+  /* Nothing changed: the cached information is returned */
+  start = micros();
+  (void)ndefMessageGetInfo(&message, &info);
+  tInfoCached = micros() - start;
+
+  /* A record change requires the length to be computed again, once */
+  (void)ndefRecordSetPayload(&benchmarkRecords[recordCount / 2U], &bufPayload);
+  start = micros();
+  (void)ndefMessageGetInfo(&message, &info);
+  tInfoChanged = micros() - start;
+
+  start = micros();
+  if (ndefMessageEncode(&message, &bufEncode) != ERR_NONE) {
+    Serial.println("Encode failed");
+  }
+  tEncode = micros() - start;
+
+  Serial.print(recordCount);
+  Serial.print(" records, ");
+  Serial.print(info.length);
+  Serial.print(" bytes: append ");
+  Serial.print(tAppend);
+  Serial.print(" us, get info ");
+  Serial.print(tInfoFirst);
+  Serial.print(" us, cached ");
+  Serial.print(tInfoCached);
+  Serial.print(" us, after change ");
+  Serial.print(tInfoChanged);
+  Serial.print(" us, encode ");
+  Serial.print(tEncode);
+  Serial.println(" us");
+}
+
+void setup()
+{
+  uint32_t i;
+
+  Serial.begin(115200);
+
+  Serial.println("NDEF message benchmark");
+
+  for (i = 0; i < (sizeof(benchmarkCounts) / sizeof(benchmarkCounts[0])); i++) {
+    benchmarkRun(benchmarkCounts[i]);
+  }
+}
+
+void loop()
+{
+}
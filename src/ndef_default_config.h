@@ -54,10 +54,13 @@
 #define NDEF_FEATURE_T3T          RFAL_FEATURE_NFCF       /*!< T3T Support control */
 #define NDEF_FEATURE_T4T          RFAL_FEATURE_T4T        /*!< T4T Support control */
 #define NDEF_FEATURE_T5T          RFAL_FEATURE_NFCV       /*!< T5T Support control */
+#define NDEF_FEATURE_LLCP         RFAL_FEATURE_NFC_DEP    /*!< LLCP and SNEP Support control */
 
 
 #define NDEF_FEATURE_FULL_API                  true       /*!< Support Write, Format, Check Presence, set Read-only in addition to the Read feature */
 
+#define NDEF_MAX_RECORD                        10U        /*!< Maximum number of records of a decoded message */
+
 #define NDEF_TYPE_EMPTY_SUPPORT                true       /*!< Support Empty type                          */
 #define NDEF_TYPE_FLAT_SUPPORT                 true       /*!< Support Flat type                           */
 #define NDEF_TYPE_RTD_DEVICE_INFO_SUPPORT      true       /*!< Support RTD Device Information type         */
@@ -67,11 +70,37 @@
 #define NDEF_TYPE_RTD_WLC_SUPPORT              true       /*!< Support RTD WLC Types                       */
 #define NDEF_TYPE_RTD_WPCWLC_SUPPORT           true       /*!< Support RTD WPC WLC type                    */
 #define NDEF_TYPE_RTD_TNEP_SUPPORT             true       /*!< Support RTD TNEP Types                      */
+#define NDEF_TYPE_RTD_HANDOVER_SUPPORT         true       /*!< Support RTD Connection Handover types       */
 #define NDEF_TYPE_MEDIA_SUPPORT                true       /*!< Support Media type                          */
 #define NDEF_TYPE_BLUETOOTH_SUPPORT            true       /*!< Support Bluetooth types                     */
 #define NDEF_TYPE_VCARD_SUPPORT                true       /*!< Support vCard type                          */
 #define NDEF_TYPE_WIFI_SUPPORT                 true       /*!< Support Wifi type                           */
 
+/*
+ * Optional record type registry: when defined, ndefRecordToType() only recognizes the listed
+ * types (other records fall back to the flat type), ndefTypeToRecord() only converts the listed
+ * types (and the flat type), ndefTypeGetTypeString() only knows the listed type strings, and the
+ * converters not listed are not linked.
+ * Each entry gives the type Id, the TNF, the type string buffer and the converter, e.g.:
+ *
+ * #define NDEF_TYPE_REGISTRY(ENTRY) \
+ *   ENTRY(NDEF_TYPE_ID_RTD_URI,  NDEF_TNF_RTD_WELL_KNOWN_TYPE, bufRtdTypeUri,  ndefRecordToRtdUri)  \
+ *   ENTRY(NDEF_TYPE_ID_RTD_TEXT, NDEF_TNF_RTD_WELL_KNOWN_TYPE, bufRtdTypeText, ndefRecordToRtdText)
+ */
+
+#define NDEF_HANDOVER_CARRIER_MAX              4U         /*!< Maximum number of alternative carriers of a handover */
+#define NDEF_TNEP_SERVICE_MAX                  4U         /*!< Maximum number of TNEP services kept by the reader   */
+#define NDEF_WLC_STATIC_WPT_DURATION           20U        /*!< WPT_DURATION used by the WLC poller in static mode   */
+#define NDEF_WLC_SCHEDULE_TOLERANCE            1000U      /*!< WLC slot start deviation (us) counted as late         */
+#define NDEF_PROVISION_FIELD_MAX               4U         /*!< Maximum number of variable fields of a provisioning template */
+#define NDEF_POLLER_CHUNK_LEN                  64U        /*!< Bytes transferred per step of the non-blocking NDEF read/write */
+#define NDEF_LLCP_CONN_MAX                     2U         /*!< Maximum number of LLCP data link connections          */
+#define NDEF_LLCP_SERVICE_MAX                  2U         /*!< Maximum number of registered LLCP services            */
+#define NDEF_LLCP_MIU                          248U       /*!< Local LLCP MIU                                        */
+#define NDEF_LLCP_RW                           4U         /*!< Local LLCP receive window                             */
+#define NDEF_LLCP_LTO                          100U       /*!< Local LLCP link timeout (ms)                          */
+#define NDEF_LLCP_SYMM_DELAY                   20U        /*!< Delay (ms) before the LLCP Initiator answers a SYMM   */
+
 
 
 #endif /* NDEF_DEFAULT_CONFIG_H */
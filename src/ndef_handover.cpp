@@ -0,0 +1,438 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_handover.cpp
+  * @brief          : NDEF Connection Handover engine
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_handover.h"
+#include "nfc_utils.h"
+
+
+#if NDEF_TYPE_RTD_HANDOVER_SUPPORT
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define NDEF_HANDOVER_ALL_CARRIERS  0xFFFFFFFFU    /*!< Carrier mask selecting every local carrier */
+
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+#if NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API
+static const uint8_t ndefHandoverServiceName[] = "urn:nfc:sn:handover";  /*!< Connection Handover service name */
+#endif
+
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverInit(ndefHandover *ho)
+{
+  if (ho == NULL) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMSET(ho, 0, sizeof(ndefHandover));
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverAddCarrier(ndefHandover *ho, const ndefType *carrier, const ndefConstBuffer8 *bufId, uint8_t cps)
+{
+  if ((ho == NULL) || (carrier == NULL) || (bufId == NULL) || (bufId->buffer == NULL) || (bufId->length == 0U)) {
+    return ERR_PARAM;
+  }
+
+  if (ho->carrierCount >= NDEF_HANDOVER_CARRIER_MAX) {
+    return ERR_NOMEM;
+  }
+
+  ho->carrier[ho->carrierCount]      = carrier;
+  ho->bufId[ho->carrierCount].buffer = bufId->buffer;
+  ho->bufId[ho->carrierCount].length = bufId->length;
+  ho->cps[ho->carrierCount]          = cps;
+  ho->carrierCount++;
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Build a Handover Select or Request message
+ *
+ * Build the local message (optional cr record then one ac record per
+ * selected carrier), the Hs/Hr record embedding it, and the output message
+ * made of the Hs/Hr record followed by the selected carrier records.
+ *
+ * \param[in,out] ho:           Handover context
+ * \param[in]     id:           NDEF_TYPE_ID_RTD_HANDOVER_SELECT or _REQUEST
+ * \param[in]     randomNumber: Collision Resolution random number (request only)
+ * \param[in]     carrierMask:  Bit mask of the local carriers to advertise
+ * \param[out]    message:      Message to build
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+static ReturnCode ndefHandoverBuild(ndefHandover *ho, ndefTypeId id, uint16_t randomNumber, uint32_t carrierMask, ndefMessage *message)
+{
+  ReturnCode err;
+  uint32_t   i;
+
+  if ((ho == NULL) || (message == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ndefMessageInit(&ho->localMessage);
+
+  if (id == NDEF_TYPE_ID_RTD_HANDOVER_REQUEST) {
+    (void)ndefRtdCollisionResolutionInit(&ho->crType, randomNumber);
+    (void)ndefTypeToRecord(&ho->crType, &ho->crRecord);
+    (void)ndefMessageAppend(&ho->localMessage, &ho->crRecord);
+  }
+
+  for (i = 0; i < ho->carrierCount; i++) {
+    if ((carrierMask & (1UL << i)) != 0U) {
+      err = ndefRtdAlternativeCarrierInit(&ho->acType[i], ho->cps[i], &ho->bufId[i], 0, NULL);
+      if (err != ERR_NONE) {
+        return err;
+      }
+      (void)ndefTypeToRecord(&ho->acType[i], &ho->acRecord[i]);
+      (void)ndefMessageAppend(&ho->localMessage, &ho->acRecord[i]);
+    }
+  }
+
+  if (id == NDEF_TYPE_ID_RTD_HANDOVER_REQUEST) {
+    (void)ndefRtdHandoverRequestInit(&ho->hoType, NDEF_HANDOVER_VERSION_1_5, &ho->localMessage);
+  } else {
+    (void)ndefRtdHandoverSelectInit(&ho->hoType, NDEF_HANDOVER_VERSION_1_5, &ho->localMessage);
+  }
+  (void)ndefTypeToRecord(&ho->hoType, &ho->hoRecord);
+
+  (void)ndefMessageInit(message);
+  (void)ndefMessageAppend(message, &ho->hoRecord);
+
+  for (i = 0; i < ho->carrierCount; i++) {
+    if ((carrierMask & (1UL << i)) != 0U) {
+      err = ndefTypeToRecord(ho->carrier[i], &ho->carrierRecord[i]);
+      if (err != ERR_NONE) {
+        return err;
+      }
+      (void)ndefRecordSetId(&ho->carrierRecord[i], &ho->bufId[i]);
+      (void)ndefMessageAppend(message, &ho->carrierRecord[i]);
+    }
+  }
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverBuildSelect(ndefHandover *ho, ndefMessage *message)
+{
+  return ndefHandoverBuild(ho, NDEF_TYPE_ID_RTD_HANDOVER_SELECT, 0, NDEF_HANDOVER_ALL_CARRIERS, message);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverBuildRequest(ndefHandover *ho, uint16_t randomNumber, ndefMessage *message)
+{
+  return ndefHandoverBuild(ho, NDEF_TYPE_ID_RTD_HANDOVER_REQUEST, randomNumber, NDEF_HANDOVER_ALL_CARRIERS, message);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Find the Handover Select or Request record of a message
+ *
+ * \param[in]  message: Message to look into
+ * \param[out] hoType:  Handover Select or Request type
+ *
+ * \return ERR_PROTO if the message has no handover record
+ * \return ERR_NONE if successful
+ *****************************************************************************
+ */
+static ReturnCode ndefHandoverFind(const ndefMessage *message, ndefType *hoType)
+{
+  const ndefRecord *record;
+
+  record = ndefMessageGetFirstRecord(message);
+  while (record != NULL) {
+    if (ndefRecordToRtdHandoverSelect(record, hoType) == ERR_NONE) {
+      return ERR_NONE;
+    }
+    if (ndefRecordToRtdHandoverRequest(record, hoType) == ERR_NONE) {
+      return ERR_NONE;
+    }
+    record = ndefMessageGetNextRecord(record);
+  }
+
+  return ERR_PROTO;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverGetCarrier(const ndefMessage *message, uint32_t index, uint8_t *cps, const ndefRecord **carrierRecord)
+{
+  ReturnCode        err;
+  ndefType          hoType;
+  ndefType          acType;
+  ndefConstBuffer8  bufCarrierDataRef;
+  const ndefRecord *record;
+
+  if ((message == NULL) || (cps == NULL) || (carrierRecord == NULL)) {
+    return ERR_PARAM;
+  }
+
+  err = ndefHandoverFind(message, &hoType);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  err = ndefGetRtdHandoverAlternativeCarrier(&hoType, index, &acType);
+  if (err != ERR_NONE) {
+    return err;
+  }
+  (void)ndefGetRtdAlternativeCarrier(&acType, cps, &bufCarrierDataRef);
+
+  /* Resolve the carrier data reference against the record Ids */
+  record = ndefMessageGetFirstRecord(message);
+  while (record != NULL) {
+    if ((record->idLength == bufCarrierDataRef.length) &&
+        (ST_BYTECMP(record->id, bufCarrierDataRef.buffer, bufCarrierDataRef.length) == 0)) {
+      *carrierRecord = record;
+      return ERR_NONE;
+    }
+    record = ndefMessageGetNextRecord(record);
+  }
+
+  return ERR_NOTFOUND;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverGetRandomNumber(const ndefMessage *message, uint16_t *randomNumber)
+{
+  ReturnCode err;
+  ndefType   hoType;
+  ndefType   crType;
+
+  if ((message == NULL) || (randomNumber == NULL)) {
+    return ERR_PARAM;
+  }
+
+  err = ndefHandoverFind(message, &hoType);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  err = ndefGetRtdHandoverCollisionResolution(&hoType, &crType);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  return ndefGetRtdCollisionResolution(&crType, randomNumber);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverProcessRequest(ndefHandover *ho, const ndefMessage *request, ndefMessage *select)
+{
+  ReturnCode        err;
+  ndefType          hoType;
+  ndefType          acType;
+  const ndefRecord *requested;
+  ndefConstBuffer8  bufType;
+  ndefRecord        localRecord;
+  uint32_t          carrierMask;
+  uint32_t          index;
+  uint32_t          i;
+  uint8_t           cps;
+
+  if ((ho == NULL) || (request == NULL) || (select == NULL)) {
+    return ERR_PARAM;
+  }
+
+  err = ndefHandoverFind(request, &hoType);
+  if ((err != ERR_NONE) || (hoType.id != NDEF_TYPE_ID_RTD_HANDOVER_REQUEST)) {
+    return ERR_PROTO;
+  }
+
+  /* Keep the local carriers of the same kind as a requested one */
+  carrierMask = 0;
+  for (index = 0; ndefGetRtdHandoverAlternativeCarrier(&hoType, index, &acType) == ERR_NONE; index++) {
+    if (ndefHandoverGetCarrier(request, index, &cps, &requested) != ERR_NONE) {
+      /* Dangling carrier data reference */
+      continue;
+    }
+    bufType.buffer = requested->type;
+    bufType.length = requested->typeLength;
+    for (i = 0; i < ho->carrierCount; i++) {
+      if ((ndefTypeToRecord(ho->carrier[i], &localRecord) == ERR_NONE) &&
+          ndefRecordTypeMatch(&localRecord, ndefHeaderTNF(requested), &bufType)) {
+        carrierMask |= (1UL << i);
+      }
+    }
+  }
+
+  return ndefHandoverBuild(ho, NDEF_TYPE_ID_RTD_HANDOVER_SELECT, 0, carrierMask, select);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverResolveCollision(uint16_t localRandom, uint16_t remoteRandom, bool *isSelector)
+{
+  if (isSelector == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (localRandom == remoteRandom) {
+    return ERR_AGAIN;
+  }
+
+  if (((localRandom ^ remoteRandom) & 0x0001U) == 0U) {
+    *isSelector = (localRandom > remoteRandom);
+  } else {
+    *isSelector = (localRandom < remoteRandom);
+  }
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefHandoverReadStatic(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, ndefMessage *message)
+{
+  ReturnCode      err;
+  uint32_t        rcvdLen;
+  ndefConstBuffer bufMessage;
+  ndefType        hoType;
+
+  if ((ctx == NULL) || (buf == NULL) || (message == NULL)) {
+    return ERR_PARAM;
+  }
+
+  err = ndefPollerReadRawMessage(ctx, buf, bufLen, &rcvdLen, true);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  bufMessage.buffer = buf;
+  bufMessage.length = rcvdLen;
+  err = ndefMessageDecode(&bufMessage, message);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  /* A static handover tag holds a Handover Select record first */
+  if (ndefRecordToRtdHandoverSelect(ndefMessageGetFirstRecord(message), &hoType) != ERR_NONE) {
+    return ERR_PROTO;
+  }
+
+  return ERR_NONE;
+}
+
+
+#if NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API
+
+/*****************************************************************************/
+ReturnCode ndefHandoverNegotiateTnep(ndefHandover *ho, ndefTnep *tnep, uint16_t randomNumber,
+                                     uint8_t *txBuf, uint32_t txBufLen, uint8_t *rxBuf, uint32_t rxBufLen, ndefMessage *select)
+{
+  ReturnCode      err;
+  ndefMessage     request;
+  ndefBuffer      bufRequest;
+  ndefConstBuffer bufServiceUri;
+  ndefConstBuffer bufSelect;
+  ndefType        hoType;
+  uint32_t        rcvdLen;
+  uint8_t         index;
+
+  if ((ho == NULL) || (tnep == NULL) || (txBuf == NULL) || (rxBuf == NULL) || (select == NULL)) {
+    return ERR_PARAM;
+  }
+
+  bufServiceUri.buffer = ndefHandoverServiceName;
+  bufServiceUri.length = sizeof(ndefHandoverServiceName) - 1U;
+  err = ndefTnepFindService(tnep, &bufServiceUri, &index);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  err = ndefHandoverBuildRequest(ho, randomNumber, &request);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  bufRequest.buffer = txBuf;
+  bufRequest.length = txBufLen;
+  err = ndefMessageEncode(&request, &bufRequest);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  err = ndefTnepSelect(tnep, index, rxBuf, rxBufLen);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  err = ndefTnepExchange(tnep, txBuf, bufRequest.length, rxBuf, rxBufLen, &rcvdLen);
+  if (err == ERR_NONE) {
+    bufSelect.buffer = rxBuf;
+    bufSelect.length = rcvdLen;
+    err = ndefMessageDecode(&bufSelect, select);
+  }
+
+  /* The handover selector answers with a Handover Select record first */
+  if ((err == ERR_NONE) && (ndefRecordToRtdHandoverSelect(ndefMessageGetFirstRecord(select), &hoType) != ERR_NONE)) {
+    err = ERR_PROTO;
+  }
+
+  /* Return the tag device to its initial NDEF message, the answer is kept in rxBuf */
+  (void)ndefTnepDeselect(tnep);
+
+  return err;
+}
+
+#endif /* NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API */
+
+#endif /* NDEF_TYPE_RTD_HANDOVER_SUPPORT */
@@ -0,0 +1,272 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_handover.h
+  * @brief          : NDEF Connection Handover engine header file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NDEF_HANDOVER_H
+#define NDEF_HANDOVER_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_poller.h"
+#include "ndef_message.h"
+#include "ndef_types.h"
+#include "ndef_tnep.h"
+
+
+#if NDEF_TYPE_RTD_HANDOVER_SUPPORT
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef NDEF_HANDOVER_CARRIER_MAX
+  #define NDEF_HANDOVER_CARRIER_MAX  4U   /*!< Maximum number of alternative carriers of a handover */
+#endif
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*! Connection Handover context: local carriers and the storage of the messages built from them */
+typedef struct {
+  const ndefType  *carrier[NDEF_HANDOVER_CARRIER_MAX];       /*!< Carrier configuration (Bluetooth, Wifi, ...)   */
+  ndefConstBuffer8 bufId[NDEF_HANDOVER_CARRIER_MAX];         /*!< Id of the carrier configuration record         */
+  uint8_t          cps[NDEF_HANDOVER_CARRIER_MAX];           /*!< Carrier Power State                            */
+  uint8_t          carrierCount;                             /*!< Number of local carriers                       */
+
+  ndefType         acType[NDEF_HANDOVER_CARRIER_MAX];        /*!< Alternative Carrier types                      */
+  ndefRecord       acRecord[NDEF_HANDOVER_CARRIER_MAX];      /*!< Alternative Carrier records                    */
+  ndefRecord       carrierRecord[NDEF_HANDOVER_CARRIER_MAX]; /*!< Carrier configuration records                  */
+  ndefType         crType;                                   /*!< Collision Resolution type                      */
+  ndefRecord       crRecord;                                 /*!< Collision Resolution record                    */
+  ndefMessage      localMessage;                             /*!< Local records embedded in the Hs/Hr payload    */
+  ndefType         hoType;                                   /*!< Handover Select/Request type                   */
+  ndefRecord       hoRecord;                                 /*!< Handover Select/Request record                 */
+} ndefHandover;
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize a Connection Handover context
+ *
+ * \param[out] ho: Handover context
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverInit(ndefHandover *ho);
+
+
+/*!
+ *****************************************************************************
+ * Add a local carrier to the handover context
+ *
+ * The carrier type (e.g. initialized with ndefBluetoothInit or
+ * ndefWifiInit) and the id buffer are referenced, not copied.
+ *
+ * \param[in,out] ho:      Handover context
+ * \param[in]     carrier: Carrier configuration type
+ * \param[in]     bufId:   Id given to the carrier configuration record
+ * \param[in]     cps:     Carrier Power State
+ *
+ * \return ERR_NOMEM if NDEF_HANDOVER_CARRIER_MAX carriers are already added
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverAddCarrier(ndefHandover *ho, const ndefType *carrier, const ndefConstBuffer8 *bufId, uint8_t cps);
+
+
+/*!
+ *****************************************************************************
+ * Build a Handover Select message advertising all local carriers
+ *
+ * The message is made of the Hs record followed by the carrier
+ * configuration records, it can be written to a tag (static handover)
+ * or sent as a reply.
+ *
+ * \param[in,out] ho:      Handover context
+ * \param[out]    message: Message to build
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverBuildSelect(ndefHandover *ho, ndefMessage *message);
+
+
+/*!
+ *****************************************************************************
+ * Build a Handover Request message advertising all local carriers
+ *
+ * \param[in,out] ho:           Handover context
+ * \param[in]     randomNumber: Collision Resolution random number
+ * \param[out]    message:      Message to build
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverBuildRequest(ndefHandover *ho, uint16_t randomNumber, ndefMessage *message);
+
+
+/*!
+ *****************************************************************************
+ * Answer a Handover Request (negotiated handover, selector side)
+ *
+ * Build a Handover Select message keeping only the local carriers whose
+ * configuration record type matches a carrier of the request. When none
+ * match, the Handover Select carries no alternative carrier.
+ *
+ * \param[in,out] ho:      Handover context
+ * \param[in]     request: Received Handover Request message
+ * \param[out]    select:  Handover Select message to build
+ *
+ * \return ERR_PROTO if the request has no Handover Request record
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverProcessRequest(ndefHandover *ho, const ndefMessage *request, ndefMessage *select);
+
+
+/*!
+ *****************************************************************************
+ * Get a carrier of a Handover Select or Request message
+ *
+ * Look for the Hs or Hr record, get its n-th alternative carrier and resolve
+ * its carrier data reference against the Ids of the message records.
+ *
+ * \param[in]  message:       Handover Select or Request message
+ * \param[in]  index:         Alternative carrier index, starting at 0
+ * \param[out] cps:           Carrier Power State
+ * \param[out] carrierRecord: Carrier configuration record, to be converted
+ *                            with ndefRecordToType
+ *
+ * \return ERR_NOTFOUND if there is no such carrier
+ * \return ERR_PROTO if the message is not a handover message
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverGetCarrier(const ndefMessage *message, uint32_t index, uint8_t *cps, const ndefRecord **carrierRecord);
+
+
+/*!
+ *****************************************************************************
+ * Get the Collision Resolution random number of a Handover Request message
+ *
+ * \param[in]  message:      Handover Request message
+ * \param[out] randomNumber: Random number
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverGetRandomNumber(const ndefMessage *message, uint16_t *randomNumber);
+
+
+/*!
+ *****************************************************************************
+ * Resolve a Handover Request collision
+ *
+ * When both devices sent a Handover Request, the device with the larger
+ * random number is the Handover Selector if the least significant bits of
+ * both numbers are equal, the one with the smaller number otherwise.
+ *
+ * \param[in]  localRandom:  Random number sent
+ * \param[in]  remoteRandom: Random number received
+ * \param[out] isSelector:   true when the local device must answer with a
+ *                           Handover Select
+ *
+ * \return ERR_AGAIN if both numbers are equal: a new request must be sent
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverResolveCollision(uint16_t localRandom, uint16_t remoteRandom, bool *isSelector);
+
+
+/*!
+ *****************************************************************************
+ * Static handover: read and decode a Handover Select message from a tag
+ *
+ * \param[in]  ctx:     NDEF context, NDEF detected
+ * \param[out] buf:     Buffer to store the raw message, referenced by the
+ *                      decoded message
+ * \param[in]  bufLen:  Buffer length
+ * \param[out] message: Decoded message
+ *
+ * \return ERR_PROTO if the message does not start with a Handover Select record
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverReadStatic(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, ndefMessage *message);
+
+
+#if NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API
+
+/*!
+ *****************************************************************************
+ * Negotiated handover over TNEP (requester side)
+ *
+ * Select the "urn:nfc:sn:handover" service of the tag device, send a
+ * Handover Request advertising all local carriers and decode the Handover
+ * Select answer. The service is deselected before returning.
+ * The TNEP session must have been discovered with ndefTnepDiscover().
+ *
+ * \param[in,out] ho:           Handover context
+ * \param[in,out] tnep:         TNEP session, services discovered
+ * \param[in]     randomNumber: Collision Resolution random number
+ * \param[out]    txBuf:        Buffer to encode the Handover Request
+ * \param[in]     txBufLen:     Tx buffer length
+ * \param[out]    rxBuf:        Buffer to store the raw answer, referenced
+ *                              by the decoded message
+ * \param[in]     rxBufLen:     Rx buffer length
+ * \param[out]    select:       Decoded Handover Select message
+ *
+ * \return ERR_NOTFOUND if the tag device offers no handover service
+ * \return ERR_PROTO if the answer does not start with a Handover Select record
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefHandoverNegotiateTnep(ndefHandover *ho, ndefTnep *tnep, uint16_t randomNumber,
+                                     uint8_t *txBuf, uint32_t txBufLen, uint8_t *rxBuf, uint32_t rxBufLen, ndefMessage *select);
+
+#endif /* NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API */
+
+
+#endif /* NDEF_TYPE_RTD_HANDOVER_SUPPORT */
+
+#endif /* NDEF_HANDOVER_H */
+
+/**
+  * @}
+  *
+  */
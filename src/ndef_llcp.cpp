@@ -0,0 +1,1145 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_llcp.cpp
+  * @brief          : NFC Forum LLCP link layer over NFC-DEP
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_llcp.h"
+#include "nfc_utils.h"
+
+
+#if NDEF_FEATURE_LLCP
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define NDEF_LLCP_VERSION          0x11U   /*!< LLCP version 1.1                      */
+#define NDEF_LLCP_VERSION_MAJOR(v) ((uint8_t)((v) >> 4))
+
+#define NDEF_LLCP_HEADER_LEN       2U      /*!< DSAP, PTYPE, SSAP                     */
+#define NDEF_LLCP_SEQ_LEN          1U      /*!< N(S), N(R)                            */
+#define NDEF_LLCP_AGF_LEN_LEN      2U      /*!< Length of each aggregated PDU         */
+#define NDEF_LLCP_SEQ_MOD          0x0FU   /*!< Sequence numbers are modulo 16        */
+
+#define NDEF_LLCP_PTYPE_SYMM       0x00U   /*!< Symmetry                              */
+#define NDEF_LLCP_PTYPE_PAX        0x01U   /*!< Parameter Exchange                    */
+#define NDEF_LLCP_PTYPE_AGF        0x02U   /*!< Aggregated Frame                      */
+#define NDEF_LLCP_PTYPE_UI         0x03U   /*!< Unnumbered Information                */
+#define NDEF_LLCP_PTYPE_CONNECT    0x04U   /*!< Connect                               */
+#define NDEF_LLCP_PTYPE_DISC       0x05U   /*!< Disconnect                            */
+#define NDEF_LLCP_PTYPE_CC         0x06U   /*!< Connection Complete                   */
+#define NDEF_LLCP_PTYPE_DM         0x07U   /*!< Disconnected Mode                     */
+#define NDEF_LLCP_PTYPE_FRMR       0x08U   /*!< Frame Reject                          */
+#define NDEF_LLCP_PTYPE_SNL        0x09U   /*!< Service Name Lookup                   */
+#define NDEF_LLCP_PTYPE_I          0x0CU   /*!< Information                           */
+#define NDEF_LLCP_PTYPE_RR         0x0DU   /*!< Receive Ready                         */
+#define NDEF_LLCP_PTYPE_RNR        0x0EU   /*!< Receive Not Ready                     */
+
+#define NDEF_LLCP_PARAM_VERSION    0x01U   /*!< Version Number                        */
+#define NDEF_LLCP_PARAM_MIUX       0x02U   /*!< Maximum Information Unit Extension    */
+#define NDEF_LLCP_PARAM_WKS        0x03U   /*!< Well-Known Service List               */
+#define NDEF_LLCP_PARAM_LTO        0x04U   /*!< Link Timeout                          */
+#define NDEF_LLCP_PARAM_RW         0x05U   /*!< Receive Window Size                   */
+#define NDEF_LLCP_PARAM_SN         0x06U   /*!< Service Name                          */
+#define NDEF_LLCP_PARAM_OPT        0x07U   /*!< Option                                */
+
+#define NDEF_LLCP_MIUX_MASK        0x07FFU /*!< MIUX value mask                       */
+#define NDEF_LLCP_LTO_UNIT         10U     /*!< LTO parameter unit (ms)               */
+#define NDEF_LLCP_LTO_DEFAULT      100U    /*!< Default LTO (ms)                      */
+#define NDEF_LLCP_WKS_DEFAULT      0x0001U /*!< Default WKS: LLC Link Management only */
+#define NDEF_LLCP_OPT_LSC_CO       0x02U   /*!< Connection-oriented transport         */
+
+#define NDEF_LLCP_DM_DISC          0x00U   /*!< DM reason: disconnect acknowledged    */
+#define NDEF_LLCP_DM_NO_CONN       0x01U   /*!< DM reason: no active connection       */
+#define NDEF_LLCP_DM_NO_SERVICE    0x02U   /*!< DM reason: no service bound to SAP    */
+#define NDEF_LLCP_DM_REJECTED      0x03U   /*!< DM reason: CONNECT rejected           */
+
+#define NDEF_LLCP_SAP_WKS_MAX      0x0FU   /*!< Last well-known service SAP           */
+#define NDEF_LLCP_SAP_CLIENT       0x20U   /*!< First SAP of the outgoing connections */
+#define NDEF_LLCP_SAP_MAX          0x3FU   /*!< Last SAP                              */
+
+#define NDEF_LLCP_CONN_PARAMS_LEN  7U      /*!< MIUX and RW parameters of CONNECT/CC  */
+#define NDEF_LLCP_DM_LEN           (NDEF_LLCP_HEADER_LEN + 1U)
+
+#define NDEF_LLCP_FRMR_W           0x80U   /*!< FRMR flag: malformed PDU              */
+#define NDEF_LLCP_FRMR_I           0x40U   /*!< FRMR flag: information field invalid  */
+#define NDEF_LLCP_FRMR_R           0x20U   /*!< FRMR flag: N(R) invalid               */
+#define NDEF_LLCP_FRMR_S           0x10U   /*!< FRMR flag: N(S) invalid               */
+
+static const uint8_t ndefLlcpMagic[] = { 0x46U, 0x66U, 0x6DU };  /*!< LLCP magic number */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+/*! LLCP parameters taken from the General Bytes or a CONNECT/CC PDU */
+typedef struct {
+  uint8_t        version;               /*!< Version Number                       */
+  uint16_t       miu;                   /*!< MIU, 128 + MIUX                      */
+  uint16_t       wks;                   /*!< Well-Known Service List              */
+  uint16_t       lto;                   /*!< Link Timeout (ms)                    */
+  uint8_t        rw;                    /*!< Receive Window Size                  */
+  const uint8_t *sn;                    /*!< Service Name                         */
+  uint8_t        snLen;                 /*!< Service Name length                  */
+} ndefLlcpParams;
+
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * \brief Write a PDU header
+ *****************************************************************************
+ */
+static uint32_t ndefLlcpPutHeader(uint8_t *buf, uint8_t dsap, uint8_t ptype, uint8_t ssap)
+{
+  buf[0] = (uint8_t)((uint8_t)(dsap << 2) | (ptype >> 2));
+  buf[1] = (uint8_t)((uint8_t)((ptype & 0x03U) << 6) | (ssap & NDEF_LLCP_SAP_MAX));
+
+  return NDEF_LLCP_HEADER_LEN;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Write the local MIUX and RW parameters of a CONNECT or CC PDU
+ *****************************************************************************
+ */
+static uint32_t ndefLlcpPutConnParams(uint8_t *buf)
+{
+  uint16_t miux = (uint16_t)(NDEF_LLCP_MIU - NDEF_LLCP_MIU_DEFAULT);
+
+  buf[0] = NDEF_LLCP_PARAM_MIUX;
+  buf[1] = 2U;
+  buf[2] = (uint8_t)(miux >> 8);
+  buf[3] = (uint8_t)miux;
+  buf[4] = NDEF_LLCP_PARAM_RW;
+  buf[5] = 1U;
+  buf[6] = NDEF_LLCP_RW;
+
+  return NDEF_LLCP_CONN_PARAMS_LEN;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Parse the parameter TLVs, unknown parameters are ignored
+ *****************************************************************************
+ */
+static ReturnCode ndefLlcpParseParams(const uint8_t *buf, uint32_t len, ndefLlcpParams *params)
+{
+  uint32_t       offset = 0;
+  const uint8_t *value;
+  uint8_t        valueLen;
+
+  params->version = 0;
+  params->miu     = NDEF_LLCP_MIU_DEFAULT;
+  params->wks     = NDEF_LLCP_WKS_DEFAULT;
+  params->lto     = NDEF_LLCP_LTO_DEFAULT;
+  params->rw      = 1U;
+  params->sn      = NULL;
+  params->snLen   = 0;
+
+  while (offset < len) {
+    if ((offset + 2U) > len) {
+      return ERR_PROTO;
+    }
+    valueLen = buf[offset + 1U];
+    value    = &buf[offset + 2U];
+    if ((offset + 2U + valueLen) > len) {
+      return ERR_PROTO;
+    }
+
+    switch (buf[offset]) {
+      case NDEF_LLCP_PARAM_VERSION:
+        if (valueLen >= 1U) {
+          params->version = value[0];
+        }
+        break;
+      case NDEF_LLCP_PARAM_MIUX:
+        if (valueLen >= 2U) {
+          params->miu = (uint16_t)(NDEF_LLCP_MIU_DEFAULT + (GETU16(value) & NDEF_LLCP_MIUX_MASK));
+        }
+        break;
+      case NDEF_LLCP_PARAM_WKS:
+        if (valueLen >= 2U) {
+          params->wks = GETU16(value);
+        }
+        break;
+      case NDEF_LLCP_PARAM_LTO:
+        if ((valueLen >= 1U) && (value[0] != 0U)) {
+          params->lto = (uint16_t)(value[0] * NDEF_LLCP_LTO_UNIT);
+        }
+        break;
+      case NDEF_LLCP_PARAM_RW:
+        if (valueLen >= 1U) {
+          params->rw = (value[0] & NDEF_LLCP_SEQ_MOD);
+        }
+        break;
+      case NDEF_LLCP_PARAM_SN:
+        params->sn    = value;
+        params->snLen = valueLen;
+        break;
+      default:
+        break;
+    }
+    offset += 2U + valueLen;
+  }
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Find the connection bound to a local and remote SAP
+ *****************************************************************************
+ */
+static ndefLlcpConn *ndefLlcpFindConn(ndefLlcp *llcp, uint8_t lsap, uint8_t rsap)
+{
+  uint8_t i;
+
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    if ((llcp->conn[i].state != NDEF_LLCP_CONN_CLOSED) && (llcp->conn[i].lsap == lsap) && (llcp->conn[i].rsap == rsap)) {
+      return &llcp->conn[i];
+    }
+  }
+
+  return NULL;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Release a connection and notify its owner
+ *****************************************************************************
+ */
+static void ndefLlcpCloseConn(ndefLlcp *llcp, ndefLlcpConn *conn)
+{
+  ndefLlcpCallbacks cb = conn->cb;
+  uint8_t           index = (uint8_t)(conn - llcp->conn);
+
+  (void)ST_MEMSET(conn, 0, sizeof(ndefLlcpConn));
+  conn->state = NDEF_LLCP_CONN_CLOSED;
+
+  if (cb.closed != NULL) {
+    cb.closed(cb.cbCtx, index);
+  }
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Close the link and all its connections
+ *****************************************************************************
+ */
+static void ndefLlcpCloseLink(ndefLlcp *llcp)
+{
+  uint8_t i;
+
+  llcp->state = NDEF_LLCP_LINK_CLOSED;
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    if (llcp->conn[i].state != NDEF_LLCP_CONN_CLOSED) {
+      ndefLlcpCloseConn(llcp, &llcp->conn[i]);
+    }
+  }
+  llcp->dmCount = 0;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Queue a DM PDU, dropped when the queue is full
+ *****************************************************************************
+ */
+static void ndefLlcpQueueDm(ndefLlcp *llcp, uint8_t dsap, uint8_t ssap, uint8_t reason)
+{
+  if (llcp->dmCount < NDEF_LLCP_CONN_MAX) {
+    llcp->dm[llcp->dmCount].dsap   = dsap;
+    llcp->dm[llcp->dmCount].ssap   = ssap;
+    llcp->dm[llcp->dmCount].reason = reason;
+    llcp->dmCount++;
+  }
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Reject a PDU received on a connection
+ *
+ * The connection sends a FRMR PDU and is closed once it is sent, no other
+ * PDU is accepted on it meanwhile.
+ *****************************************************************************
+ */
+static void ndefLlcpReject(ndefLlcpConn *conn, uint8_t flags, uint8_t ptype, const uint8_t *info, uint32_t infoLen)
+{
+  conn->state       = NDEF_LLCP_CONN_REJECTING;
+  conn->ctrlPending = true;
+  conn->frmrFlags   = (uint8_t)(flags | ptype);
+  conn->frmrSeq     = ((infoLen >= NDEF_LLCP_SEQ_LEN) ? info[0] : 0U);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Process the N(R) of a received I, RR or RNR PDU
+ *****************************************************************************
+ */
+static bool ndefLlcpAcknowledge(ndefLlcpConn *conn, uint8_t nr)
+{
+  if (((uint8_t)(nr - conn->vsa) & NDEF_LLCP_SEQ_MOD) > ((uint8_t)(conn->vs - conn->vsa) & NDEF_LLCP_SEQ_MOD)) {
+    return false;
+  }
+  conn->vsa = nr;
+
+  return true;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Whether an I PDU can be sent on a connection
+ *****************************************************************************
+ */
+static bool ndefLlcpCanSendI(const ndefLlcpConn *conn)
+{
+  return ((conn->state == NDEF_LLCP_CONN_CONNECTED) && (conn->txPos < conn->txLen) && !conn->remoteBusy &&
+          (((uint8_t)(conn->vs - conn->vsa) & NDEF_LLCP_SEQ_MOD) < conn->rwr));
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Whether a PDU other than SYMM is pending
+ *****************************************************************************
+ */
+static bool ndefLlcpHasPending(const ndefLlcp *llcp)
+{
+  const ndefLlcpConn *conn;
+  uint8_t             i;
+
+  if (llcp->discPending || (llcp->dmCount != 0U)) {
+    return true;
+  }
+
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    conn = &llcp->conn[i];
+    if (conn->ctrlPending || ndefLlcpCanSendI(conn)) {
+      return true;
+    }
+    if ((conn->state == NDEF_LLCP_CONN_CONNECTED) && ((conn->vra != conn->vr) || (conn->localBusy != conn->busyReported))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Room left for the next PDU
+ *
+ * The first PDU may use the whole buffer, further PDUs are aggregated and
+ * the AGF information field shall not exceed the remote link MIU.
+ *****************************************************************************
+ */
+static uint32_t ndefLlcpRoom(const ndefLlcp *llcp, uint32_t bufLen, uint32_t pos, uint32_t count)
+{
+  uint32_t limit = ((count == 0U) ? bufLen : MIN(bufLen, (NDEF_LLCP_HEADER_LEN + (uint32_t)llcp->miu)));
+
+  return ((limit > (pos + NDEF_LLCP_AGF_LEN_LEN)) ? (limit - pos - NDEF_LLCP_AGF_LEN_LEN) : 0U);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Append a PDU written at pos + NDEF_LLCP_AGF_LEN_LEN
+ *****************************************************************************
+ */
+static void ndefLlcpAppend(uint8_t *buf, uint32_t *pos, uint32_t *count, uint32_t len)
+{
+  buf[*pos]      = (uint8_t)(len >> 8);
+  buf[*pos + 1U] = (uint8_t)len;
+  *pos          += NDEF_LLCP_AGF_LEN_LEN + len;
+  (*count)++;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Build the next PDU to send
+ *
+ * Pending PDUs are collected by priority: DM, connection control, I PDUs
+ * within the remote receive window, then RR/RNR for the connections whose
+ * received I PDUs were not acknowledged by an outgoing I PDU. Several PDUs
+ * are sent in an AGF PDU, none in a SYMM PDU.
+ *****************************************************************************
+ */
+static uint32_t ndefLlcpBuild(ndefLlcp *llcp, uint8_t *buf, uint32_t bufLen)
+{
+  ndefLlcpConn *conn;
+  uint8_t      *pdu;
+  uint32_t      pos   = NDEF_LLCP_HEADER_LEN;
+  uint32_t      count = 0;
+  uint32_t      len;
+  uint32_t      infoLen;
+  uint8_t       i;
+  uint8_t       j;
+
+  if (llcp->discPending) {
+    llcp->discPending = false;
+    llcp->state       = NDEF_LLCP_LINK_DEACTIVATING;
+    llcp->stats.txPdus++;
+    return ndefLlcpPutHeader(buf, NDEF_LLCP_SAP_LINK, NDEF_LLCP_PTYPE_DISC, NDEF_LLCP_SAP_LINK);
+  }
+
+  /* DM PDUs */
+  i = 0;
+  while ((i < llcp->dmCount) && (ndefLlcpRoom(llcp, bufLen, pos, count) >= NDEF_LLCP_DM_LEN)) {
+    pdu = &buf[pos + NDEF_LLCP_AGF_LEN_LEN];
+    len = ndefLlcpPutHeader(pdu, llcp->dm[i].dsap, NDEF_LLCP_PTYPE_DM, llcp->dm[i].ssap);
+    pdu[len++] = llcp->dm[i].reason;
+    ndefLlcpAppend(buf, &pos, &count, len);
+    i++;
+  }
+  for (j = 0; (i + j) < llcp->dmCount; j++) {
+    llcp->dm[j] = llcp->dm[i + j];
+  }
+  llcp->dmCount = j;
+
+  /* CONNECT, CC, DISC and FRMR PDUs */
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    conn = &llcp->conn[i];
+    if (!conn->ctrlPending || (ndefLlcpRoom(llcp, bufLen, pos, count) < (NDEF_LLCP_HEADER_LEN + NDEF_LLCP_CONN_PARAMS_LEN))) {
+      continue;
+    }
+    pdu = &buf[pos + NDEF_LLCP_AGF_LEN_LEN];
+    if (conn->state == NDEF_LLCP_CONN_CONNECTING) {
+      len  = ndefLlcpPutHeader(pdu, conn->rsap, NDEF_LLCP_PTYPE_CONNECT, conn->lsap);
+      len += ndefLlcpPutConnParams(&pdu[len]);
+    } else if (conn->state == NDEF_LLCP_CONN_ACCEPTING) {
+      len  = ndefLlcpPutHeader(pdu, conn->rsap, NDEF_LLCP_PTYPE_CC, conn->lsap);
+      len += ndefLlcpPutConnParams(&pdu[len]);
+    } else if (conn->state == NDEF_LLCP_CONN_REJECTING) {
+      len  = ndefLlcpPutHeader(pdu, conn->rsap, NDEF_LLCP_PTYPE_FRMR, conn->lsap);
+      pdu[len++] = conn->frmrFlags;
+      pdu[len++] = conn->frmrSeq;
+      pdu[len++] = (uint8_t)((uint8_t)(conn->vs << 4) | conn->vr);
+      pdu[len++] = (uint8_t)((uint8_t)(conn->vsa << 4) | conn->vra);
+    } else {
+      len  = ndefLlcpPutHeader(pdu, conn->rsap, NDEF_LLCP_PTYPE_DISC, conn->lsap);
+    }
+    ndefLlcpAppend(buf, &pos, &count, len);
+    conn->ctrlPending = false;
+
+    if (conn->state == NDEF_LLCP_CONN_REJECTING) {
+      ndefLlcpCloseConn(llcp, conn);                                      /* No DISC/DM exchange after a FRMR */
+    } else if (conn->state == NDEF_LLCP_CONN_ACCEPTING) {
+      conn->state = NDEF_LLCP_CONN_CONNECTED;
+      if (conn->cb.connected != NULL) {
+        conn->cb.connected(conn->cb.cbCtx, i);
+      }
+    }
+  }
+
+  /* I PDUs, N(R) acknowledges the received ones */
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    conn = &llcp->conn[i];
+    while (ndefLlcpCanSendI(conn) && (ndefLlcpRoom(llcp, bufLen, pos, count) > (NDEF_LLCP_HEADER_LEN + NDEF_LLCP_SEQ_LEN))) {
+      infoLen = MIN((conn->txLen - conn->txPos), (uint32_t)conn->miur);
+      infoLen = MIN(infoLen, (ndefLlcpRoom(llcp, bufLen, pos, count) - NDEF_LLCP_HEADER_LEN - NDEF_LLCP_SEQ_LEN));
+
+      pdu = &buf[pos + NDEF_LLCP_AGF_LEN_LEN];
+      len = ndefLlcpPutHeader(pdu, conn->rsap, NDEF_LLCP_PTYPE_I, conn->lsap);
+      pdu[len++] = (uint8_t)((uint8_t)(conn->vs << 4) | conn->vr);
+      (void)ST_MEMCPY(&pdu[len], &conn->txData[conn->txPos], infoLen);
+      ndefLlcpAppend(buf, &pos, &count, (len + infoLen));
+
+      conn->vs      = (uint8_t)(conn->vs + 1U) & NDEF_LLCP_SEQ_MOD;
+      conn->vra     = conn->vr;
+      conn->txPos  += infoLen;
+      llcp->stats.txBytes += infoLen;
+    }
+  }
+
+  /* RR and RNR PDUs */
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    conn = &llcp->conn[i];
+    if ((conn->state != NDEF_LLCP_CONN_CONNECTED) || ((conn->vra == conn->vr) && (conn->localBusy == conn->busyReported))) {
+      continue;
+    }
+    if (ndefLlcpRoom(llcp, bufLen, pos, count) < (NDEF_LLCP_HEADER_LEN + NDEF_LLCP_SEQ_LEN)) {
+      break;
+    }
+    pdu = &buf[pos + NDEF_LLCP_AGF_LEN_LEN];
+    len = ndefLlcpPutHeader(pdu, conn->rsap, (conn->localBusy ? NDEF_LLCP_PTYPE_RNR : NDEF_LLCP_PTYPE_RR), conn->lsap);
+    pdu[len++] = conn->vr;
+    ndefLlcpAppend(buf, &pos, &count, len);
+
+    conn->vra          = conn->vr;
+    conn->busyReported = conn->localBusy;
+  }
+
+  llcp->stats.txPdus += count;
+
+  if (count == 0U) {
+    llcp->stats.symm++;
+    llcp->stats.txPdus++;
+    return ndefLlcpPutHeader(buf, NDEF_LLCP_SAP_LINK, NDEF_LLCP_PTYPE_SYMM, NDEF_LLCP_SAP_LINK);
+  }
+
+  if (count == 1U) {
+    len = pos - NDEF_LLCP_HEADER_LEN - NDEF_LLCP_AGF_LEN_LEN;
+    (void)ST_MEMMOVE(buf, &buf[NDEF_LLCP_HEADER_LEN + NDEF_LLCP_AGF_LEN_LEN], len);
+    return len;
+  }
+
+  llcp->stats.agf++;
+  (void)ndefLlcpPutHeader(buf, NDEF_LLCP_SAP_LINK, NDEF_LLCP_PTYPE_AGF, NDEF_LLCP_SAP_LINK);
+
+  return pos;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Process a received CONNECT PDU
+ *****************************************************************************
+ */
+static void ndefLlcpHandleConnect(ndefLlcp *llcp, uint8_t dsap, uint8_t ssap, const uint8_t *info, uint32_t infoLen)
+{
+  ndefLlcpParams         params;
+  const ndefLlcpService *service = NULL;
+  ndefLlcpConn          *conn    = NULL;
+  uint8_t                i;
+
+  if (ndefLlcpParseParams(info, infoLen, &params) != ERR_NONE) {
+    ndefLlcpQueueDm(llcp, ssap, dsap, NDEF_LLCP_DM_REJECTED);
+    return;
+  }
+
+  for (i = 0; i < llcp->serviceCount; i++) {
+    if (dsap == NDEF_LLCP_SAP_SDP) {
+      if ((params.sn != NULL) && (params.snLen == llcp->service[i].name.length) &&
+          (ST_BYTECMP(params.sn, llcp->service[i].name.buffer, params.snLen) == 0)) {
+        service = &llcp->service[i];
+      }
+    } else if (llcp->service[i].sap == dsap) {
+      service = &llcp->service[i];
+    } else {
+      /* MISRA 15.7 - Empty else */
+    }
+  }
+  if (service == NULL) {
+    ndefLlcpQueueDm(llcp, ssap, dsap, NDEF_LLCP_DM_NO_SERVICE);
+    return;
+  }
+
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    if (llcp->conn[i].state == NDEF_LLCP_CONN_CLOSED) {
+      conn = &llcp->conn[i];
+      break;
+    }
+  }
+  if ((conn == NULL) || (ndefLlcpFindConn(llcp, service->sap, ssap) != NULL)) {
+    ndefLlcpQueueDm(llcp, ssap, dsap, NDEF_LLCP_DM_REJECTED);
+    return;
+  }
+
+  (void)ST_MEMSET(conn, 0, sizeof(ndefLlcpConn));
+  conn->state       = NDEF_LLCP_CONN_ACCEPTING;
+  conn->ctrlPending = true;
+  conn->lsap        = service->sap;
+  conn->rsap        = ssap;
+  conn->miur        = params.miu;
+  conn->rwr         = params.rw;
+  conn->cb          = service->cb;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Process a received PDU, AGF PDUs are split into their PDUs
+ *****************************************************************************
+ */
+static ReturnCode ndefLlcpProcess(ndefLlcp *llcp, const uint8_t *pdu, uint32_t len, bool aggregated)
+{
+  ReturnCode     err;
+  ndefLlcpParams params;
+  ndefLlcpConn  *conn;
+  const uint8_t *info;
+  uint32_t       infoLen;
+  uint32_t       offset;
+  uint32_t       subLen;
+  uint8_t        dsap;
+  uint8_t        ssap;
+  uint8_t        ptype;
+  uint8_t        i;
+
+  if (len < NDEF_LLCP_HEADER_LEN) {
+    return ERR_PROTO;
+  }
+
+  dsap    = (uint8_t)(pdu[0] >> 2);
+  ptype   = (uint8_t)((uint8_t)((pdu[0] & 0x03U) << 2) | (pdu[1] >> 6));
+  ssap    = (uint8_t)(pdu[1] & NDEF_LLCP_SAP_MAX);
+  info    = &pdu[NDEF_LLCP_HEADER_LEN];
+  infoLen = len - NDEF_LLCP_HEADER_LEN;
+
+  if (ptype != NDEF_LLCP_PTYPE_AGF) {
+    llcp->stats.rxPdus++;
+  }
+
+  switch (ptype) {
+    case NDEF_LLCP_PTYPE_SYMM:
+      llcp->lastSymm = !aggregated;
+      break;
+
+    case NDEF_LLCP_PTYPE_AGF:
+      if (aggregated) {
+        return ERR_PROTO;
+      }
+      offset = 0;
+      while (offset < infoLen) {
+        if ((offset + NDEF_LLCP_AGF_LEN_LEN) > infoLen) {
+          return ERR_PROTO;
+        }
+        subLen  = GETU16(&info[offset]);
+        offset += NDEF_LLCP_AGF_LEN_LEN;
+        if ((offset + subLen) > infoLen) {
+          return ERR_PROTO;
+        }
+        err = ndefLlcpProcess(llcp, &info[offset], subLen, true);
+        if (err != ERR_NONE) {
+          return err;
+        }
+        offset += subLen;
+      }
+      break;
+
+    case NDEF_LLCP_PTYPE_CONNECT:
+      ndefLlcpHandleConnect(llcp, dsap, ssap, info, infoLen);
+      break;
+
+    case NDEF_LLCP_PTYPE_CC:
+      for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+        conn = &llcp->conn[i];
+        if ((conn->state == NDEF_LLCP_CONN_CONNECTING) && !conn->ctrlPending && (conn->lsap == dsap)) {
+          if (ndefLlcpParseParams(info, infoLen, &params) == ERR_NONE) {
+            conn->state = NDEF_LLCP_CONN_CONNECTED;
+            conn->rsap  = ssap;
+            conn->miur  = params.miu;
+            conn->rwr   = params.rw;
+            if (conn->cb.connected != NULL) {
+              conn->cb.connected(conn->cb.cbCtx, i);
+            }
+          } else {
+            conn->state       = NDEF_LLCP_CONN_DISCONNECTING;
+            conn->rsap        = ssap;
+            conn->ctrlPending = true;
+          }
+          break;
+        }
+      }
+      break;
+
+    case NDEF_LLCP_PTYPE_DM:
+      for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+        conn = &llcp->conn[i];
+        if ((conn->state != NDEF_LLCP_CONN_CLOSED) && (conn->lsap == dsap) &&
+            ((conn->rsap == ssap) || (conn->state == NDEF_LLCP_CONN_CONNECTING))) {
+          ndefLlcpCloseConn(llcp, conn);
+          break;
+        }
+      }
+      break;
+
+    case NDEF_LLCP_PTYPE_DISC:
+      if ((dsap == NDEF_LLCP_SAP_LINK) && (ssap == NDEF_LLCP_SAP_LINK)) {
+        ndefLlcpCloseLink(llcp);
+        break;
+      }
+      conn = ndefLlcpFindConn(llcp, dsap, ssap);
+      ndefLlcpQueueDm(llcp, ssap, dsap, ((conn != NULL) ? NDEF_LLCP_DM_DISC : NDEF_LLCP_DM_NO_CONN));
+      if (conn != NULL) {
+        ndefLlcpCloseConn(llcp, conn);
+      }
+      break;
+
+    case NDEF_LLCP_PTYPE_I:
+    case NDEF_LLCP_PTYPE_RR:
+    case NDEF_LLCP_PTYPE_RNR:
+      conn = ndefLlcpFindConn(llcp, dsap, ssap);
+      if ((conn == NULL) || (conn->state != NDEF_LLCP_CONN_CONNECTED)) {
+        if (conn == NULL) {
+          ndefLlcpQueueDm(llcp, ssap, dsap, NDEF_LLCP_DM_NO_CONN);
+        }
+        break;
+      }
+      /* Invalid PDUs are rejected with a FRMR, which closes the connection rather than the link */
+      if ((infoLen < NDEF_LLCP_SEQ_LEN) || ((ptype != NDEF_LLCP_PTYPE_I) && (infoLen != NDEF_LLCP_SEQ_LEN))) {
+        ndefLlcpReject(conn, NDEF_LLCP_FRMR_W, ptype, info, infoLen);
+        break;
+      }
+      if ((ptype == NDEF_LLCP_PTYPE_I) && ((infoLen - NDEF_LLCP_SEQ_LEN) > NDEF_LLCP_MIU)) {
+        ndefLlcpReject(conn, NDEF_LLCP_FRMR_I, ptype, info, infoLen);
+        break;
+      }
+      if ((ptype == NDEF_LLCP_PTYPE_I) &&
+          (((uint8_t)(info[0] >> 4) != conn->vr) || (((uint8_t)(conn->vr - conn->vra) & NDEF_LLCP_SEQ_MOD) >= NDEF_LLCP_RW))) {
+        /* Out of sequence or beyond the local receive window: dropped */
+        ndefLlcpReject(conn, NDEF_LLCP_FRMR_S, ptype, info, infoLen);
+        break;
+      }
+      if (!ndefLlcpAcknowledge(conn, (info[0] & NDEF_LLCP_SEQ_MOD))) {
+        ndefLlcpReject(conn, NDEF_LLCP_FRMR_R, ptype, info, infoLen);
+        break;
+      }
+      if (ptype != NDEF_LLCP_PTYPE_I) {
+        conn->remoteBusy = (ptype == NDEF_LLCP_PTYPE_RNR);
+        break;
+      }
+      conn->vr = (uint8_t)(conn->vr + 1U) & NDEF_LLCP_SEQ_MOD;
+      llcp->stats.rxBytes += (infoLen - NDEF_LLCP_SEQ_LEN);
+      if (conn->cb.received != NULL) {
+        conn->cb.received(conn->cb.cbCtx, (uint8_t)(conn - llcp->conn), &info[NDEF_LLCP_SEQ_LEN], (uint16_t)(infoLen - NDEF_LLCP_SEQ_LEN));
+      }
+      break;
+
+    case NDEF_LLCP_PTYPE_FRMR:
+      conn = ndefLlcpFindConn(llcp, dsap, ssap);
+      if (conn != NULL) {
+        ndefLlcpCloseConn(llcp, conn);
+      }
+      break;
+
+    default:
+      /* PAX, UI and SNL: connectionless transport and service discovery are not supported */
+      break;
+  }
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpInit(ndefLlcp *llcp, RfalNfcClass *rfal_nfc)
+{
+  if ((llcp == NULL) || (rfal_nfc == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMSET(llcp, 0, sizeof(ndefLlcp));
+
+  llcp->rfal_nfc = rfal_nfc;
+  llcp->state    = NDEF_LLCP_LINK_IDLE;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpRegisterService(ndefLlcp *llcp, uint8_t sap, const ndefConstBuffer *name, const ndefLlcpCallbacks *cb)
+{
+  ndefLlcpService *service;
+
+  if ((llcp == NULL) || (cb == NULL) || (sap <= NDEF_LLCP_SAP_SDP) || (sap >= NDEF_LLCP_SAP_CLIENT)) {
+    return ERR_PARAM;
+  }
+
+  if (llcp->serviceCount >= NDEF_LLCP_SERVICE_MAX) {
+    return ERR_NOMEM;
+  }
+
+  service = &llcp->service[llcp->serviceCount];
+  service->sap = sap;
+  service->cb  = *cb;
+  if (name != NULL) {
+    service->name = *name;
+  } else {
+    service->name.buffer = NULL;
+    service->name.length = 0;
+  }
+  llcp->serviceCount++;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpGetGeneralBytes(const ndefLlcp *llcp, uint8_t *gb, uint8_t *gbLen)
+{
+  uint16_t miux = (uint16_t)(NDEF_LLCP_MIU - NDEF_LLCP_MIU_DEFAULT);
+  uint16_t wks  = NDEF_LLCP_WKS_DEFAULT;
+  uint8_t  len  = 0;
+  uint8_t  i;
+
+  if ((llcp == NULL) || (gb == NULL) || (gbLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (*gbLen < NDEF_LLCP_GB_LEN) {
+    return ERR_NOMEM;
+  }
+
+  for (i = 0; i < llcp->serviceCount; i++) {
+    if (llcp->service[i].sap <= NDEF_LLCP_SAP_WKS_MAX) {
+      wks |= (uint16_t)(1U << llcp->service[i].sap);
+    }
+  }
+
+  (void)ST_MEMCPY(gb, ndefLlcpMagic, sizeof(ndefLlcpMagic));
+  len += (uint8_t)sizeof(ndefLlcpMagic);
+
+  gb[len++] = NDEF_LLCP_PARAM_VERSION;
+  gb[len++] = 1U;
+  gb[len++] = NDEF_LLCP_VERSION;
+
+  gb[len++] = NDEF_LLCP_PARAM_MIUX;
+  gb[len++] = 2U;
+  gb[len++] = (uint8_t)(miux >> 8);
+  gb[len++] = (uint8_t)miux;
+
+  gb[len++] = NDEF_LLCP_PARAM_WKS;
+  gb[len++] = 2U;
+  gb[len++] = (uint8_t)(wks >> 8);
+  gb[len++] = (uint8_t)wks;
+
+  gb[len++] = NDEF_LLCP_PARAM_LTO;
+  gb[len++] = 1U;
+  gb[len++] = (uint8_t)(NDEF_LLCP_LTO / NDEF_LLCP_LTO_UNIT);
+
+  gb[len++] = NDEF_LLCP_PARAM_OPT;
+  gb[len++] = 1U;
+  gb[len++] = NDEF_LLCP_OPT_LSC_CO;
+
+  *gbLen = len;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpActivate(ndefLlcp *llcp, const ndefDevice *dev)
+{
+  ReturnCode     err;
+  ndefLlcpParams params;
+  const uint8_t *gb;
+  uint8_t        gbLen;
+
+  if ((llcp == NULL) || (dev == NULL) || (dev->rfInterface != RFAL_NFC_INTERFACE_NFCDEP)) {
+    return ERR_PARAM;
+  }
+
+  /* A remote poller makes the local device the Target */
+  llcp->initiator = !rfalNfcIsRemDevPoller(dev->type);
+  gb              = (llcp->initiator ? dev->proto.nfcDep.activation.Target.ATR_RES.GBt : dev->proto.nfcDep.activation.Initiator.ATR_REQ.GBi);
+  gbLen           = MIN(dev->proto.nfcDep.info.GBLen, (uint8_t)RFAL_NFCDEP_GB_MAX_LEN);
+
+  if ((gbLen < sizeof(ndefLlcpMagic)) || (ST_BYTECMP(gb, ndefLlcpMagic, sizeof(ndefLlcpMagic)) != 0)) {
+    return ERR_PROTO;
+  }
+
+  err = ndefLlcpParseParams(&gb[sizeof(ndefLlcpMagic)], (uint32_t)gbLen - sizeof(ndefLlcpMagic), &params);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  if (NDEF_LLCP_VERSION_MAJOR(params.version) != NDEF_LLCP_VERSION_MAJOR(NDEF_LLCP_VERSION)) {
+    return ERR_NOTSUPP;
+  }
+
+  (void)ST_MEMSET(llcp->conn, 0, sizeof(llcp->conn));
+  (void)ST_MEMSET(&llcp->stats, 0, sizeof(ndefLlcpStats));
+  llcp->dmCount     = 0;
+  llcp->discPending = false;
+  llcp->txRxOngoing = false;
+  llcp->lastSymm    = false;
+  llcp->firstRx     = !llcp->initiator;
+  llcp->version     = params.version;
+  llcp->miu         = params.miu;
+  llcp->wks         = params.wks;
+  llcp->lto         = params.lto;
+  llcp->startTime   = millis();
+  llcp->rxTime      = llcp->startTime;
+  llcp->state       = NDEF_LLCP_LINK_ACTIVE;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpWorker(ndefLlcp *llcp)
+{
+  ReturnCode    ret;
+  RfalNfcClass *rfal_nfc;
+  uint8_t      *txBuf;
+  uint16_t      txBufLen;
+  uint32_t      len;
+
+  if (llcp == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (llcp->state == NDEF_LLCP_LINK_CLOSED) {
+    return ERR_NONE;
+  }
+  if (llcp->state == NDEF_LLCP_LINK_IDLE) {
+    return ERR_WRONG_STATE;
+  }
+
+  rfal_nfc = llcp->rfal_nfc;
+
+  if (!llcp->txRxOngoing) {
+    if (llcp->firstRx) {
+      /* Target: the Initiator sends the first PDU */
+      ret = rfal_nfc->rfalNfcDataExchangeStart(NULL, 0, &llcp->rxData, &llcp->rxLen, RFAL_FWT_NONE);
+    } else {
+      /* Initiator: hold back a SYMM answering a SYMM so that an idle link does not spin */
+      if (llcp->initiator && llcp->lastSymm && !ndefLlcpHasPending(llcp) &&
+          ((millis() - llcp->rxTime) < MIN((uint32_t)NDEF_LLCP_SYMM_DELAY, ((uint32_t)llcp->lto / 2U)))) {
+        return ERR_BUSY;
+      }
+
+      ret = rfal_nfc->rfalNfcDataExchangeGetTxBuffer(&txBuf, &txBufLen);
+      if (ret != ERR_NONE) {
+        ndefLlcpCloseLink(llcp);
+        return ret;
+      }
+      len = ndefLlcpBuild(llcp, txBuf, MIN((uint32_t)txBufLen, (uint32_t)RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN));
+      ret = rfal_nfc->rfalNfcDataExchangeCommit((uint16_t)len, &llcp->rxData, &llcp->rxLen, RFAL_FWT_NONE);
+    }
+    if (ret != ERR_NONE) {
+      ndefLlcpCloseLink(llcp);
+      return ret;
+    }
+    llcp->txRxOngoing = true;
+    return ERR_BUSY;
+  }
+
+  rfal_nfc->rfalNfcWorker();
+  ret = rfal_nfc->rfalNfcDataExchangeGetStatus();
+  if (ret == ERR_BUSY) {
+    return ERR_BUSY;
+  }
+  llcp->txRxOngoing = false;
+  llcp->firstRx     = false;
+
+  llcp->stats.duration = millis() - llcp->startTime;
+  llcp->stats.kbps     = ((llcp->stats.duration != 0U) ? (uint32_t)((((uint64_t)llcp->stats.txBytes + llcp->stats.rxBytes) * 8U) / llcp->stats.duration) : 0U);
+
+  /* DISC on SAP 0 sent: the remote releases the NFC-DEP link */
+  if (llcp->state == NDEF_LLCP_LINK_DEACTIVATING) {
+    ndefLlcpCloseLink(llcp);
+    return ERR_NONE;
+  }
+
+  if (ret != ERR_NONE) {
+    ndefLlcpCloseLink(llcp);
+    return ret;
+  }
+
+  llcp->rxTime   = millis();
+  llcp->lastSymm = false;
+  ret = ndefLlcpProcess(llcp, llcp->rxData, *llcp->rxLen, false);
+  if (ret != ERR_NONE) {
+    ndefLlcpCloseLink(llcp);
+    return ret;
+  }
+
+  return ((llcp->state == NDEF_LLCP_LINK_CLOSED) ? ERR_NONE : ERR_BUSY);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpConnect(ndefLlcp *llcp, uint8_t dsap, const ndefLlcpCallbacks *cb, uint8_t *conn)
+{
+  uint8_t i;
+
+  if ((llcp == NULL) || (cb == NULL) || (conn == NULL) || (dsap <= NDEF_LLCP_SAP_LINK) || (dsap > NDEF_LLCP_SAP_MAX)) {
+    return ERR_PARAM;
+  }
+
+  if (llcp->state != NDEF_LLCP_LINK_ACTIVE) {
+    return ERR_WRONG_STATE;
+  }
+
+  for (i = 0; i < NDEF_LLCP_CONN_MAX; i++) {
+    if (llcp->conn[i].state == NDEF_LLCP_CONN_CLOSED) {
+      (void)ST_MEMSET(&llcp->conn[i], 0, sizeof(ndefLlcpConn));
+      llcp->conn[i].state       = NDEF_LLCP_CONN_CONNECTING;
+      llcp->conn[i].ctrlPending = true;
+      llcp->conn[i].lsap        = (uint8_t)(NDEF_LLCP_SAP_CLIENT + i);
+      llcp->conn[i].rsap        = dsap;
+      llcp->conn[i].cb          = *cb;
+      *conn = i;
+      return ERR_NONE;
+    }
+  }
+
+  return ERR_NOMEM;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpSend(ndefLlcp *llcp, uint8_t conn, const uint8_t *data, uint32_t len)
+{
+  if ((llcp == NULL) || (conn >= NDEF_LLCP_CONN_MAX) || ((data == NULL) && (len != 0U))) {
+    return ERR_PARAM;
+  }
+
+  if (llcp->conn[conn].state != NDEF_LLCP_CONN_CONNECTED) {
+    return ERR_WRONG_STATE;
+  }
+
+  if (llcp->conn[conn].txPos < llcp->conn[conn].txLen) {
+    return ERR_BUSY;
+  }
+
+  llcp->conn[conn].txData = data;
+  llcp->conn[conn].txLen  = len;
+  llcp->conn[conn].txPos  = 0;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpGetSendStatus(const ndefLlcp *llcp, uint8_t conn)
+{
+  if ((llcp == NULL) || (conn >= NDEF_LLCP_CONN_MAX)) {
+    return ERR_PARAM;
+  }
+
+  if (llcp->conn[conn].state != NDEF_LLCP_CONN_CONNECTED) {
+    return ERR_WRONG_STATE;
+  }
+
+  return ((llcp->conn[conn].txPos < llcp->conn[conn].txLen) ? ERR_BUSY : ERR_NONE);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpSetBusy(ndefLlcp *llcp, uint8_t conn, bool busy)
+{
+  if ((llcp == NULL) || (conn >= NDEF_LLCP_CONN_MAX)) {
+    return ERR_PARAM;
+  }
+
+  llcp->conn[conn].localBusy = busy;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+uint16_t ndefLlcpGetRemoteMiu(const ndefLlcp *llcp, uint8_t conn)
+{
+  if ((llcp == NULL) || (conn >= NDEF_LLCP_CONN_MAX) || (llcp->conn[conn].state != NDEF_LLCP_CONN_CONNECTED)) {
+    return 0;
+  }
+
+  return llcp->conn[conn].miur;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpDisconnect(ndefLlcp *llcp, uint8_t conn)
+{
+  if ((llcp == NULL) || (conn >= NDEF_LLCP_CONN_MAX)) {
+    return ERR_PARAM;
+  }
+
+  switch (llcp->conn[conn].state) {
+    case NDEF_LLCP_CONN_CLOSED:
+    case NDEF_LLCP_CONN_DISCONNECTING:
+    case NDEF_LLCP_CONN_REJECTING:
+      break;
+
+    case NDEF_LLCP_CONN_CONNECTING:
+      if (llcp->conn[conn].ctrlPending) {
+        /* CONNECT not sent yet */
+        ndefLlcpCloseConn(llcp, &llcp->conn[conn]);
+        break;
+      }
+      llcp->conn[conn].state       = NDEF_LLCP_CONN_DISCONNECTING;
+      llcp->conn[conn].ctrlPending = true;
+      break;
+
+    default:
+      llcp->conn[conn].state       = NDEF_LLCP_CONN_DISCONNECTING;
+      llcp->conn[conn].ctrlPending = true;
+      break;
+  }
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpDeactivate(ndefLlcp *llcp)
+{
+  if (llcp == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (llcp->state != NDEF_LLCP_LINK_ACTIVE) {
+    return ERR_WRONG_STATE;
+  }
+
+  llcp->discPending = true;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefLlcpGetStats(const ndefLlcp *llcp, ndefLlcpStats *stats)
+{
+  if ((llcp == NULL) || (stats == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMCPY(stats, &llcp->stats, sizeof(ndefLlcpStats));
+
+  return ERR_NONE;
+}
+
+#endif /* NDEF_FEATURE_LLCP */
@@ -0,0 +1,441 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_llcp.h
+  * @brief          : NFC Forum LLCP link layer over NFC-DEP header file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NDEF_LLCP_H
+#define NDEF_LLCP_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_poller.h"
+
+
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+
+#ifndef NDEF_FEATURE_LLCP
+  #define NDEF_FEATURE_LLCP   false   /* LLCP module configuration missing. Disabled by default */
+#endif
+
+
+#if NDEF_FEATURE_LLCP
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef NDEF_LLCP_CONN_MAX
+  #define NDEF_LLCP_CONN_MAX      2U      /*!< Maximum number of data link connections        */
+#endif
+
+#ifndef NDEF_LLCP_SERVICE_MAX
+  #define NDEF_LLCP_SERVICE_MAX   2U      /*!< Maximum number of registered services           */
+#endif
+
+#ifndef NDEF_LLCP_MIU
+  #define NDEF_LLCP_MIU           248U    /*!< Local MIU: largest information field received  */
+#endif
+
+#ifndef NDEF_LLCP_RW
+  #define NDEF_LLCP_RW            4U      /*!< Local receive window (1..15)                    */
+#endif
+
+#ifndef NDEF_LLCP_LTO
+  #define NDEF_LLCP_LTO           100U    /*!< Local link timeout (ms, multiple of 10)         */
+#endif
+
+#ifndef NDEF_LLCP_SYMM_DELAY
+  #define NDEF_LLCP_SYMM_DELAY    20U     /*!< Delay (ms) before answering a SYMM with a SYMM  */
+#endif
+
+#define NDEF_LLCP_MIU_DEFAULT     128U    /*!< Default MIU when no MIUX is exchanged           */
+#define NDEF_LLCP_GB_LEN          20U     /*!< Length of the General Bytes built by ndefLlcpGetGeneralBytes() */
+
+#define NDEF_LLCP_SAP_LINK        0x00U   /*!< LLC Link Management SAP                         */
+#define NDEF_LLCP_SAP_SDP         0x01U   /*!< Service Discovery Protocol SAP                  */
+#define NDEF_LLCP_SAP_SNEP        0x04U   /*!< SNEP default server SAP                         */
+
+#define NDEF_LLCP_CONN_INVALID    0xFFU   /*!< Invalid connection handle                       */
+
+#if ((NDEF_LLCP_MIU < NDEF_LLCP_MIU_DEFAULT) || ((NDEF_LLCP_MIU + 3U) > RFAL_FEATURE_NFC_DEP_PDU_MAX_LEN))
+  #error "NDEF_LLCP_MIU must be at least 128 and an I PDU must fit in an NFC-DEP PDU"
+#endif
+
+#if ((NDEF_LLCP_RW == 0U) || (NDEF_LLCP_RW > 15U))
+  #error "NDEF_LLCP_RW must be in the range 1..15"
+#endif
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*! LLCP link states */
+typedef enum {
+  NDEF_LLCP_LINK_IDLE,                  /*!< Not activated                                      */
+  NDEF_LLCP_LINK_ACTIVE,                /*!< Link activated, symmetry procedure running         */
+  NDEF_LLCP_LINK_DEACTIVATING,          /*!< Link deactivation (DISC on SAP 0) being sent       */
+  NDEF_LLCP_LINK_CLOSED                 /*!< Link deactivated or lost                           */
+} ndefLlcpLinkState;
+
+
+/*! LLCP data link connection states */
+typedef enum {
+  NDEF_LLCP_CONN_CLOSED,                /*!< Connection free                                    */
+  NDEF_LLCP_CONN_CONNECTING,            /*!< CONNECT to be sent or waiting for CC               */
+  NDEF_LLCP_CONN_ACCEPTING,             /*!< CONNECT received, CC to be sent                    */
+  NDEF_LLCP_CONN_CONNECTED,             /*!< Data link connection established                   */
+  NDEF_LLCP_CONN_DISCONNECTING,         /*!< DISC to be sent or waiting for DM                  */
+  NDEF_LLCP_CONN_REJECTING              /*!< FRMR to be sent, then closed                       */
+} ndefLlcpConnState;
+
+
+/*! LLCP connection callbacks, called from ndefLlcpWorker() */
+typedef struct {
+  void (*connected)(void *cbCtx, uint8_t conn);                                      /*!< Connection established               */
+  void (*received)(void *cbCtx, uint8_t conn, const uint8_t *data, uint16_t len);     /*!< I PDU information field received     */
+  void (*closed)(void *cbCtx, uint8_t conn);                                         /*!< Connection closed, refused or lost   */
+  void  *cbCtx;                                                                      /*!< Context passed to the callbacks      */
+} ndefLlcpCallbacks;
+
+
+/*! LLCP data link connection */
+typedef struct {
+  ndefLlcpConnState  state;             /*!< Connection state                                   */
+  uint8_t            lsap;              /*!< Local SAP                                          */
+  uint8_t            rsap;              /*!< Remote SAP                                         */
+  uint8_t            vs;                /*!< Send state variable V(S)                           */
+  uint8_t            vsa;               /*!< Send acknowledgement state variable V(SA)          */
+  uint8_t            vr;                /*!< Receive state variable V(R)                        */
+  uint8_t            vra;               /*!< Receive acknowledgement state variable V(RA)       */
+  uint8_t            rwr;               /*!< Remote receive window                              */
+  uint16_t           miur;              /*!< Remote MIU                                         */
+  bool               ctrlPending;       /*!< CONNECT, CC or DISC to be sent                     */
+  bool               remoteBusy;        /*!< Remote receiver busy (RNR received)                */
+  bool               localBusy;         /*!< Local receiver busy                                */
+  bool               busyReported;      /*!< Local busy state reported to the remote            */
+  uint8_t            frmrFlags;         /*!< FRMR flags W, I, R, S and type of the rejected PDU */
+  uint8_t            frmrSeq;           /*!< FRMR sequence field of the rejected PDU            */
+  const uint8_t     *txData;            /*!< Data to send                                       */
+  uint32_t           txLen;             /*!< Data length                                        */
+  uint32_t           txPos;             /*!< Data already sent                                  */
+  ndefLlcpCallbacks  cb;                /*!< Connection callbacks                               */
+} ndefLlcpConn;
+
+
+/*! LLCP registered service */
+typedef struct {
+  uint8_t            sap;               /*!< Service SAP                                        */
+  ndefConstBuffer    name;              /*!< Service name, e.g. "urn:nfc:sn:snep"               */
+  ndefLlcpCallbacks  cb;                /*!< Callbacks of the connections to the service        */
+} ndefLlcpService;
+
+
+/*! DM PDU to be sent */
+typedef struct {
+  uint8_t            dsap;              /*!< Destination SAP                                    */
+  uint8_t            ssap;              /*!< Source SAP                                         */
+  uint8_t            reason;            /*!< Disconnected mode reason                           */
+} ndefLlcpDm;
+
+
+/*! LLCP statistics */
+typedef struct {
+  uint32_t           txPdus;            /*!< PDUs sent, aggregated PDUs counted individually    */
+  uint32_t           rxPdus;            /*!< PDUs received, aggregated PDUs counted individually*/
+  uint32_t           symm;              /*!< SYMM PDUs sent                                     */
+  uint32_t           agf;               /*!< AGF PDUs sent                                      */
+  uint32_t           txBytes;           /*!< I PDU information bytes sent                       */
+  uint32_t           rxBytes;           /*!< I PDU information bytes received                   */
+  uint32_t           duration;          /*!< Time since activation (ms)                         */
+  uint32_t           kbps;              /*!< I PDU throughput, both directions (kbit/s)         */
+} ndefLlcpStats;
+
+
+/*! LLCP link context */
+typedef struct {
+  RfalNfcClass      *rfal_nfc;                        /*!< RFAL NFC instance                     */
+  ndefLlcpLinkState  state;                           /*!< Link state                            */
+  bool               initiator;                       /*!< NFC-DEP Initiator, Target otherwise   */
+  bool               txRxOngoing;                     /*!< NFC-DEP exchange in progress          */
+  bool               firstRx;                         /*!< Target waiting for the first PDU      */
+  bool               lastSymm;                        /*!< Last PDU received was a SYMM          */
+  bool               discPending;                     /*!< DISC on SAP 0 to be sent              */
+  uint8_t            version;                         /*!< Remote LLCP version                   */
+  uint16_t           miu;                             /*!< Remote link MIU                       */
+  uint16_t           wks;                             /*!< Remote well-known services            */
+  uint16_t           lto;                             /*!< Remote link timeout (ms)              */
+  uint8_t           *rxData;                          /*!< NFC-DEP receive buffer                */
+  uint16_t          *rxLen;                           /*!< NFC-DEP received length               */
+  uint32_t           rxTime;                          /*!< Time of the last reception (ms)       */
+  uint32_t           startTime;                       /*!< Time of the activation (ms)           */
+  ndefLlcpService    service[NDEF_LLCP_SERVICE_MAX];  /*!< Registered services                   */
+  uint8_t            serviceCount;                    /*!< Number of registered services         */
+  ndefLlcpConn       conn[NDEF_LLCP_CONN_MAX];        /*!< Data link connections                 */
+  ndefLlcpDm         dm[NDEF_LLCP_CONN_MAX];          /*!< DM PDUs to be sent                    */
+  uint8_t            dmCount;                         /*!< Number of DM PDUs to be sent          */
+  ndefLlcpStats      stats;                           /*!< Statistics                            */
+} ndefLlcp;
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize the LLCP link context
+ *
+ * \param[out] llcp:     LLCP link context
+ * \param[in]  rfal_nfc: RFAL NFC instance carrying the NFC-DEP link
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpInit(ndefLlcp *llcp, RfalNfcClass *rfal_nfc);
+
+
+/*!
+ *****************************************************************************
+ * Register a service
+ *
+ * Incoming CONNECT PDUs are accepted on the service SAP, or on the SDP SAP
+ * when their Service Name matches. Well-known services (SAP below 16) are
+ * advertised in the General Bytes, so register them before
+ * ndefLlcpGetGeneralBytes().
+ *
+ * \param[in,out] llcp: LLCP link context
+ * \param[in]     sap:  Service SAP (2..31)
+ * \param[in]     name: Service name, may be NULL. Must remain valid.
+ * \param[in]     cb:   Callbacks of the connections to the service
+ *
+ * \return ERR_NOMEM if NDEF_LLCP_SERVICE_MAX services are already registered
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpRegisterService(ndefLlcp *llcp, uint8_t sap, const ndefConstBuffer *name, const ndefLlcpCallbacks *cb);
+
+
+/*!
+ *****************************************************************************
+ * Build the LLCP General Bytes
+ *
+ * The General Bytes carry the LLCP magic number, version, MIU, well-known
+ * services, link timeout and option parameters. They are to be copied into
+ * rfalNfcDiscoverParam::GB before rfalNfcDiscover().
+ *
+ * \param[in]     llcp:  LLCP link context
+ * \param[out]    gb:    General Bytes buffer
+ * \param[in,out] gbLen: in: buffer length, out: General Bytes length
+ *
+ * \return ERR_NOMEM if the buffer is shorter than NDEF_LLCP_GB_LEN
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpGetGeneralBytes(const ndefLlcp *llcp, uint8_t *gb, uint8_t *gbLen);
+
+
+/*!
+ *****************************************************************************
+ * Activate the LLCP link
+ *
+ * Check the remote General Bytes and take the remote link parameters. The
+ * role (Initiator or Target) follows the NFC-DEP role of the device.
+ *
+ * \param[in,out] llcp: LLCP link context
+ * \param[in]     dev:  Device activated with the NFC-DEP interface
+ *
+ * \return ERR_PROTO if the remote General Bytes are not LLCP ones
+ * \return ERR_NOTSUPP if the remote LLCP major version is not supported
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpActivate(ndefLlcp *llcp, const ndefDevice *dev);
+
+
+/*!
+ *****************************************************************************
+ * Run the LLCP link
+ *
+ * Runs the symmetry procedure: each NFC-DEP exchange carries the pending
+ * PDUs, aggregated in an AGF PDU when more than one is pending, or a SYMM
+ * PDU. Received PDUs are dispatched to the connection callbacks.
+ * Must be called periodically while the link is up.
+ *
+ * \param[in,out] llcp: LLCP link context
+ *
+ * \return ERR_BUSY while the link is up
+ * \return ERR_NONE once the link is deactivated
+ * \return a standard error code on link loss or protocol error
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpWorker(ndefLlcp *llcp);
+
+
+/*!
+ *****************************************************************************
+ * Open a data link connection
+ *
+ * The CONNECT PDU is sent by ndefLlcpWorker(), the connected callback is
+ * called once the remote accepts, the closed callback if it refuses.
+ *
+ * \param[in,out] llcp: LLCP link context
+ * \param[in]     dsap: Remote service SAP
+ * \param[in]     cb:   Connection callbacks
+ * \param[out]    conn: Connection handle
+ *
+ * \return ERR_NOMEM if NDEF_LLCP_CONN_MAX connections are in use
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpConnect(ndefLlcp *llcp, uint8_t dsap, const ndefLlcpCallbacks *cb, uint8_t *conn);
+
+
+/*!
+ *****************************************************************************
+ * Send data on a connection
+ *
+ * The data is sent by ndefLlcpWorker() in I PDUs of up to the remote MIU,
+ * as many per exchange as the remote receive window allows. The data must
+ * remain valid until ndefLlcpGetSendStatus() no longer returns ERR_BUSY.
+ *
+ * \param[in,out] llcp: LLCP link context
+ * \param[in]     conn: Connection handle
+ * \param[in]     data: Data to send
+ * \param[in]     len:  Data length
+ *
+ * \return ERR_BUSY if previous data is still being sent
+ * \return ERR_WRONG_STATE if the connection is not established
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpSend(ndefLlcp *llcp, uint8_t conn, const uint8_t *data, uint32_t len);
+
+
+/*!
+ *****************************************************************************
+ * Get the status of the data being sent on a connection
+ *
+ * \param[in] llcp: LLCP link context
+ * \param[in] conn: Connection handle
+ *
+ * \return ERR_BUSY while data remains to be sent
+ * \return ERR_WRONG_STATE if the connection is not established
+ * \return ERR_NONE once all the data is sent
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpGetSendStatus(const ndefLlcp *llcp, uint8_t conn);
+
+
+/*!
+ *****************************************************************************
+ * Set the local receiver busy state of a connection
+ *
+ * While busy, the remote is told with RNR PDUs to stop sending I PDUs.
+ *
+ * \param[in,out] llcp: LLCP link context
+ * \param[in]     conn: Connection handle
+ * \param[in]     busy: true to stop the remote, false to resume
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpSetBusy(ndefLlcp *llcp, uint8_t conn, bool busy);
+
+
+/*!
+ *****************************************************************************
+ * Get the remote MIU of a connection
+ *
+ * \param[in] llcp: LLCP link context
+ * \param[in] conn: Connection handle
+ *
+ * \return remote MIU, 0 if the connection is not established
+ *****************************************************************************
+ */
+uint16_t ndefLlcpGetRemoteMiu(const ndefLlcp *llcp, uint8_t conn);
+
+
+/*!
+ *****************************************************************************
+ * Close a data link connection
+ *
+ * The DISC PDU is sent by ndefLlcpWorker(), the closed callback is called
+ * once the remote acknowledges.
+ *
+ * \param[in,out] llcp: LLCP link context
+ * \param[in]     conn: Connection handle
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpDisconnect(ndefLlcp *llcp, uint8_t conn);
+
+
+/*!
+ *****************************************************************************
+ * Deactivate the LLCP link
+ *
+ * A DISC PDU on SAP 0 is sent by ndefLlcpWorker(), which then returns
+ * ERR_NONE. The NFC-DEP link is to be released with rfalNfcDeactivate().
+ *
+ * \param[in,out] llcp: LLCP link context
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpDeactivate(ndefLlcp *llcp);
+
+
+/*!
+ *****************************************************************************
+ * Get the LLCP statistics
+ *
+ * \param[in]  llcp:  LLCP link context
+ * \param[out] stats: PDUs, aggregation, I PDU bytes and throughput
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefLlcpGetStats(const ndefLlcp *llcp, ndefLlcpStats *stats);
+
+
+#endif /* NDEF_FEATURE_LLCP */
+
+#endif /* NDEF_LLCP_H */
+
+/**
+  * @}
+  *
+  */
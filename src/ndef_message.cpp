@@ -33,7 +33,9 @@
  ******************************************************************************
  */
 
-#define NDEF_MAX_RECORD          10U    /*!< Maximum number of records */
+#ifndef NDEF_MAX_RECORD
+  #define NDEF_MAX_RECORD        10U    /*!< Maximum number of records */
+#endif
 
 /*
  ******************************************************************************
@@ -47,7 +49,7 @@
  * LOCAL VARIABLES
  ******************************************************************************
  */
-static uint8_t ndefRecordPoolIndex = 0;
+static uint32_t ndefRecordPoolIndex = 0;
 
 
 /*
@@ -85,8 +87,10 @@ ReturnCode ndefMessageInit(ndefMessage *message)
   }
 
   message->record           = NULL;
+  message->tail             = NULL;
   message->info.length      = 0;
   message->info.recordCount = 0;
+  message->lengthDirty      = false;
 
   ndefRecordPoolIndex = 0;
 
@@ -97,25 +101,31 @@ ReturnCode ndefMessageInit(ndefMessage *message)
 /*****************************************************************************/
 ReturnCode ndefMessageGetInfo(const ndefMessage *message, ndefMessageInfo *info)
 {
-  ndefRecord *record;
-  uint32_t    length      = 0;
-  uint32_t    recordCount = 0;
+  ndefMessage *cache;
+  ndefRecord  *record;
+  uint32_t     length = 0;
 
   if ((message == NULL) || (info == NULL)) {
     return ERR_PARAM;
   }
 
-  record = message->record;
+  if (message->lengthDirty) {
+    /* A record has changed since the length was computed: walk the records once and keep the result */
+    record = message->record;
 
-  while (record != NULL) {
-    length += ndefRecordGetLength(record);
-    recordCount++;
+    while (record != NULL) {
+      length += ndefRecordGetLength(record);
 
-    record = record->next;
+      record = record->next;
+    }
+
+    cache              = (ndefMessage *)message;
+    cache->info.length = length;
+    cache->lengthDirty = false;
   }
 
-  info->length      = length;
-  info->recordCount = recordCount;
+  info->length      = message->info.length;
+  info->recordCount = message->info.recordCount;
 
   return ERR_NONE;
 }
@@ -124,13 +134,11 @@ ReturnCode ndefMessageGetInfo(const ndefMessage *message, ndefMessageInfo *info)
 /*****************************************************************************/
 uint32_t ndefMessageGetRecordCount(const ndefMessage *message)
 {
-  ndefMessageInfo info;
-
-  if (ndefMessageGetInfo(message, &info) == ERR_NONE) {
-    return info.recordCount;
+  if (message == NULL) {
+    return 0;
   }
 
-  return 0;
+  return message->info.recordCount;
 }
 
 
@@ -155,21 +163,19 @@ ReturnCode ndefMessageAppend(ndefMessage *message, ndefRecord *record)
 
     message->record = record;
   } else {
-    ndefRecord *current = message->record;
-
-    /* Go through the list of records */
-    while (current->next != NULL) {
-      current = current->next;
-    }
-
     /* Clear the Message End bit to the record before the one being appended */
-    ndefHeaderClearME(current);
+    ndefHeaderClearME(message->tail);
 
     /* Append to the last record */
-    current->next = record;
+    message->tail->next = record;
   }
 
-  message->info.length      += ndefRecordGetLength(record);
+  message->tail   = record;
+  record->message = message;
+
+  if (!message->lengthDirty) {
+    message->info.length += ndefRecordGetLength(record);
+  }
   message->info.recordCount += 1U;
 
   return ERR_NONE;
@@ -217,14 +223,36 @@ ReturnCode ndefMessageDecode(const ndefConstBuffer *bufPayload, ndefMessage *mes
 
 
 #if NDEF_FEATURE_FULL_API
+/*****************************************************************************/
+ReturnCode ndefMessageEncodeSegments(const ndefMessage *message, ndefSegmentSink sink, void *sinkCtx)
+{
+  ReturnCode  err;
+  ndefRecord *record;
+
+  if ((message == NULL) || (sink == NULL)) {
+    return ERR_PARAM;
+  }
+
+  record = ndefMessageGetFirstRecord(message);
+  while (record != NULL) {
+    err = ndefRecordEncodeSegments(record, sink, sinkCtx);
+    if (err != ERR_NONE) {
+      return err;
+    }
+
+    record = ndefMessageGetNextRecord(record);
+  }
+
+  return ERR_NONE;
+}
+
+
 /*****************************************************************************/
 ReturnCode ndefMessageEncode(const ndefMessage *message, ndefBuffer *bufPayload)
 {
   ReturnCode      err;
   ndefMessageInfo info;
-  ndefRecord     *record;
-  uint32_t        offset;
-  uint32_t        remainingLength;
+  ndefBuffer      bufRemaining;
 
   if ((bufPayload == NULL) || (bufPayload->buffer == NULL)) {
     return ERR_PARAM;
@@ -236,27 +264,14 @@ ReturnCode ndefMessageEncode(const ndefMessage *message, ndefBuffer *bufPayload)
     return ERR_NOMEM;
   }
 
-  /* Get the first record */
-  record          = ndefMessageGetFirstRecord(message);
-  offset          = 0;
-  remainingLength = bufPayload->length;
-
-  while (record != NULL) {
-    ndefBuffer bufRecord;
-    bufRecord.buffer = &bufPayload->buffer[offset];
-    bufRecord.length = remainingLength;
-    err = ndefRecordEncode(record, &bufRecord);
-    if (err != ERR_NONE) {
-      bufPayload->length = info.length;
-      return err;
-    }
-    offset          += bufRecord.length;
-    remainingLength -= bufRecord.length;
-
-    record = ndefMessageGetNextRecord(record);
+  bufRemaining = *bufPayload;
+  err = ndefMessageEncodeSegments(message, ndefBufferSegmentSink, &bufRemaining);
+  if (err != ERR_NONE) {
+    bufPayload->length = info.length;
+    return err;
   }
 
-  bufPayload->length = offset;
+  bufPayload->length -= bufRemaining.length;
   return ERR_NONE;
 }
 #endif
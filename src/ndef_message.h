@@ -58,8 +58,10 @@ typedef struct {
 
 /*! NDEF message */
 struct ndefMessageStruct {
-  ndefRecord     *record; /*!< Pointer to a record */
-  ndefMessageInfo info;   /*!< Message information, e.g. length in bytes, record count */
+  ndefRecord     *record;      /*!< Pointer to a record */
+  ndefRecord     *tail;        /*!< Pointer to the last record */
+  ndefMessageInfo info;        /*!< Message information, maintained upon append */
+  bool            lengthDirty; /*!< A record has changed, info.length to be computed again */
 };
 
 
@@ -86,7 +88,12 @@ ReturnCode ndefMessageInit(ndefMessage *message);
  *****************************************************************************
  * Get NDEF message information
  *
- * Return the message information
+ * Return the message information. It is maintained upon append, the
+ * length is only computed again after a record of the message has been
+ * changed through ndefRecordSetType, ndefRecordSetId, ndefRecordSetPayload
+ * or ndefRecordSetNdefType.
+ * In case the content of a well-known type is modified after its record has
+ * been appended, ndefRecordSetNdefType() must be called again on the record.
  *
  * \param[in]  message to get info from
  * \param[out] info: e.g. message length in bytes, number of records
@@ -159,6 +166,24 @@ ReturnCode ndefMessageDecode(const ndefConstBuffer *bufPayload, ndefMessage *mes
   *****************************************************************************
   */
   ReturnCode ndefMessageEncode(const ndefMessage *message, ndefBuffer *bufPayload);
+
+
+  /*!
+  *****************************************************************************
+  * Encode an NDEF message as an ordered list of segments
+  *
+  * Walk the records once and hand every header, type, id and payload item
+  * to the sink, in order, without any intermediate message buffer.
+  * See ndefRecordEncodeSegments().
+  *
+  * \param[in] message: Message to convert
+  * \param[in] sink:    Function called for each segment
+  * \param[in] sinkCtx: Opaque context passed to the sink
+  *
+  * \return ERR_NONE if successful, the first error returned by the sink or a standard error code
+  *****************************************************************************
+  */
+  ReturnCode ndefMessageEncodeSegments(const ndefMessage *message, ndefSegmentSink sink, void *sinkCtx);
 #endif
 
 
@@ -23,12 +23,14 @@
  */
 
 #include "ndef_poller.h"
+#include "ndef_t1t.h"
 #include "ndef_t2t.h"
 #include "ndef_t3t.h"
 #include "ndef_t4t.h"
 #include "ndef_t5t_hal.h"
 #include "ndef_t5t.h"
 #include "nfc_utils.h"
+#include "ndef_class.h"
 
 /*
  ******************************************************************************
@@ -42,6 +44,12 @@
  ******************************************************************************
  */
 
+#define NDEF_POLLER_VERIFY_CHUNK_LEN  16U    /*!< Read back chunk length of the verify procedure */
+
+#define NDEF_POLLER_STEP_LEN           0U    /*!< Stepped operation: read or reset the length field */
+#define NDEF_POLLER_STEP_DATA          1U    /*!< Stepped operation: transfer a message chunk        */
+#define NDEF_POLLER_STEP_END           2U    /*!< Stepped operation: update the length field         */
+
 /*
  ******************************************************************************
  * GLOBAL TYPES
@@ -87,20 +95,20 @@ ReturnCode ndefPollerContextInitialization(ndefContext *ctx, const ndefDevice *d
 
 #if NDEF_FEATURE_T1T
   static const ndefPollerWrapper ndefT1TWrapper = {
-    NULL, /* ndefT1TPollerContextInitialization, */
-    NULL, /* ndefT1TPollerNdefDetect,            */
-    NULL, /* ndefT1TPollerReadBytes,             */
-    NULL, /* ndefT1TPollerReadRawMessage,        */
+    ndefT1TPollerContextInitialization,
+    ndefT1TPollerNdefDetect,
+    ndefT1TPollerReadBytes,
+    ndefT1TPollerReadRawMessage,
 #if NDEF_FEATURE_FULL_API
-    NULL, /* ndefT1TPollerWriteBytes,            */
-    NULL, /* ndefT1TPollerWriteRawMessage,       */
-    NULL, /* ndefT1TPollerTagFormat,             */
-    NULL, /* ndefT1TPollerWriteRawMessageLen     */
-    NULL, /* ndefT1TPollerCheckPresence          */
-    NULL, /* ndefT1TPollerCheckAvailableSpace    */
-    NULL, /* ndefT1TPollerBeginWriteMessage      */
-    NULL, /* ndefT1TPollerEndWriteMessage        */
-    NULL  /* ndefT1TPollerSetReadOnly            */
+    ndefT1TPollerWriteBytes,
+    ndefT1TPollerWriteRawMessage,
+    ndefT1TPollerTagFormat,
+    ndefT1TPollerWriteRawMessageLen,
+    ndefT1TPollerCheckPresence,
+    ndefT1TPollerCheckAvailableSpace,
+    ndefT1TPollerBeginWriteMessage,
+    ndefT1TPollerEndWriteMessage,
+    ndefT1TPollerSetReadOnly
 #endif /* NDEF_FEATURE_FULL_API */
   };
 #endif /* NDEF_FEATURE_T1T */
@@ -225,6 +233,7 @@ ReturnCode ndefPollerContextInitialization(ndefContext *ctx, const ndefDevice *d
   }
 
   ctx->ndefPollWrapper = ndefPollerWrappers[type];
+  ctx->op.type         = NDEF_POLLER_OP_NONE;
 
   /* ndefPollWrapper is NULL when support of a given tag type is not enabled */
   if ((ctx->ndefPollWrapper == NULL) || (ctx->ndefPollWrapper->pollerContextInitialization == NULL)) {
@@ -288,8 +297,358 @@ ReturnCode ndefPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len,
   return (ctx->ndefPollWrapper->pollerReadBytes)(ctx, offset, len, buf, rcvdLen);
 }
 
+/*******************************************************************************/
+static ReturnCode ndefPollerReadMessageBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+{
+#if NDEF_FEATURE_T1T
+  if (ctx->type == NDEF_DEV_T1T) {
+    /* T1T message offset skips the lock and reserved areas */
+    return ndefT1TPollerReadMessageBytes(ctx, offset, len, buf, rcvdLen);
+  }
+#endif
+#if NDEF_FEATURE_T2T
+  if (ctx->type == NDEF_DEV_T2T) {
+    /* T2T message offset skips the lock and reserved areas */
+    return ndefT2TPollerReadMessageBytes(ctx, offset, len, buf, rcvdLen);
+  }
+#endif
+
+  return ndefPollerReadBytes(ctx, offset, len, buf, rcvdLen);
+}
+
+/*!
+ *****************************************************************************
+ * \brief Length of the next message chunk
+ *
+ * Chunks end on NDEF_POLLER_CHUNK_LEN boundaries of the storage area so that
+ * they end on a block boundary whatever the message offset.
+ *****************************************************************************
+ */
+static uint32_t ndefPollerOpChunkLen(const ndefContext *ctx)
+{
+  uint32_t len;
+
+  len = NDEF_POLLER_CHUNK_LEN - ((ctx->messageOffset + ctx->op.pos) % NDEF_POLLER_CHUNK_LEN);
+
+  return MIN(len, ctx->op.bufLen - ctx->op.pos);
+}
+
+/*!
+ *****************************************************************************
+ * \brief Run one step of the raw message read
+ *****************************************************************************
+ */
+static ReturnCode ndefPollerOpRead(ndefContext *ctx)
+{
+  ReturnCode ret;
+  uint32_t   len;
+  uint32_t   rcvdLen;
+
+  if (ctx->op.step == NDEF_POLLER_STEP_LEN) {
+    if (!ctx->op.single) {
+      /* Read the length field only: with a zero length buffer, the read
+       * procedure stops once the length is known */
+      ret = ndefPollerReadRawMessage(ctx, ctx->op.rxBuf, 0, &rcvdLen, false);
+      if ((ret != ERR_NONE) && (ret != ERR_NOMEM) && (ret != ERR_WRONG_STATE)) {
+        return ret;
+      }
+    }
+    if (ctx->state <= NDEF_STATE_INITIALIZED) {
+      return ERR_WRONG_STATE;
+    }
+    if (ctx->messageLen > ctx->op.bufLen) {
+      return ERR_NOMEM;
+    }
+    ctx->op.bufLen = ctx->messageLen;
+    ctx->op.step   = NDEF_POLLER_STEP_DATA;
+    return ERR_BUSY;
+  }
+
+  len = ndefPollerOpChunkLen(ctx);
+  ret = ndefPollerReadMessageBytes(ctx, ctx->messageOffset + ctx->op.pos, len, &ctx->op.rxBuf[ctx->op.pos], &rcvdLen);
+  if ((ret == ERR_NONE) && (rcvdLen != len)) {
+    ret = ERR_PROTO;
+  }
+  if (ret != ERR_NONE) {
+    ctx->state = NDEF_STATE_INVALID;
+    return ret;
+  }
+
+  ctx->op.pos      += len;
+  *ctx->op.rcvdLen  = ctx->op.pos;
+
+  return (ctx->op.pos < ctx->op.bufLen) ? ERR_BUSY : ERR_NONE;
+}
+
+#if NDEF_FEATURE_FULL_API
+/*!
+ *****************************************************************************
+ * \brief Run one step of the raw message write
+ *
+ * Same sequence as the tag type WriteRawMessage procedures: reset the
+ * length field, write the message (padding its last block and adding the
+ * Terminator TLV as they do) and update the length field.
+ *****************************************************************************
+ */
+static ReturnCode ndefPollerOpWrite(ndefContext *ctx)
+{
+  ReturnCode ret;
+  uint32_t   len;
+  bool       last;
+  bool       pad;
+  bool       writeTerminator;
+
+  switch (ctx->op.step) {
+    case NDEF_POLLER_STEP_LEN:
+      if ((ctx->state != NDEF_STATE_INITIALIZED) && (ctx->state != NDEF_STATE_READWRITE)) {
+        return ERR_WRONG_STATE;
+      }
+      if (ndefPollerCheckAvailableSpace(ctx, ctx->op.bufLen) != ERR_NONE) {
+        return ERR_PARAM;
+      }
+      ret = ndefPollerBeginWriteMessage(ctx, ctx->op.bufLen);
+      if (ret != ERR_NONE) {
+        ctx->state = NDEF_STATE_INVALID;
+        return ret;
+      }
+      if (ctx->op.bufLen != 0U) {
+        ctx->op.step = NDEF_POLLER_STEP_DATA;
+      } else {
+        /* Only T3T has to clear the WriteFlag of an empty message */
+        ctx->op.step = NDEF_POLLER_STEP_END;
+        if (ctx->type != NDEF_DEV_T3T) {
+          return ERR_NONE;
+        }
+      }
+      return ERR_BUSY;
+
+    case NDEF_POLLER_STEP_DATA:
+      len             = ndefPollerOpChunkLen(ctx);
+      last            = ((ctx->op.pos + len) == ctx->op.bufLen);
+      pad             = (last && (ctx->type != NDEF_DEV_T4T));
+      writeTerminator = (last && ((ctx->type == NDEF_DEV_T1T) || (ctx->type == NDEF_DEV_T2T) || (ctx->type == NDEF_DEV_T5T)) && (ndefPollerCheckAvailableSpace(ctx, ctx->op.bufLen + 1U) == ERR_NONE));
+#if NDEF_FEATURE_T1T
+      if (ctx->type == NDEF_DEV_T1T) {
+        /* T1T message offset skips the lock and reserved areas */
+        ret = ndefT1TPollerWriteMessageBytes(ctx, ctx->messageOffset + ctx->op.pos, &ctx->op.txBuf[ctx->op.pos], len, pad, writeTerminator);
+      } else
+#endif
+#if NDEF_FEATURE_T2T
+      if (ctx->type == NDEF_DEV_T2T) {
+        /* T2T message offset skips the lock and reserved areas */
+        ret = ndefT2TPollerWriteMessageBytes(ctx, ctx->messageOffset + ctx->op.pos, &ctx->op.txBuf[ctx->op.pos], len, pad, writeTerminator);
+      } else
+#endif
+      {
+        ret = (ctx->ndefPollWrapper->pollerWriteBytes)(ctx, ctx->messageOffset + ctx->op.pos, &ctx->op.txBuf[ctx->op.pos], len, pad, writeTerminator);
+      }
+      if (ret != ERR_NONE) {
+        ctx->state = NDEF_STATE_INVALID;
+        return ret;
+      }
+      ctx->op.pos += len;
+      if (last) {
+        ctx->op.step = NDEF_POLLER_STEP_END;
+      }
+      return ERR_BUSY;
+
+    case NDEF_POLLER_STEP_END:
+      ret = (ctx->ndefPollWrapper->pollerEndWriteMessage)(ctx, ctx->op.bufLen, false);
+      if (ret != ERR_NONE) {
+        ctx->state = NDEF_STATE_INVALID;
+      }
+      return ret;
+
+    default:
+      return ERR_INTERNAL;
+  }
+}
+#endif /* NDEF_FEATURE_FULL_API */
+
+/*!
+ *****************************************************************************
+ * \brief Run one step of the stepped operation
+ *
+ * The step itself is made of blocking RF commands. Detect and Format are
+ * run as a single step.
+ *
+ * \return ERR_BUSY while the operation is ongoing, its result otherwise
+ *****************************************************************************
+ */
+static ReturnCode ndefPollerOpWorker(ndefContext *ctx, ndefPollerOpType type)
+{
+  ReturnCode ret;
+
+  if (ctx == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (ctx->op.type != type) {
+    return ERR_WRONG_STATE;
+  }
+
+  RfalNfcClass *rfal_nfc = ((NdefClass *)(ctx->ndef_class_instance))->rfal_nfc;
+
+  /* rfalNfcWorker() may have started a presence probe between two steps */
+  rfal_nfc->rfalNfcPresenceComplete();
+
+  switch (type) {
+    case NDEF_POLLER_OP_DETECT:
+      ret = ndefPollerNdefDetect(ctx, ctx->op.info);
+      break;
+
+    case NDEF_POLLER_OP_READ:
+      ret = ndefPollerOpRead(ctx);
+      break;
+
+#if NDEF_FEATURE_FULL_API
+    case NDEF_POLLER_OP_WRITE:
+      ret = ndefPollerOpWrite(ctx);
+      break;
+
+    case NDEF_POLLER_OP_FORMAT:
+      ret = ndefPollerTagFormat(ctx, ctx->op.cc, ctx->op.options);
+      break;
+#endif /* NDEF_FEATURE_FULL_API */
+
+    default:
+      ret = ERR_INTERNAL;
+      break;
+  }
+
+  if (ret != ERR_BUSY) {
+    ctx->op.type = NDEF_POLLER_OP_NONE;
+  }
+
+  return ret;
+}
+
+/*!
+ *****************************************************************************
+ * \brief Start a stepped operation
+ *****************************************************************************
+ */
+static ReturnCode ndefPollerOpStart(ndefContext *ctx, ndefPollerOpType type)
+{
+  if (ctx->ndefPollWrapper == NULL) {
+    return ERR_WRONG_STATE;
+  }
+
+  (void)ST_MEMSET(&ctx->op, 0, sizeof(ndefPollerOp));
+  ctx->op.type = type;
+  ctx->op.step = NDEF_POLLER_STEP_LEN;
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerStartNdefDetect(ndefContext *ctx, ndefInfo *info)
+{
+  ReturnCode ret;
+
+  if (ctx == NULL) {
+    return ERR_PARAM;
+  }
+
+  ret = ndefPollerOpStart(ctx, NDEF_POLLER_OP_DETECT);
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+  ctx->op.info = info;
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerGetNdefDetectStatus(ndefContext *ctx)
+{
+  return ndefPollerOpWorker(ctx, NDEF_POLLER_OP_DETECT);
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerStartReadRawMessage(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen, bool single)
+{
+  ReturnCode ret;
+
+  if ((ctx == NULL) || (buf == NULL) || (rcvdLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  ret = ndefPollerOpStart(ctx, NDEF_POLLER_OP_READ);
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+  ctx->op.rxBuf   = buf;
+  ctx->op.bufLen  = bufLen;
+  ctx->op.rcvdLen = rcvdLen;
+  ctx->op.single  = single;
+  *rcvdLen        = 0;
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerGetReadRawMessageStatus(ndefContext *ctx)
+{
+  return ndefPollerOpWorker(ctx, NDEF_POLLER_OP_READ);
+}
+
 #if NDEF_FEATURE_FULL_API
 
+/*******************************************************************************/
+ReturnCode ndefPollerStartWriteRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen)
+{
+  ReturnCode ret;
+
+  if ((ctx == NULL) || ((buf == NULL) && (bufLen != 0U))) {
+    return ERR_PARAM;
+  }
+
+  if ((ctx->ndefPollWrapper != NULL) && ((ctx->ndefPollWrapper->pollerWriteBytes == NULL) || (ctx->ndefPollWrapper->pollerEndWriteMessage == NULL))) {
+    return ERR_NOTSUPP;
+  }
+
+  ret = ndefPollerOpStart(ctx, NDEF_POLLER_OP_WRITE);
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+  ctx->op.txBuf  = buf;
+  ctx->op.bufLen = bufLen;
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerGetWriteRawMessageStatus(ndefContext *ctx)
+{
+  return ndefPollerOpWorker(ctx, NDEF_POLLER_OP_WRITE);
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerStartTagFormat(ndefContext *ctx, const ndefCapabilityContainer *cc, uint32_t options)
+{
+  ReturnCode ret;
+
+  if (ctx == NULL) {
+    return ERR_PARAM;
+  }
+
+  ret = ndefPollerOpStart(ctx, NDEF_POLLER_OP_FORMAT);
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+  ctx->op.cc      = cc;
+  ctx->op.options = options;
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerGetTagFormatStatus(ndefContext *ctx)
+{
+  return ndefPollerOpWorker(ctx, NDEF_POLLER_OP_FORMAT);
+}
+
 /*******************************************************************************/
 ReturnCode ndefPollerWriteRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen)
 {
@@ -452,4 +811,60 @@ ReturnCode ndefPollerSetReadOnly(ndefContext *ctx)
   return (ctx->ndefPollWrapper->pollerSetReadOnly)(ctx);
 }
 
+/*******************************************************************************/
+ReturnCode ndefPollerVerifyRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen, ndefVerifyMode mode)
+{
+  ReturnCode ret;
+  uint8_t    rxBuf[NDEF_POLLER_VERIFY_CHUNK_LEN];
+  uint32_t   offset;
+  uint32_t   len;
+  uint32_t   rcvdLen;
+
+  if ((ctx == NULL) || ((buf == NULL) && (bufLen != 0U))) {
+    return ERR_PARAM;
+  }
+
+  /* Read back the length field only: with a zero length buffer, the non-single
+   * read procedure stops once the length is known */
+  ret = ndefPollerReadRawMessage(ctx, rxBuf, 0, &rcvdLen, false);
+  if ((ret != ERR_NONE) && (ret != ERR_NOMEM) && (ret != ERR_WRONG_STATE)) {
+    return ret;
+  }
+  /* ERR_WRONG_STATE reports an empty message, checked against bufLen too */
+  if ((ctx->state == NDEF_STATE_INVALID) || (ctx->messageLen != bufLen)) {
+    return ERR_PROTO;
+  }
+
+  /* The window is aligned on NDEF_POLLER_VERIFY_CHUNK_LEN so that block based tags (e.g. T3T) read
+   * whole blocks, the last chunk being the unaligned tail of the message, if any */
+  offset = (mode == NDEF_VERIFY_FULL) ? 0U : (bufLen - MIN(bufLen, NDEF_POLLER_VERIFY_CHUNK_LEN));
+  offset = (offset / NDEF_POLLER_VERIFY_CHUNK_LEN) * NDEF_POLLER_VERIFY_CHUNK_LEN;
+  while (offset < bufLen) {
+    len = MIN(bufLen - offset, NDEF_POLLER_VERIFY_CHUNK_LEN);
+    ret = ndefPollerReadMessageBytes(ctx, ctx->messageOffset + offset, len, rxBuf, &rcvdLen);
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+    if ((rcvdLen != len) || (ST_BYTECMP(rxBuf, &buf[offset], len) != 0)) {
+      return ERR_PROTO;
+    }
+    offset += len;
+  }
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefPollerWriteRawMessageVerify(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen, ndefVerifyMode mode)
+{
+  ReturnCode ret;
+
+  ret = ndefPollerWriteRawMessage(ctx, buf, bufLen);
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  return ndefPollerVerifyRawMessage(ctx, buf, bufLen, mode);
+}
+
 #endif /* NDEF_FEATURE_FULL_API */
@@ -44,6 +44,8 @@
 #define NDEF_TERMINATOR_TLV_LEN      1U                                                /*!< Terminator TLV size                                          */
 #define NDEF_TERMINATOR_TLV_T     0xFEU                                                /*!< Terminator TLV T=FEh                                         */
 
+#define NDEF_T1T_MAX_RSVD_AREAS      3U                                                /*!< Number of reserved areas including 1 Dyn Lock area           */
+
 #define NDEF_T2T_READ_RESP_SIZE     16U                                                /*!< Size of the READ response i.e. four blocks                   */
 #define NDEF_T2T_MAX_RSVD_AREAS      3U                                                /*!< Number of reserved areas including 1 Dyn Lock area           */
 
@@ -60,6 +62,10 @@
 #define NDEF_T5T_TxRx_BUFF_SIZE               \
           (32U +  NDEF_T5T_TxRx_BUFF_HEADER_SIZE + NDEF_T5T_TxRx_BUFF_FOOTER_SIZE)     /*!< T5T working buffer size                                      */
 
+#ifndef NDEF_POLLER_CHUNK_LEN
+  #define NDEF_POLLER_CHUNK_LEN              64U                                       /*!< Bytes transferred per step of the stepped read/write        */
+#endif
+
 /*
  ******************************************************************************
  * GLOBAL MACROS
@@ -97,6 +103,12 @@ typedef enum {
   NDEF_STATE_READONLY    = 0x03U,                            /*!< Valid NDEF found. Read only                        */
 } ndefState;
 
+/*! NDEF verify modes */
+typedef enum {
+  NDEF_VERIFY_LAST       = 0x00U,                            /*!< Check the length field and the last bytes written  */
+  NDEF_VERIFY_FULL       = 0x01U,                            /*!< Check the length field and every byte written      */
+} ndefVerifyMode;
+
 /*! NDEF Information */
 typedef struct {
   uint8_t                  majorVersion;                     /*!< Major version                                      */
@@ -198,7 +210,17 @@ typedef union {
 #if NDEF_FEATURE_T1T
 /*! NDEF T1T sub context structure */
 typedef struct {
-  void *rfu;                                                 /*!< RFU                                                */
+  uint8_t                      uid[RFAL_T1T_UID_LEN];                          /*!< UID                                            */
+  uint8_t                      hr0;                                            /*!< Header ROM HR0                                 */
+  bool                         dynamicMemory;                                  /*!< Dynamic memory tag (RSEG/READ8/WRITE-E8)       */
+  uint8_t                      cacheBuf[RFAL_T1T_SEGMENT_LEN];                 /*!< Cache buffer: one segment or the static memory */
+  uint8_t                      nbrRsvdAreas;                                   /*!< Number of reserved Areas                       */
+  uint16_t                     dynLockNbrLockBits;                             /*!< Number of bits inside the DynLock_Area         */
+  uint16_t                     rsvdAreaSize[NDEF_T1T_MAX_RSVD_AREAS];          /*!< Sizes of reserved areas                        */
+  uint32_t                     cacheAddr;                                      /*!< Address of cached data                         */
+  uint32_t                     offsetNdefTLV;                                  /*!< NDEF TLV message offset                        */
+  uint32_t                     dynLockFirstByteAddr;                           /*!< Address of the first byte of the DynLock_Area  */
+  uint32_t                     rsvdAreaFirstByteAddr[NDEF_T1T_MAX_RSVD_AREAS]; /*!< Addresses of reserved areas                    */
 } ndefT1TContext;
 #endif
 
@@ -277,6 +299,30 @@ typedef struct {
 } ndefT5TContext;
 #endif
 
+/*! NDEF stepped operations */
+typedef enum {
+  NDEF_POLLER_OP_NONE    = 0x00U,                            /*!< No operation in progress                           */
+  NDEF_POLLER_OP_DETECT  = 0x01U,                            /*!< NDEF Detection procedure                           */
+  NDEF_POLLER_OP_READ    = 0x02U,                            /*!< Read raw message                                   */
+  NDEF_POLLER_OP_WRITE   = 0x03U,                            /*!< Write raw message                                  */
+  NDEF_POLLER_OP_FORMAT  = 0x04U,                            /*!< Tag format                                         */
+} ndefPollerOpType;
+
+/*! NDEF stepped operation context */
+typedef struct {
+  ndefPollerOpType               type;                       /*!< Operation in progress                              */
+  uint8_t                        step;                       /*!< Current step of the operation                      */
+  uint8_t                       *rxBuf;                      /*!< Read buffer                                        */
+  const uint8_t                 *txBuf;                      /*!< Message to write                                   */
+  uint32_t                       bufLen;                     /*!< Read buffer length or message length               */
+  uint32_t                      *rcvdLen;                    /*!< Received length                                    */
+  uint32_t                       pos;                        /*!< Bytes of the message transferred so far            */
+  bool                           single;                     /*!< Read right after NDEF Detect                       */
+  ndefInfo                      *info;                       /*!< NDEF Information of the NDEF Detect                */
+  const ndefCapabilityContainer *cc;                         /*!< Capability Container of the Tag Format             */
+  uint32_t                       options;                    /*!< Options of the Tag Format                          */
+} ndefPollerOp;
+
 /*! NDEF context structure */
 typedef struct {
   ndefDeviceType               type;                         /*!< NDEF Device type                                   */
@@ -307,6 +353,8 @@ typedef struct {
 #endif
   } subCtx;                                                  /*!< Sub-context union                                  */
 
+  ndefPollerOp                 op;                           /*!< Stepped operation in progress                     */
+
   void                        *ndef_class_instance;
 } ndefContext;
 
@@ -624,6 +672,201 @@ ReturnCode ndefPollerEndWriteMessage(ndefContext *ctx, uint32_t messageLen);
 ReturnCode ndefPollerSetReadOnly(ndefContext *ctx);
 
 
+/*!
+ *****************************************************************************
+ * \brief Verify a written raw NDEF message
+ *
+ * This method checks a raw NDEF message just written. The length field is
+ * read back with the cheapest procedure of the tag type (L-field for
+ * T2T/T5T, NLEN for T4T, Attribute Information Block for T3T), then either
+ * the last bytes of the message (NDEF_VERIFY_LAST) or the whole message
+ * (NDEF_VERIFY_FULL) are read back and compared, NDEF_POLLER_VERIFY_CHUNK_LEN
+ * bytes at a time. With NDEF_VERIFY_LAST the window starts on a chunk
+ * boundary, so the last full chunk and the unaligned tail, if any, are read.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   buf    : raw message buffer that was written
+ * \param[in]   bufLen : raw message length
+ * \param[in]   mode   : NDEF_VERIFY_LAST or NDEF_VERIFY_FULL
+ *
+ * \return ERR_WRONG_STATE  : Library not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Length or content mismatch
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefPollerVerifyRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen, ndefVerifyMode mode);
+
+
+/*!
+ *****************************************************************************
+ * \brief Write and verify raw NDEF message
+ *
+ * This method writes a raw NDEF message and verifies it with
+ * ndefPollerVerifyRawMessage()
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   buf    : raw message buffer
+ * \param[in]   bufLen : buffer length
+ * \param[in]   mode   : NDEF_VERIFY_LAST or NDEF_VERIFY_FULL
+ *
+ * \return ERR_WRONG_STATE  : Library not initialized or mode not set
+ * \return ERR_REQUEST      : write or read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error, length or content mismatch
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefPollerWriteRawMessageVerify(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen, ndefVerifyMode mode);
+
+
+/*!
+ *****************************************************************************
+ * \brief Start NDEF Detection procedure
+ *
+ * This method prepares the NDEF Detection procedure. The whole procedure
+ * is then run, blocking, by the next call to ndefPollerGetNdefDetectStatus():
+ * it is not split into steps.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[out]  info   : ndef Information (optional parameter, NULL may be used when no NDEF Information is needed)
+ *
+ * \return ERR_WRONG_STATE  : Library not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NONE         : Procedure started
+ *****************************************************************************
+ */
+ReturnCode ndefPollerStartNdefDetect(ndefContext *ctx, ndefInfo *info);
+
+
+/*!
+ *****************************************************************************
+ * \brief Get NDEF Detection procedure status
+ *
+ * \param[in]   ctx    : ndef Context
+ *
+ * \return ERR_WRONG_STATE  : Procedure not started
+ * \return ERR_XXXX         : Result of ndefPollerNdefDetect()
+ *****************************************************************************
+ */
+ReturnCode ndefPollerGetNdefDetectStatus(ndefContext *ctx);
+
+
+/*!
+ *****************************************************************************
+ * \brief Start reading a raw NDEF message
+ *
+ * This method starts the stepped read of a raw NDEF message. Each call to
+ * ndefPollerGetReadRawMessageStatus() reads the length field or up to
+ * NDEF_POLLER_CHUNK_LEN bytes of the message, so that the application can
+ * service other tasks between the steps of a long read.
+ * Each step is made of blocking RF commands: a call lasts as long as the
+ * commands reading its chunk (e.g. 4 T2T READ commands with the default
+ * chunk length). A presence probe left pending by rfalNfcWorker() is
+ * completed first.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[out]  buf    : raw message buffer
+ * \param[in]   bufLen : raw message buffer length
+ * \param[out]  rcvdLen: number of bytes received so far
+ * \param[in]   single : performed right after NDEF Detect: the length field is not read again
+ *
+ * \return ERR_WRONG_STATE  : Library not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NONE         : Procedure started
+ *****************************************************************************
+ */
+ReturnCode ndefPollerStartReadRawMessage(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen, bool single);
+
+
+/*!
+ *****************************************************************************
+ * \brief Get raw NDEF message read status
+ *
+ * \param[in]   ctx    : ndef Context
+ *
+ * \return ERR_BUSY         : Read ongoing
+ * \return ERR_WRONG_STATE  : Read not started or no NDEF message
+ * \return ERR_NOMEM        : Message longer than the buffer
+ * \return ERR_NONE         : Message read
+ *****************************************************************************
+ */
+ReturnCode ndefPollerGetReadRawMessageStatus(ndefContext *ctx);
+
+
+/*!
+ *****************************************************************************
+ * \brief Start writing a raw NDEF message
+ *
+ * This method starts the stepped write of a raw NDEF message. Each call to
+ * ndefPollerGetWriteRawMessageStatus() performs one step of the write
+ * procedure: length field reset, up to NDEF_POLLER_CHUNK_LEN bytes of the
+ * message, length field update. Message chunks are aligned on
+ * NDEF_POLLER_CHUNK_LEN so that no block is read back before being written.
+ * As for the read, each step is made of blocking RF commands and a pending
+ * presence probe is completed first.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   buf    : raw message buffer, kept until the write completes
+ * \param[in]   bufLen : raw message length
+ *
+ * \return ERR_WRONG_STATE  : Library not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NONE         : Procedure started
+ *****************************************************************************
+ */
+ReturnCode ndefPollerStartWriteRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief Get raw NDEF message write status
+ *
+ * \param[in]   ctx    : ndef Context
+ *
+ * \return ERR_BUSY         : Write ongoing
+ * \return ERR_WRONG_STATE  : Write not started or tag not writable
+ * \return ERR_PARAM        : Not enough space
+ * \return ERR_NONE         : Message written
+ *****************************************************************************
+ */
+ReturnCode ndefPollerGetWriteRawMessageStatus(ndefContext *ctx);
+
+
+/*!
+ *****************************************************************************
+ * \brief Start Tag Format
+ *
+ * This method prepares the Tag Format procedure. The whole procedure is
+ * then run, blocking, by the next call to ndefPollerGetTagFormatStatus():
+ * it is not split into steps.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   cc     : pointer to a capability container, kept until the format completes
+ * \param[in]   options: specific flags
+ *
+ * \return ERR_WRONG_STATE  : Library not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NONE         : Procedure started
+ *****************************************************************************
+ */
+ReturnCode ndefPollerStartTagFormat(ndefContext *ctx, const ndefCapabilityContainer *cc, uint32_t options);
+
+
+/*!
+ *****************************************************************************
+ * \brief Get Tag Format status
+ *
+ * \param[in]   ctx    : ndef Context
+ *
+ * \return ERR_WRONG_STATE  : Procedure not started
+ * \return ERR_XXXX         : Result of ndefPollerTagFormat()
+ *****************************************************************************
+ */
+ReturnCode ndefPollerGetTagFormatStatus(ndefContext *ctx);
+
+
 
 #endif /* NDEF_POLLER_H */
 
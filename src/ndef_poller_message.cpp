@@ -23,6 +23,8 @@
  */
 
 #include "ndef_poller.h"
+#include "rfal_t2t.h"
+#include "nfc_utils.h"
 
 /*
  ******************************************************************************
@@ -36,6 +38,8 @@
  ******************************************************************************
  */
 
+#define NDEF_POLLER_SINK_BUF_LEN    32U  /*!< Write staging buffer length, largest T5T block length */
+
 /*
  ******************************************************************************
  * GLOBAL TYPES
@@ -75,67 +79,132 @@
 
 #if NDEF_FEATURE_FULL_API
 
-/*******************************************************************************/
-static ReturnCode ndefPollerWriteRecord(ndefContext *ctx, const ndefRecord *record, uint32_t *recordOffset)
+/*! Context of the segment sink writing to the tag */
+typedef struct {
+  ndefContext *ctx;                           /*!< NDEF context of the tag               */
+  uint32_t     offset;                        /*!< Tag offset of the staged bytes        */
+  uint32_t     blockLen;                      /*!< Tag block length                      */
+  uint32_t     stagedLen;                     /*!< Number of staged bytes                */
+  uint8_t      buf[NDEF_POLLER_SINK_BUF_LEN]; /*!< Staging buffer                        */
+} ndefPollerSinkCtx;
+
+
+/*!
+ *****************************************************************************
+ * \brief Get the write block length of the tag
+ *
+ * Return the length the tag is written by, so that the segments are only
+ * written as whole aligned blocks. Tags without blocks, i.e. T4T, use the
+ * staging buffer length.
+ *****************************************************************************
+ */
+static uint32_t ndefPollerSinkBlockLen(const ndefContext *ctx)
 {
-  ReturnCode      err;
-  uint8_t         recordHeaderBuf[NDEF_RECORD_HEADER_LEN];
-  ndefBuffer      bufHeader;
-  ndefConstBuffer bufPayloadItem;
-  uint32_t        offset;
-  bool            firstPayloadItem;
+  uint32_t blockLen;
+
+  switch (ctx->type) {
+#if NDEF_FEATURE_T1T
+    case NDEF_DEV_T1T:
+      blockLen = RFAL_T1T_BLOCK_LEN;
+      break;
+#endif
+#if NDEF_FEATURE_T2T
+    case NDEF_DEV_T2T:
+      blockLen = RFAL_T2T_BLOCK_LEN;
+      break;
+#endif
+#if NDEF_FEATURE_T3T
+    case NDEF_DEV_T3T:
+      blockLen = NDEF_T3T_BLOCK_SIZE;
+      break;
+#endif
+#if NDEF_FEATURE_T5T
+    case NDEF_DEV_T5T:
+      blockLen = ctx->subCtx.t5t.blockLen;
+      break;
+#endif
+    default:
+      blockLen = NDEF_POLLER_SINK_BUF_LEN;
+      break;
+  }
 
-  if ((ctx == NULL) || (record == NULL) || (recordOffset == NULL)) {
-    return ERR_PARAM;
+  if ((blockLen == 0U) || (blockLen > NDEF_POLLER_SINK_BUF_LEN)) {
+    blockLen = NDEF_POLLER_SINK_BUF_LEN;
   }
 
-  offset = *recordOffset;
+  return blockLen;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Write the staged bytes to the tag
+ *****************************************************************************
+ */
+static ReturnCode ndefPollerSinkFlush(ndefPollerSinkCtx *sink)
+{
+  ReturnCode err;
+
+  if (sink->stagedLen == 0U) {
+    return ERR_NONE;
+  }
 
-  bufHeader.buffer = recordHeaderBuf;
-  bufHeader.length = sizeof(recordHeaderBuf);
-  (void)ndefRecordEncodeHeader(record, &bufHeader);
-  err = ndefPollerWriteBytes(ctx, offset, bufHeader.buffer, bufHeader.length);
+  err = ndefPollerWriteBytes(sink->ctx, sink->offset, sink->buf, sink->stagedLen);
   if (err != ERR_NONE) {
-    /* Conclude procedure */
     return err;
   }
-  offset += bufHeader.length;
+  sink->offset   += sink->stagedLen;
+  sink->stagedLen = 0U;
 
-  ndefConstBuffer8 bufType;
-  ndefRecordGetType(record, NULL, &bufType);
-  if (bufType.length != 0U) {
-    err = ndefPollerWriteBytes(ctx, offset, bufType.buffer, bufType.length);
-    if (err != ERR_NONE) {
-      /* Conclude procedure */
-      return err;
-    }
-    offset += record->typeLength;
-  }
+  return ERR_NONE;
+}
 
-  ndefConstBuffer8 bufId;
-  ndefRecordGetId(record, &bufId);
-  if (bufId.length != 0U) {
-    err = ndefPollerWriteBytes(ctx, offset, bufId.buffer, bufId.length);
-    if (err != ERR_NONE) {
-      /* Conclude procedure */
-      return err;
-    }
-    offset += record->idLength;
-  }
-  if (ndefRecordGetPayloadLength(record) != 0U) {
-    firstPayloadItem = true;
-    while (ndefRecordGetPayloadItem(record, &bufPayloadItem, firstPayloadItem) != NULL) {
-      firstPayloadItem = false;
-      err = ndefPollerWriteBytes(ctx, offset, bufPayloadItem.buffer, bufPayloadItem.length);
+
+/*!
+ *****************************************************************************
+ * \brief Segment sink writing to the tag
+ *
+ * Segments are staged up to the end of a tag block, only whole aligned
+ * blocks are written. Aligned parts of long segments are written directly.
+ * The final tail is written by ndefPollerSinkFlush().
+ *****************************************************************************
+ */
+static ReturnCode ndefPollerSegmentSink(void *sinkCtx, const uint8_t *buf, uint32_t len)
+{
+  ReturnCode         err;
+  uint32_t           stageEnd;
+  uint32_t           copyLen;
+  ndefPollerSinkCtx *sink = (ndefPollerSinkCtx *)sinkCtx;
+
+  while (len > 0U) {
+    if ((sink->stagedLen == 0U) && ((sink->offset % sink->blockLen) == 0U) && (len >= sink->blockLen)) {
+      /* Nothing staged and aligned: write whole blocks straight from the segment */
+      copyLen = len - (len % sink->blockLen);
+
+      err = ndefPollerWriteBytes(sink->ctx, sink->offset, buf, copyLen);
       if (err != ERR_NONE) {
-        /* Conclude procedure */
         return err;
       }
-      offset += bufPayloadItem.length;
+      sink->offset += copyLen;
+    } else {
+      /* Stage up to the last block boundary the staging buffer can hold */
+      stageEnd = NDEF_POLLER_SINK_BUF_LEN - (NDEF_POLLER_SINK_BUF_LEN % sink->blockLen) - (sink->offset % sink->blockLen);
+      copyLen  = MIN(len, stageEnd - sink->stagedLen);
+
+      ST_MEMCPY(&sink->buf[sink->stagedLen], buf, copyLen);
+      sink->stagedLen += copyLen;
+
+      if (sink->stagedLen == stageEnd) {
+        err = ndefPollerSinkFlush(sink);
+        if (err != ERR_NONE) {
+          return err;
+        }
+      }
     }
-  }
 
-  *recordOffset = offset;
+    buf += copyLen;
+    len -= copyLen;
+  }
 
   return ERR_NONE;
 }
@@ -144,9 +213,8 @@ static ReturnCode ndefPollerWriteRecord(ndefContext *ctx, const ndefRecord *reco
 ReturnCode ndefPollerWriteMessage(ndefContext *ctx, const ndefMessage *message)
 {
   ReturnCode      err;
-  ndefMessageInfo info;
-  ndefRecord     *record;
-  uint32_t        offset;
+  ndefMessageInfo   info;
+  ndefPollerSinkCtx sinkCtx;
 
   if ((ctx == NULL) || (message == NULL)) {
     return ERR_PARAM;
@@ -156,6 +224,9 @@ ReturnCode ndefPollerWriteMessage(ndefContext *ctx, const ndefMessage *message)
     return ERR_WRONG_STATE;
   }
 
+  /* The message length is maintained upon append: this returns the cached
+   * value unless a record has changed since. It is required upfront as the
+   * TLV L-field format, hence the message offset, depends on it */
   (void)ndefMessageGetInfo(message, &info);
 
   /* Verify length of the NDEF message */
@@ -174,18 +245,20 @@ ReturnCode ndefPollerWriteMessage(ndefContext *ctx, const ndefMessage *message)
   }
 
   if (info.length != 0U) {
-    offset = ctx->messageOffset;
-
-    record = ndefMessageGetFirstRecord(message);
-    while (record != NULL) {
-      err = ndefPollerWriteRecord(ctx, record, &offset);
-      if (err != ERR_NONE) {
-        /* Conclude procedure */
-        ctx->state = NDEF_STATE_INVALID;
-        return err;
-      }
-
-      record = ndefMessageGetNextRecord(record);
+    sinkCtx.ctx       = ctx;
+    sinkCtx.offset    = ctx->messageOffset;
+    sinkCtx.blockLen  = ndefPollerSinkBlockLen(ctx);
+    sinkCtx.stagedLen = 0U;
+
+    /* Records are encoded and written in a single pass */
+    err = ndefMessageEncodeSegments(message, ndefPollerSegmentSink, &sinkCtx);
+    if (err == ERR_NONE) {
+      err = ndefPollerSinkFlush(&sinkCtx);
+    }
+    if (err != ERR_NONE) {
+      /* Conclude procedure */
+      ctx->state = NDEF_STATE_INVALID;
+      return err;
     }
 
     err = ndefPollerEndWriteMessage(ctx, info.length);
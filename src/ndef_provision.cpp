@@ -0,0 +1,241 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_provision.cpp
+  * @brief          : NDEF bulk tag provisioning engine
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_provision.h"
+#include "nfc_utils.h"
+
+
+#if NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*****************************************************************************/
+ReturnCode ndefProvisionInit(ndefProvision *prov, const ndefMessage *message, uint8_t *image, uint32_t imageLen, uint32_t options)
+{
+  ReturnCode err;
+  ndefBuffer bufImage;
+
+  if ((prov == NULL) || (message == NULL) || (image == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMSET(prov, 0, sizeof(ndefProvision));
+
+  bufImage.buffer = image;
+  bufImage.length = imageLen;
+  err = ndefMessageEncode(message, &bufImage);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  prov->image     = image;
+  prov->imageLen  = bufImage.length;
+  prov->options   = options;
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Tell whether a template area overlaps an already declared field
+ *****************************************************************************
+ */
+static bool ndefProvisionIsFieldOverlap(const ndefProvision *prov, uint32_t offset, uint32_t length)
+{
+  uint8_t i;
+
+  for (i = 0; i < prov->fieldCount; i++) {
+    if ((offset < (prov->field[i].offset + prov->field[i].length)) &&
+        (prov->field[i].offset < (offset + length))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefProvisionAddField(ndefProvision *prov, const ndefConstBuffer *placeholder, uint8_t *index)
+{
+  uint32_t offset;
+
+  if ((prov == NULL) || (placeholder == NULL) || (placeholder->buffer == NULL) || (placeholder->length == 0U) || (index == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (prov->fieldCount >= NDEF_PROVISION_FIELD_MAX) {
+    return ERR_NOMEM;
+  }
+
+  /* Skip the occurrences already declared: a repeated placeholder declares each of them in turn */
+  for (offset = 0; (offset + placeholder->length) <= prov->imageLen; offset++) {
+    if ((ST_BYTECMP(&prov->image[offset], placeholder->buffer, placeholder->length) == 0) &&
+        !ndefProvisionIsFieldOverlap(prov, offset, placeholder->length)) {
+      prov->field[prov->fieldCount].offset = offset;
+      prov->field[prov->fieldCount].length = placeholder->length;
+      *index = prov->fieldCount;
+      prov->fieldCount++;
+      return ERR_NONE;
+    }
+  }
+
+  return ERR_NOTFOUND;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefProvisionSetField(ndefProvision *prov, uint8_t index, const ndefConstBuffer *value)
+{
+  if ((prov == NULL) || (value == NULL) || (value->buffer == NULL) || (index >= prov->fieldCount)) {
+    return ERR_PARAM;
+  }
+
+  if (value->length != prov->field[index].length) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMCPY(&prov->image[prov->field[index].offset], value->buffer, value->length);
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Detect NDEF, formatting the tag when allowed and no NDEF is found
+ *****************************************************************************
+ */
+static ReturnCode ndefProvisionDetect(ndefProvision *prov, ndefContext *ctx, const ndefDevice *dev)
+{
+  ReturnCode err;
+  ndefInfo   info;
+
+  err = ndefPollerContextInitialization(ctx, dev);
+  if (err != ERR_NONE) {
+    prov->stats.detectErrors++;
+    return err;
+  }
+
+  err = ndefPollerNdefDetect(ctx, &info);
+  if ((err != ERR_NONE) && ((prov->options & NDEF_PROVISION_FORMAT) != 0U)) {
+    err = ndefPollerTagFormat(ctx, NULL, 0);
+    if (err != ERR_NONE) {
+      prov->stats.formatErrors++;
+      return err;
+    }
+    err = ndefPollerNdefDetect(ctx, &info);
+  }
+  if (err != ERR_NONE) {
+    prov->stats.detectErrors++;
+    return err;
+  }
+
+  if (info.state == NDEF_STATE_READONLY) {
+    prov->stats.writeErrors++;
+    return ERR_WRONG_STATE;
+  }
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefProvisionTag(ndefProvision *prov, ndefContext *ctx, const ndefDevice *dev)
+{
+  ReturnCode err;
+  uint32_t   startTime;
+
+  if ((prov == NULL) || (ctx == NULL) || (dev == NULL)) {
+    return ERR_PARAM;
+  }
+
+  startTime = millis();
+  if (prov->stats.tags == 0U) {
+    prov->startTime = startTime;
+  }
+  prov->stats.tags++;
+
+  err = ndefProvisionDetect(prov, ctx, dev);
+
+  if (err == ERR_NONE) {
+    err = ndefPollerWriteRawMessage(ctx, prov->image, prov->imageLen);
+    if (err != ERR_NONE) {
+      prov->stats.writeErrors++;
+    }
+  }
+
+  if ((err == ERR_NONE) && ((prov->options & (NDEF_PROVISION_VERIFY | NDEF_PROVISION_VERIFY_FULL)) != 0U)) {
+    err = ndefPollerVerifyRawMessage(ctx, prov->image, prov->imageLen,
+                                     ((prov->options & NDEF_PROVISION_VERIFY_FULL) != 0U) ? NDEF_VERIFY_FULL : NDEF_VERIFY_LAST);
+    if (err != ERR_NONE) {
+      prov->stats.verifyErrors++;
+    }
+  }
+
+  if (err == ERR_NONE) {
+    prov->stats.written++;
+  }
+
+  prov->stats.lastDuration  = millis() - startTime;
+  prov->stats.elapsed       = millis() - prov->startTime;
+  prov->stats.tagsPerMinute = ((prov->stats.elapsed != 0U) ? (uint32_t)(((uint64_t)prov->stats.written * 60000U) / prov->stats.elapsed) : 0U);
+
+  return err;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefProvisionGetStats(const ndefProvision *prov, ndefProvisionStats *stats)
+{
+  if ((prov == NULL) || (stats == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMCPY(stats, &prov->stats, sizeof(ndefProvisionStats));
+
+  return ERR_NONE;
+}
+
+#endif /* NDEF_FEATURE_FULL_API */
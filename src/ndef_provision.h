@@ -0,0 +1,192 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_provision.h
+  * @brief          : NDEF bulk tag provisioning engine header file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NDEF_PROVISION_H
+#define NDEF_PROVISION_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_poller.h"
+#include "ndef_message.h"
+
+
+#if NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef NDEF_PROVISION_FIELD_MAX
+  #define NDEF_PROVISION_FIELD_MAX  4U      /*!< Maximum number of variable fields of a template */
+#endif
+
+#define NDEF_PROVISION_FORMAT       0x01U   /*!< Format the tags where no NDEF is detected       */
+#define NDEF_PROVISION_VERIFY       0x02U   /*!< Verify the length and last bytes of each message */
+#define NDEF_PROVISION_VERIFY_FULL  0x04U   /*!< Verify the length and every byte of each message */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*! Variable field of the pre-encoded template */
+typedef struct {
+  uint32_t offset;                      /*!< Offset in the encoded message */
+  uint32_t length;                      /*!< Field length (bytes)          */
+} ndefProvisionField;
+
+
+/*! Provisioning statistics */
+typedef struct {
+  uint32_t tags;                        /*!< Tags processed                        */
+  uint32_t written;                     /*!< Tags successfully provisioned         */
+  uint32_t detectErrors;                /*!< Tags failing NDEF detection           */
+  uint32_t formatErrors;                /*!< Tags failing format                   */
+  uint32_t writeErrors;                 /*!< Tags failing write (read-only, full)  */
+  uint32_t verifyErrors;                /*!< Tags failing read back or compare     */
+  uint32_t lastDuration;                /*!< Duration of the last tag (ms)         */
+  uint32_t elapsed;                     /*!< Time since the first tag (ms)         */
+  uint32_t tagsPerMinute;               /*!< Provisioned tags per minute           */
+} ndefProvisionStats;
+
+
+/*! Provisioning engine */
+typedef struct {
+  uint8_t           *image;                           /*!< Pre-encoded message template          */
+  uint32_t           imageLen;                        /*!< Encoded message length                */
+  uint32_t           options;                         /*!< NDEF_PROVISION_xxx options            */
+  ndefProvisionField field[NDEF_PROVISION_FIELD_MAX]; /*!< Variable fields                       */
+  uint8_t            fieldCount;                      /*!< Number of variable fields             */
+  uint32_t           startTime;                       /*!< Start time of the first tag (ms)      */
+  ndefProvisionStats stats;                           /*!< Statistics                            */
+} ndefProvision;
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize the provisioning engine
+ *
+ * The template message is encoded once into image. Its variable fields hold
+ * placeholders of the final field length, so that the record lengths, and
+ * hence the field offsets, are the same for every tag.
+ *
+ * \param[out] prov:      Provisioning engine
+ * \param[in]  message:   Template message
+ * \param[out] image:     Buffer to store the encoded template
+ * \param[in]  imageLen:  Buffer length
+ * \param[in]  options:   NDEF_PROVISION_FORMAT, NDEF_PROVISION_VERIFY or
+ *                        NDEF_PROVISION_VERIFY_FULL
+ *
+ * \return ERR_NOMEM if the template does not fit in image
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefProvisionInit(ndefProvision *prov, const ndefMessage *message, uint8_t *image, uint32_t imageLen, uint32_t options);
+
+
+/*!
+ *****************************************************************************
+ * Declare a variable field of the template
+ *
+ * The field is located by its placeholder in the encoded template: the
+ * first occurrence not overlapping an already declared field is taken, so
+ * a placeholder repeated in the template is declared once per occurrence.
+ *
+ * \param[in,out] prov:        Provisioning engine
+ * \param[in]     placeholder: Placeholder bytes
+ * \param[out]    index:       Field index
+ *
+ * \return ERR_NOTFOUND if the placeholder is not in the template, or all its
+ *                      occurrences are already declared
+ * \return ERR_NOMEM if NDEF_PROVISION_FIELD_MAX fields are already declared
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefProvisionAddField(ndefProvision *prov, const ndefConstBuffer *placeholder, uint8_t *index);
+
+
+/*!
+ *****************************************************************************
+ * Set the value of a variable field for the next tag
+ *
+ * \param[in,out] prov:  Provisioning engine
+ * \param[in]     index: Field index
+ * \param[in]     value: Field value, of the placeholder length
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefProvisionSetField(ndefProvision *prov, uint8_t index, const ndefConstBuffer *value);
+
+
+/*!
+ *****************************************************************************
+ * Provision a tag with the current image
+ *
+ * Detect NDEF (formatting the tag when needed and allowed), write the
+ * patched image and optionally verify it with ndefPollerVerifyRawMessage().
+ *
+ * \param[in,out] prov: Provisioning engine
+ * \param[in,out] ctx:  NDEF context
+ * \param[in]     dev:  Activated device
+ *
+ * \return ERR_NONE if successful or the error of the failing step
+ *****************************************************************************
+ */
+ReturnCode ndefProvisionTag(ndefProvision *prov, ndefContext *ctx, const ndefDevice *dev);
+
+
+/*!
+ *****************************************************************************
+ * Get the provisioning statistics
+ *
+ * \param[in]  prov:  Provisioning engine
+ * \param[out] stats: Tags, failures per step, last duration and throughput
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefProvisionGetStats(const ndefProvision *prov, ndefProvisionStats *stats);
+
+
+#endif /* NDEF_FEATURE_FULL_API */
+
+#endif /* NDEF_PROVISION_H */
+
+/**
+  * @}
+  *
+  */
@@ -59,6 +59,16 @@
  */
 
 
+/*****************************************************************************/
+void ndefRecordSetChanged(const ndefRecord *record)
+{
+  if ((record != NULL) && (record->message != NULL)) {
+    /* The record length may have changed, the message length is to be computed again */
+    record->message->lengthDirty = true;
+  }
+}
+
+
 /*****************************************************************************/
 ReturnCode ndefRecordReset(ndefRecord *record)
 {
@@ -69,6 +79,9 @@ ReturnCode ndefRecordReset(ndefRecord *record)
     return ERR_PARAM;
   }
 
+  /* The record is not part of any message */
+  record->message = NULL;
+
   /* Set the MB and ME bits */
   record->header = ndefHeader(1U, 1U, 0U, 0U, 0U, NDEF_TNF_EMPTY);
 
@@ -157,6 +170,8 @@ ReturnCode ndefRecordSetType(ndefRecord *record, uint8_t tnf, const ndefConstBuf
   record->typeLength = bufType->length;
   record->type       = bufType->buffer;
 
+  ndefRecordSetChanged(record);
+
   return ERR_NONE;
 }
 
@@ -216,6 +231,8 @@ ReturnCode ndefRecordSetId(ndefRecord *record, const ndefConstBuffer8 *bufId)
   record->id       = bufId->buffer;
   record->idLength = bufId->length;
 
+  ndefRecordSetChanged(record);
+
   return ERR_NONE;
 }
 
@@ -247,6 +264,8 @@ ReturnCode ndefRecordSetPayload(ndefRecord *record, const ndefConstBuffer *bufPa
   record->bufPayload.buffer = bufPayload->buffer;
   record->bufPayload.length = bufPayload->length;
 
+  ndefRecordSetChanged(record);
+
   return ERR_NONE;
 }
 
@@ -416,85 +435,104 @@ ReturnCode ndefRecordEncodeHeader(const ndefRecord *record, ndefBuffer *bufHeade
 
 
 /*****************************************************************************/
-static ReturnCode ndefRecordEncodePayload(const ndefRecord *record, ndefBuffer *bufPayload)
+ReturnCode ndefRecordEncodeSegments(const ndefRecord *record, ndefSegmentSink sink, void *sinkCtx)
 {
-  uint32_t payloadLength;
-  uint32_t offset;
-  bool     begin;
+  ReturnCode      err;
+  uint8_t         recordHeaderBuf[NDEF_RECORD_HEADER_LEN];
+  ndefBuffer      bufHeader;
   ndefConstBuffer bufPayloadItem;
+  bool            begin;
 
-  if (bufPayload == NULL) {
+  if ((record == NULL) || (sink == NULL)) {
     return ERR_PARAM;
   }
 
-  payloadLength = ndefRecordGetPayloadLength(record);
-  if (payloadLength > bufPayload->length) {
-    return ERR_NOMEM;
+  bufHeader.buffer = recordHeaderBuf;
+  bufHeader.length = sizeof(recordHeaderBuf);
+  err = ndefRecordEncodeHeader(record, &bufHeader);
+  if (err != ERR_NONE) {
+    return err;
+  }
+  err = sink(sinkCtx, bufHeader.buffer, bufHeader.length);
+  if (err != ERR_NONE) {
+    return err;
   }
 
-  begin  = true;
-  offset = 0;
+  if (record->typeLength > 0U) {
+    err = sink(sinkCtx, record->type, record->typeLength);
+    if (err != ERR_NONE) {
+      return err;
+    }
+  }
+
+  if (record->idLength > 0U) {
+    err = sink(sinkCtx, record->id, record->idLength);
+    if (err != ERR_NONE) {
+      return err;
+    }
+  }
+
+  begin = true;
   while (ndefRecordGetPayloadItem(record, &bufPayloadItem, begin) != NULL) {
     begin = false;
     if (bufPayloadItem.length > 0U) {
-      ST_MEMCPY(&bufPayload->buffer[offset], bufPayloadItem.buffer, bufPayloadItem.length);
+      err = sink(sinkCtx, bufPayloadItem.buffer, bufPayloadItem.length);
+      if (err != ERR_NONE) {
+        return err;
+      }
     }
-    offset += bufPayloadItem.length;
   }
 
-  bufPayload->length = offset;
-
   return ERR_NONE;
 }
 
 
 /*****************************************************************************/
-ReturnCode ndefRecordEncode(const ndefRecord *record, ndefBuffer *bufRecord)
+ReturnCode ndefBufferSegmentSink(void *sinkCtx, const uint8_t *buf, uint32_t len)
 {
-  ReturnCode err;
-  ndefBuffer bufHeader;
-  ndefBuffer bufPayload;
-  uint32_t   offset;
+  ndefBuffer *bufOut = (ndefBuffer *)sinkCtx;
 
-  if ((record == NULL) || (bufRecord == NULL) || (bufRecord->buffer == NULL)) {
+  if ((bufOut == NULL) || (buf == NULL)) {
     return ERR_PARAM;
   }
 
-  if (bufRecord->length < ndefRecordGetLength(record)) {
-    bufRecord->length = ndefRecordGetLength(record);
+  if (len > bufOut->length) {
     return ERR_NOMEM;
   }
 
-  /* Encode header at the beginning of buffer provided */
-  bufHeader = *bufRecord; /* Copy ndefBuffer fields */
-  err = ndefRecordEncodeHeader(record, &bufHeader);
-  if (err != ERR_NONE) {
-    return err;
-  }
+  (void)ST_MEMCPY(bufOut->buffer, buf, len);
+  bufOut->buffer = &bufOut->buffer[len];
+  bufOut->length -= len;
+
+  return ERR_NONE;
+}
 
-  offset = bufHeader.length;
 
-  /* Set Type */
-  if (record->typeLength > 0U) {
-    (void)ST_MEMCPY(&bufRecord->buffer[offset], record->type, record->typeLength);
-    offset += record->typeLength;
+/*****************************************************************************/
+ReturnCode ndefRecordEncode(const ndefRecord *record, ndefBuffer *bufRecord)
+{
+  ReturnCode err;
+  uint32_t   recordLength;
+  ndefBuffer bufRemaining;
+
+  if ((record == NULL) || (bufRecord == NULL) || (bufRecord->buffer == NULL)) {
+    return ERR_PARAM;
   }
 
-  /* Set Id */
-  if (record->idLength > 0U) {
-    (void)ST_MEMCPY(&bufRecord->buffer[offset], record->id, record->idLength);
-    offset += record->idLength;
+  /* Check the length up front so that nothing is written to a too short buffer */
+  recordLength = ndefRecordGetLength(record);
+  if (bufRecord->length < recordLength) {
+    bufRecord->length = recordLength;
+    return ERR_NOMEM;
   }
 
-  /* Set Payload */
-  bufPayload.buffer = &bufRecord->buffer[offset];
-  bufPayload.length =  bufRecord->length - offset;
-  err = ndefRecordEncodePayload(record, &bufPayload);
+  bufRemaining = *bufRecord;
+  err = ndefRecordEncodeSegments(record, ndefBufferSegmentSink, &bufRemaining);
   if (err != ERR_NONE) {
     return err;
   }
 
-  bufRecord->length = offset + bufPayload.length;
+  bufRecord->length -= bufRemaining.length;
 
   return ERR_NONE;
 }
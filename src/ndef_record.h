@@ -115,9 +115,14 @@ typedef struct ndefRecordStruct {
   const ndefType *ndeftype;      /*!< Well-known type data */
 
   struct ndefRecordStruct *next; /*!< Pointer to the next record, if any */
+  ndefMessage    *message;       /*!< Message the record has been appended to, if any */
 } ndefRecord;
 
 
+/*! Segment sink, called in order with each (pointer, length) segment of an encoded record or message */
+typedef ReturnCode (*ndefSegmentSink)(void *sinkCtx, const uint8_t *buf, uint32_t len);
+
+
 /*
  ******************************************************************************
  * GLOBAL FUNCTION PROTOTYPES
@@ -138,6 +143,19 @@ typedef struct ndefRecordStruct {
 ReturnCode ndefRecordReset(ndefRecord *record);
 
 
+/*!
+ *****************************************************************************
+ * Notify a record change
+ *
+ * This function flags the length of the message the record belongs to, if
+ * any, to be computed again. It is called by the record setters.
+ *
+ * \param[in] record: Record that has changed
+ *****************************************************************************
+ */
+void ndefRecordSetChanged(const ndefRecord *record);
+
+
 /*!
  *****************************************************************************
  * Initialize an NDEF record
@@ -350,6 +368,43 @@ ReturnCode ndefRecordDecode(const ndefConstBuffer *bufPayload, ndefRecord *recor
   *****************************************************************************
   */
   ReturnCode ndefRecordEncode(const ndefRecord *record, ndefBuffer *bufRecord);
+
+
+  /*!
+  *****************************************************************************
+  * Encode an NDEF record as an ordered list of segments
+  *
+  * Walk the record once and hand each segment to the sink, in order:
+  * the encoded header, the type, the id and every payload item returned by
+  * ndefRecordGetPayloadItem(). Type, id and payload items are passed by
+  * reference, no copy is made. The header is encoded in a local scratch
+  * buffer only valid during the sink call.
+  *
+  * \param[in] record:  Record to convert
+  * \param[in] sink:    Function called for each segment
+  * \param[in] sinkCtx: Opaque context passed to the sink
+  *
+  * \return ERR_NONE if successful, the first error returned by the sink or a standard error code
+  *****************************************************************************
+  */
+  ReturnCode ndefRecordEncodeSegments(const ndefRecord *record, ndefSegmentSink sink, void *sinkCtx);
+
+
+  /*!
+  *****************************************************************************
+  * Segment sink copying to a RAM buffer
+  *
+  * Copy the segment at the beginning of the buffer, then advance the buffer
+  * pointer and decrease its length by the segment length.
+  *
+  * \param[in,out] sinkCtx: ndefBuffer describing the remaining output space
+  * \param[in]     buf:     Segment
+  * \param[in]     len:     Segment length
+  *
+  * \return ERR_NOMEM if the segment does not fit, ERR_NONE otherwise
+  *****************************************************************************
+  */
+  ReturnCode ndefBufferSegmentSink(void *sinkCtx, const uint8_t *buf, uint32_t len);
 #endif
 
 
@@ -0,0 +1,616 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_snep.cpp
+  * @brief          : NFC Forum SNEP client and server over LLCP
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_snep.h"
+#include "nfc_utils.h"
+
+
+#if NDEF_FEATURE_LLCP && NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define NDEF_SNEP_VERSION_MAJOR(v)  ((uint8_t)((v) >> 4))
+#define NDEF_SNEP_ACCEPTABLE_LEN    4U     /*!< Acceptable length field of a GET request */
+
+static const uint8_t ndefSnepServiceName[] = "urn:nfc:sn:snep";  /*!< SNEP default server name */
+
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+static void ndefSnepConnected(void *cbCtx, uint8_t conn);
+static void ndefSnepReceived(void *cbCtx, uint8_t conn, const uint8_t *data, uint16_t len);
+static void ndefSnepClosed(void *cbCtx, uint8_t conn);
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * \brief Write a SNEP header
+ *****************************************************************************
+ */
+static void ndefSnepPutHeader(uint8_t *buf, uint8_t code, uint32_t len)
+{
+  buf[0] = NDEF_SNEP_VERSION;
+  buf[1] = code;
+  buf[2] = (uint8_t)(len >> 24);
+  buf[3] = (uint8_t)(len >> 16);
+  buf[4] = (uint8_t)(len >> 8);
+  buf[5] = (uint8_t)len;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Convert a response code to the result of the client request
+ *****************************************************************************
+ */
+static ReturnCode ndefSnepResult(uint8_t code)
+{
+  switch (code) {
+    case NDEF_SNEP_RES_SUCCESS:
+      return ERR_NONE;
+    case NDEF_SNEP_RES_NOT_FOUND:
+      return ERR_NOTFOUND;
+    case NDEF_SNEP_RES_EXCESS_DATA:
+      return ERR_NOMEM;
+    case NDEF_SNEP_RES_NOT_IMPLEMENTED:
+    case NDEF_SNEP_RES_UNSUPPORTED_VERSION:
+      return ERR_NOTSUPP;
+    default:
+      return ERR_REQUEST;
+  }
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Send a header-only message: CONTINUE, REJECT or a status response
+ *****************************************************************************
+ */
+static void ndefSnepSendCtrl(ndefSnep *snep, uint8_t code)
+{
+  ndefSnepPutHeader(snep->ctrl, code, 0);
+  (void)ndefLlcpSend(snep->llcp, snep->conn, snep->ctrl, NDEF_SNEP_HEADER_LEN);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Send the message held in the buffer
+ *
+ * The first fragment is up to the remote MIU, the remaining ones are sent
+ * once the receiver asks to continue.
+ *****************************************************************************
+ */
+static ReturnCode ndefSnepSendMessage(ndefSnep *snep, uint32_t len)
+{
+  ReturnCode err;
+
+  snep->txLen   = len;
+  snep->txFirst = MIN(len, (uint32_t)ndefLlcpGetRemoteMiu(snep->llcp, snep->conn));
+
+  err = ndefLlcpSend(snep->llcp, snep->conn, snep->buf, snep->txFirst);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  if (snep->txFirst < snep->txLen) {
+    snep->state = NDEF_SNEP_STATE_WAIT_CONTINUE;
+  } else {
+    snep->state = (snep->server ? NDEF_SNEP_STATE_READY : NDEF_SNEP_STATE_WAIT_RESPONSE);
+  }
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Send the remaining fragments of the message
+ *****************************************************************************
+ */
+static void ndefSnepSendRemaining(ndefSnep *snep)
+{
+  (void)ndefLlcpSend(snep->llcp, snep->conn, &snep->buf[snep->txFirst], (snep->txLen - snep->txFirst));
+  snep->state = (snep->server ? NDEF_SNEP_STATE_READY : NDEF_SNEP_STATE_WAIT_RESPONSE);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Serve a GET request, the response is encoded in the buffer
+ *****************************************************************************
+ */
+static uint8_t ndefSnepServerGet(ndefSnep *snep, const uint8_t *info, uint32_t infoLen, uint32_t *responseLen)
+{
+  ndefConstBuffer    bufRequest;
+  ndefBuffer         bufResponse;
+  ndefMessage        request;
+  const ndefMessage *response = NULL;
+  uint32_t           acceptableLen;
+
+  if (snep->getCb == NULL) {
+    return NDEF_SNEP_RES_NOT_IMPLEMENTED;
+  }
+  if (infoLen < NDEF_SNEP_ACCEPTABLE_LEN) {
+    return NDEF_SNEP_RES_BAD_REQUEST;
+  }
+  acceptableLen     = GETU32(info);
+  bufRequest.buffer = &info[NDEF_SNEP_ACCEPTABLE_LEN];
+  bufRequest.length = infoLen - NDEF_SNEP_ACCEPTABLE_LEN;
+  if (ndefMessageDecode(&bufRequest, &request) != ERR_NONE) {
+    return NDEF_SNEP_RES_BAD_REQUEST;
+  }
+
+  if ((snep->getCb(snep->cbCtx, &request, &response) != ERR_NONE) || (response == NULL)) {
+    return NDEF_SNEP_RES_NOT_FOUND;
+  }
+
+  bufResponse.buffer = &snep->buf[NDEF_SNEP_HEADER_LEN];
+  bufResponse.length = snep->bufLen - NDEF_SNEP_HEADER_LEN;
+  if ((ndefMessageEncode(response, &bufResponse) != ERR_NONE) || (bufResponse.length > acceptableLen)) {
+    return NDEF_SNEP_RES_EXCESS_DATA;
+  }
+
+  *responseLen = bufResponse.length;
+
+  return NDEF_SNEP_RES_SUCCESS;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Process a complete request received by the server
+ *****************************************************************************
+ */
+static void ndefSnepServerHandle(ndefSnep *snep, uint8_t code, const uint8_t *info, uint32_t infoLen)
+{
+  ndefConstBuffer bufMessage;
+  ndefMessage     message;
+  uint32_t        responseLen = 0;
+  uint8_t         response;
+
+  switch (code) {
+    case NDEF_SNEP_REQ_CONTINUE:
+      if (snep->state == NDEF_SNEP_STATE_WAIT_CONTINUE) {
+        ndefSnepSendRemaining(snep);
+      }
+      return;
+
+    case NDEF_SNEP_REQ_REJECT:
+      snep->state = NDEF_SNEP_STATE_READY;
+      return;
+
+    case NDEF_SNEP_REQ_PUT:
+      if (snep->putCb == NULL) {
+        response = NDEF_SNEP_RES_NOT_IMPLEMENTED;
+        break;
+      }
+      bufMessage.buffer = info;
+      bufMessage.length = infoLen;
+      if ((info == NULL) || (ndefMessageDecode(&bufMessage, &message) != ERR_NONE) || (snep->putCb(snep->cbCtx, &message) != ERR_NONE)) {
+        response = NDEF_SNEP_RES_BAD_REQUEST;
+        break;
+      }
+      response = NDEF_SNEP_RES_SUCCESS;
+      break;
+
+    case NDEF_SNEP_REQ_GET:
+      if (info == NULL) {
+        response = NDEF_SNEP_RES_BAD_REQUEST;
+        break;
+      }
+      response = ndefSnepServerGet(snep, info, infoLen, &responseLen);
+      if (response == NDEF_SNEP_RES_SUCCESS) {
+        ndefSnepPutHeader(snep->buf, response, responseLen);
+        if (ndefSnepSendMessage(snep, (NDEF_SNEP_HEADER_LEN + responseLen)) == ERR_NONE) {
+          return;
+        }
+        response = NDEF_SNEP_RES_REJECT;
+      }
+      break;
+
+    default:
+      response = NDEF_SNEP_RES_BAD_REQUEST;
+      break;
+  }
+
+  ndefSnepSendCtrl(snep, response);
+  snep->state = NDEF_SNEP_STATE_READY;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Process a complete response received by the client
+ *****************************************************************************
+ */
+static void ndefSnepClientHandle(ndefSnep *snep, uint8_t code)
+{
+  if ((snep->state == NDEF_SNEP_STATE_WAIT_CONTINUE) && (code == NDEF_SNEP_RES_CONTINUE)) {
+    ndefSnepSendRemaining(snep);
+    return;
+  }
+
+  if ((snep->state == NDEF_SNEP_STATE_WAIT_CONTINUE) || (snep->state == NDEF_SNEP_STATE_WAIT_RESPONSE)) {
+    snep->result = ndefSnepResult(code);
+    snep->state  = NDEF_SNEP_STATE_READY;
+  }
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief LLCP connected callback
+ *****************************************************************************
+ */
+static void ndefSnepConnected(void *cbCtx, uint8_t conn)
+{
+  ndefSnep *snep = (ndefSnep *)cbCtx;
+
+  if (snep->server) {
+    if (snep->state != NDEF_SNEP_STATE_IDLE) {
+      /* One client at a time */
+      (void)ndefLlcpDisconnect(snep->llcp, conn);
+      return;
+    }
+    snep->conn = conn;
+  } else if ((snep->state != NDEF_SNEP_STATE_CONNECTING) || (snep->conn != conn)) {
+    return;
+  } else {
+    /* MISRA 15.7 - Empty else */
+  }
+
+  snep->rxLen      = 0;
+  snep->rxExpected = 0;
+  snep->result     = ERR_NONE;
+  snep->state      = NDEF_SNEP_STATE_READY;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief LLCP received callback: reassemble the fragments of a message
+ *****************************************************************************
+ */
+static void ndefSnepReceived(void *cbCtx, uint8_t conn, const uint8_t *data, uint16_t len)
+{
+  ndefSnep *snep = (ndefSnep *)cbCtx;
+  uint32_t  msgLen;
+  uint32_t  copyLen;
+
+  if ((conn != snep->conn) || (snep->state == NDEF_SNEP_STATE_IDLE) || (snep->state == NDEF_SNEP_STATE_CLOSED)) {
+    return;
+  }
+
+  if (snep->rxExpected == 0U) {
+    if ((len < NDEF_SNEP_HEADER_LEN) || (NDEF_SNEP_VERSION_MAJOR(data[0]) != NDEF_SNEP_VERSION_MAJOR(NDEF_SNEP_VERSION))) {
+      if (snep->server) {
+        ndefSnepSendCtrl(snep, ((len < NDEF_SNEP_HEADER_LEN) ? NDEF_SNEP_RES_BAD_REQUEST : NDEF_SNEP_RES_UNSUPPORTED_VERSION));
+      } else {
+        snep->result = ERR_PROTO;
+      }
+      snep->state = NDEF_SNEP_STATE_READY;
+      return;
+    }
+
+    msgLen = GETU32(&data[2]);
+    if (msgLen == 0U) {
+      /* Header-only message, processed in place as the buffer may hold a message being sent */
+      snep->rxLen = 0;
+      if (snep->server) {
+        ndefSnepServerHandle(snep, data[1], NULL, 0);
+      } else {
+        ndefSnepClientHandle(snep, data[1]);
+      }
+      return;
+    }
+
+    if ((msgLen > (snep->bufLen - NDEF_SNEP_HEADER_LEN)) || (snep->state == NDEF_SNEP_STATE_WAIT_CONTINUE)) {
+      /* The sender waits for CONTINUE after the first fragment: no more fragments follow */
+      if (snep->server) {
+        ndefSnepSendCtrl(snep, NDEF_SNEP_RES_REJECT);
+      } else {
+        if ((NDEF_SNEP_HEADER_LEN + msgLen) > len) {
+          ndefSnepSendCtrl(snep, NDEF_SNEP_REQ_REJECT);
+        }
+        snep->result = ERR_NOMEM;
+      }
+      snep->state = NDEF_SNEP_STATE_READY;
+      return;
+    }
+
+    snep->rxExpected = NDEF_SNEP_HEADER_LEN + msgLen;
+    snep->rxLen      = 0;
+  }
+
+  copyLen = MIN((uint32_t)len, (snep->rxExpected - snep->rxLen));
+  (void)ST_MEMCPY(&snep->buf[snep->rxLen], data, copyLen);
+  snep->rxLen += copyLen;
+
+  if (snep->rxLen < snep->rxExpected) {
+    if (snep->rxLen == copyLen) {
+      /* First fragment */
+      ndefSnepSendCtrl(snep, (snep->server ? NDEF_SNEP_RES_CONTINUE : NDEF_SNEP_REQ_CONTINUE));
+    }
+    return;
+  }
+
+  snep->rxExpected = 0;
+  if (snep->server) {
+    ndefSnepServerHandle(snep, snep->buf[1], &snep->buf[NDEF_SNEP_HEADER_LEN], (snep->rxLen - NDEF_SNEP_HEADER_LEN));
+  } else {
+    ndefSnepClientHandle(snep, snep->buf[1]);
+  }
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief LLCP closed callback
+ *****************************************************************************
+ */
+static void ndefSnepClosed(void *cbCtx, uint8_t conn)
+{
+  ndefSnep *snep = (ndefSnep *)cbCtx;
+
+  if ((conn != snep->conn) || (snep->state == NDEF_SNEP_STATE_IDLE)) {
+    return;
+  }
+
+  snep->rxExpected = 0;
+  if (snep->server) {
+    snep->conn  = NDEF_LLCP_CONN_INVALID;
+    snep->state = NDEF_SNEP_STATE_IDLE;
+  } else {
+    snep->state = NDEF_SNEP_STATE_CLOSED;
+  }
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Initialize a client or server context
+ *****************************************************************************
+ */
+static ReturnCode ndefSnepInit(ndefSnep *snep, ndefLlcp *llcp, uint8_t *buf, uint32_t bufLen, bool server)
+{
+  if ((snep == NULL) || (llcp == NULL) || (buf == NULL) || (bufLen <= (NDEF_SNEP_HEADER_LEN + NDEF_SNEP_ACCEPTABLE_LEN))) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMSET(snep, 0, sizeof(ndefSnep));
+
+  snep->llcp   = llcp;
+  snep->conn   = NDEF_LLCP_CONN_INVALID;
+  snep->server = server;
+  snep->state  = NDEF_SNEP_STATE_IDLE;
+  snep->buf    = buf;
+  snep->bufLen = bufLen;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepServerInit(ndefSnep *snep, ndefLlcp *llcp, uint8_t *buf, uint32_t bufLen,
+                              ndefSnepPutCallback putCb, ndefSnepGetCallback getCb, void *cbCtx)
+{
+  ReturnCode        err;
+  ndefConstBuffer   name;
+  ndefLlcpCallbacks cb;
+
+  err = ndefSnepInit(snep, llcp, buf, bufLen, true);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  snep->putCb = putCb;
+  snep->getCb = getCb;
+  snep->cbCtx = cbCtx;
+
+  name.buffer  = ndefSnepServiceName;
+  name.length  = sizeof(ndefSnepServiceName) - 1U;
+  cb.connected = ndefSnepConnected;
+  cb.received  = ndefSnepReceived;
+  cb.closed    = ndefSnepClosed;
+  cb.cbCtx     = snep;
+
+  return ndefLlcpRegisterService(llcp, NDEF_LLCP_SAP_SNEP, &name, &cb);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepClientInit(ndefSnep *snep, ndefLlcp *llcp, uint8_t *buf, uint32_t bufLen)
+{
+  return ndefSnepInit(snep, llcp, buf, bufLen, false);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepClientConnect(ndefSnep *snep)
+{
+  ReturnCode        err;
+  ndefLlcpCallbacks cb;
+
+  if ((snep == NULL) || snep->server) {
+    return ERR_PARAM;
+  }
+
+  if ((snep->state != NDEF_SNEP_STATE_IDLE) && (snep->state != NDEF_SNEP_STATE_CLOSED)) {
+    return ERR_WRONG_STATE;
+  }
+
+  cb.connected = ndefSnepConnected;
+  cb.received  = ndefSnepReceived;
+  cb.closed    = ndefSnepClosed;
+  cb.cbCtx     = snep;
+
+  err = ndefLlcpConnect(snep->llcp, NDEF_LLCP_SAP_SNEP, &cb, &snep->conn);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  snep->result = ERR_NONE;
+  snep->state  = NDEF_SNEP_STATE_CONNECTING;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepClientPut(ndefSnep *snep, const ndefMessage *message)
+{
+  ReturnCode err;
+  ndefBuffer bufMessage;
+
+  if ((snep == NULL) || (message == NULL) || snep->server) {
+    return ERR_PARAM;
+  }
+
+  if (snep->state != NDEF_SNEP_STATE_READY) {
+    return ERR_WRONG_STATE;
+  }
+
+  bufMessage.buffer = &snep->buf[NDEF_SNEP_HEADER_LEN];
+  bufMessage.length = snep->bufLen - NDEF_SNEP_HEADER_LEN;
+  err = ndefMessageEncode(message, &bufMessage);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  ndefSnepPutHeader(snep->buf, NDEF_SNEP_REQ_PUT, bufMessage.length);
+  snep->result = ERR_BUSY;
+
+  return ndefSnepSendMessage(snep, (NDEF_SNEP_HEADER_LEN + bufMessage.length));
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepClientGet(ndefSnep *snep, const ndefMessage *request, uint32_t acceptableLen)
+{
+  ReturnCode err;
+  ndefBuffer bufMessage;
+  uint32_t   maxLen;
+
+  if ((snep == NULL) || (request == NULL) || snep->server) {
+    return ERR_PARAM;
+  }
+
+  if (snep->state != NDEF_SNEP_STATE_READY) {
+    return ERR_WRONG_STATE;
+  }
+
+  maxLen = snep->bufLen - NDEF_SNEP_HEADER_LEN;
+  if ((acceptableLen == 0U) || (acceptableLen > maxLen)) {
+    acceptableLen = maxLen;
+  }
+
+  bufMessage.buffer = &snep->buf[NDEF_SNEP_HEADER_LEN + NDEF_SNEP_ACCEPTABLE_LEN];
+  bufMessage.length = maxLen - NDEF_SNEP_ACCEPTABLE_LEN;
+  err = ndefMessageEncode(request, &bufMessage);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  ndefSnepPutHeader(snep->buf, NDEF_SNEP_REQ_GET, (NDEF_SNEP_ACCEPTABLE_LEN + bufMessage.length));
+  snep->buf[NDEF_SNEP_HEADER_LEN]      = (uint8_t)(acceptableLen >> 24);
+  snep->buf[NDEF_SNEP_HEADER_LEN + 1U] = (uint8_t)(acceptableLen >> 16);
+  snep->buf[NDEF_SNEP_HEADER_LEN + 2U] = (uint8_t)(acceptableLen >> 8);
+  snep->buf[NDEF_SNEP_HEADER_LEN + 3U] = (uint8_t)acceptableLen;
+  snep->result = ERR_BUSY;
+
+  return ndefSnepSendMessage(snep, (NDEF_SNEP_HEADER_LEN + NDEF_SNEP_ACCEPTABLE_LEN + bufMessage.length));
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepClientGetResponse(const ndefSnep *snep, ndefMessage *message)
+{
+  ndefConstBuffer bufMessage;
+
+  if ((snep == NULL) || (message == NULL) || snep->server) {
+    return ERR_PARAM;
+  }
+
+  if ((snep->state != NDEF_SNEP_STATE_READY) || (snep->result != ERR_NONE) || (snep->rxLen < NDEF_SNEP_HEADER_LEN)) {
+    return ERR_WRONG_STATE;
+  }
+
+  bufMessage.buffer = &snep->buf[NDEF_SNEP_HEADER_LEN];
+  bufMessage.length = snep->rxLen - NDEF_SNEP_HEADER_LEN;
+
+  return ndefMessageDecode(&bufMessage, message);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepGetStatus(const ndefSnep *snep)
+{
+  if (snep == NULL) {
+    return ERR_PARAM;
+  }
+
+  switch (snep->state) {
+    case NDEF_SNEP_STATE_IDLE:
+      return ERR_WRONG_STATE;
+    case NDEF_SNEP_STATE_READY:
+      return snep->result;
+    case NDEF_SNEP_STATE_CLOSED:
+      return ERR_LINK_LOSS;
+    default:
+      return ERR_BUSY;
+  }
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefSnepDisconnect(ndefSnep *snep)
+{
+  if (snep == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (snep->conn == NDEF_LLCP_CONN_INVALID) {
+    return ERR_WRONG_STATE;
+  }
+
+  return ndefLlcpDisconnect(snep->llcp, snep->conn);
+}
+
+#endif /* NDEF_FEATURE_LLCP && NDEF_FEATURE_FULL_API */
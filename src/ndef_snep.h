@@ -0,0 +1,251 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_snep.h
+  * @brief          : NFC Forum SNEP client and server over LLCP header file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NDEF_SNEP_H
+#define NDEF_SNEP_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_llcp.h"
+#include "ndef_message.h"
+
+
+#if NDEF_FEATURE_LLCP && NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define NDEF_SNEP_VERSION                  0x10U   /*!< SNEP version 1.0                        */
+#define NDEF_SNEP_HEADER_LEN               6U      /*!< Version, code and 4-byte length         */
+
+#define NDEF_SNEP_REQ_CONTINUE             0x00U   /*!< Request: send remaining fragments       */
+#define NDEF_SNEP_REQ_GET                  0x01U   /*!< Request: get an NDEF message            */
+#define NDEF_SNEP_REQ_PUT                  0x02U   /*!< Request: put an NDEF message            */
+#define NDEF_SNEP_REQ_REJECT               0x7FU   /*!< Request: do not send remaining fragments*/
+
+#define NDEF_SNEP_RES_CONTINUE             0x80U   /*!< Response: continue                      */
+#define NDEF_SNEP_RES_SUCCESS              0x81U   /*!< Response: success                       */
+#define NDEF_SNEP_RES_NOT_FOUND            0xC0U   /*!< Response: resource not found            */
+#define NDEF_SNEP_RES_EXCESS_DATA          0xC1U   /*!< Response: resource exceeds data size    */
+#define NDEF_SNEP_RES_BAD_REQUEST          0xC2U   /*!< Response: malformed request             */
+#define NDEF_SNEP_RES_NOT_IMPLEMENTED      0xE0U   /*!< Response: unsupported functionality     */
+#define NDEF_SNEP_RES_UNSUPPORTED_VERSION  0xE1U   /*!< Response: unsupported protocol version  */
+#define NDEF_SNEP_RES_REJECT               0xFFU   /*!< Response: do not send remaining fragments*/
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*! SNEP states */
+typedef enum {
+  NDEF_SNEP_STATE_IDLE,                 /*!< No connection                                      */
+  NDEF_SNEP_STATE_CONNECTING,           /*!< Client connection in progress                      */
+  NDEF_SNEP_STATE_READY,                /*!< Connected, no exchange in progress                 */
+  NDEF_SNEP_STATE_WAIT_CONTINUE,        /*!< First fragment sent, waiting for CONTINUE          */
+  NDEF_SNEP_STATE_WAIT_RESPONSE,        /*!< Client request sent, waiting for the response      */
+  NDEF_SNEP_STATE_CLOSED                /*!< Connection closed or refused                       */
+} ndefSnepState;
+
+
+/*! Server PUT callback: message is only valid during the call */
+typedef ReturnCode (*ndefSnepPutCallback)(void *cbCtx, const ndefMessage *message);
+
+/*! Server GET callback: the response is encoded over the request, so it must not point into the request */
+typedef ReturnCode (*ndefSnepGetCallback)(void *cbCtx, const ndefMessage *request, const ndefMessage **response);
+
+
+/*! SNEP client or server context */
+typedef struct {
+  ndefLlcp            *llcp;            /*!< LLCP link                                          */
+  uint8_t              conn;            /*!< LLCP connection                                    */
+  bool                 server;          /*!< Server, client otherwise                           */
+  ndefSnepState        state;           /*!< Current state                                      */
+  ReturnCode           result;          /*!< Result of the last client request                  */
+  uint8_t             *buf;             /*!< Message buffer, header included                    */
+  uint32_t             bufLen;          /*!< Message buffer length                              */
+  uint32_t             txLen;           /*!< Length of the message to send                      */
+  uint32_t             txFirst;         /*!< Length of the first fragment                       */
+  uint32_t             rxLen;           /*!< Bytes of the message received so far               */
+  uint32_t             rxExpected;      /*!< Length of the message being received               */
+  uint8_t              ctrl[NDEF_SNEP_HEADER_LEN]; /*!< Header-only message (CONTINUE, status)  */
+  ndefSnepPutCallback  putCb;           /*!< Server PUT callback                                */
+  ndefSnepGetCallback  getCb;           /*!< Server GET callback                                */
+  void                *cbCtx;           /*!< Context passed to the server callbacks             */
+} ndefSnep;
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize a SNEP server
+ *
+ * Register the SNEP default server on SAP 4 and service name
+ * "urn:nfc:sn:snep". Requests and responses are held in buf, which bounds
+ * the largest message exchanged. The server runs from ndefLlcpWorker().
+ *
+ * \param[out] snep:   SNEP context
+ * \param[in]  llcp:   LLCP link, before ndefLlcpGetGeneralBytes()
+ * \param[in]  buf:    Message buffer
+ * \param[in]  bufLen: Message buffer length
+ * \param[in]  putCb:  PUT callback, NULL if PUT is not implemented
+ * \param[in]  getCb:  GET callback, NULL if GET is not implemented
+ * \param[in]  cbCtx:  Context passed to the callbacks
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefSnepServerInit(ndefSnep *snep, ndefLlcp *llcp, uint8_t *buf, uint32_t bufLen,
+                              ndefSnepPutCallback putCb, ndefSnepGetCallback getCb, void *cbCtx);
+
+
+/*!
+ *****************************************************************************
+ * Initialize a SNEP client
+ *
+ * \param[out] snep:   SNEP context
+ * \param[in]  llcp:   LLCP link
+ * \param[in]  buf:    Message buffer
+ * \param[in]  bufLen: Message buffer length
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefSnepClientInit(ndefSnep *snep, ndefLlcp *llcp, uint8_t *buf, uint32_t bufLen);
+
+
+/*!
+ *****************************************************************************
+ * Connect the client to the remote SNEP default server
+ *
+ * The LLCP link must be activated. Completion is reported by
+ * ndefSnepGetStatus().
+ *
+ * \param[in,out] snep: SNEP client context
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefSnepClientConnect(ndefSnep *snep);
+
+
+/*!
+ *****************************************************************************
+ * Send a PUT request
+ *
+ * Completion is reported by ndefSnepGetStatus().
+ *
+ * \param[in,out] snep:    SNEP client context
+ * \param[in]     message: Message to put
+ *
+ * \return ERR_WRONG_STATE if not connected or a request is in progress
+ * \return ERR_NOMEM if the message does not fit in the buffer
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefSnepClientPut(ndefSnep *snep, const ndefMessage *message);
+
+
+/*!
+ *****************************************************************************
+ * Send a GET request
+ *
+ * Completion is reported by ndefSnepGetStatus(), the returned message is
+ * then decoded with ndefSnepClientGetResponse().
+ *
+ * \param[in,out] snep:          SNEP client context
+ * \param[in]     request:       Request message
+ * \param[in]     acceptableLen: Largest response the client accepts, 0 for the buffer length
+ *
+ * \return ERR_WRONG_STATE if not connected or a request is in progress
+ * \return ERR_NOMEM if the request does not fit in the buffer
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefSnepClientGet(ndefSnep *snep, const ndefMessage *request, uint32_t acceptableLen);
+
+
+/*!
+ *****************************************************************************
+ * Decode the message returned by a successful GET request
+ *
+ * The records point into the SNEP buffer, valid until the next request.
+ *
+ * \param[in]  snep:    SNEP client context
+ * \param[out] message: Returned message
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefSnepClientGetResponse(const ndefSnep *snep, ndefMessage *message);
+
+
+/*!
+ *****************************************************************************
+ * Get the status of the client connection or of the last request
+ *
+ * \param[in] snep: SNEP client context
+ *
+ * \return ERR_BUSY while connecting or while the request is in progress
+ * \return ERR_NOTFOUND, ERR_NOMEM (excess data), ERR_REQUEST (bad request
+ *         or rejected) or ERR_NOTSUPP on a server error response
+ * \return ERR_LINK_LOSS if the connection is closed or refused
+ * \return ERR_NONE once connected or the request is successful
+ *****************************************************************************
+ */
+ReturnCode ndefSnepGetStatus(const ndefSnep *snep);
+
+
+/*!
+ *****************************************************************************
+ * Close the SNEP connection
+ *
+ * \param[in,out] snep: SNEP client context
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefSnepDisconnect(ndefSnep *snep);
+
+
+#endif /* NDEF_FEATURE_LLCP && NDEF_FEATURE_FULL_API */
+
+#endif /* NDEF_SNEP_H */
+
+/**
+  * @}
+  *
+  */
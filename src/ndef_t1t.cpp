@@ -0,0 +1,1168 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_t1t.cpp
+  * @brief          : Provides NDEF methods and definitions to access NFC Forum T1T
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "ndef_poller.h"
+#include "ndef_t1t.h"
+#include "nfc_utils.h"
+#include "ndef_class.h"
+
+/*
+ ******************************************************************************
+ * ENABLE SWITCH
+ ******************************************************************************
+ */
+
+#ifndef NDEF_FEATURE_T1T
+  #error " NDEF: Module configuration missing. Please enable/disable T1T module by setting: NDEF_FEATURE_T1T"
+#endif
+
+#if NDEF_FEATURE_T1T
+
+#ifndef NDEF_FEATURE_FULL_API
+  #error " NDEF: Module configuration missing. Please enable/disable Full API by setting: NDEF_FEATURE_FULL_API"
+#endif
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define NDEF_T1T_BLOCK_SIZE         RFAL_T1T_BLOCK_LEN       /*!< block size                                        */
+#define NDEF_T1T_SEGMENT_SIZE       RFAL_T1T_SEGMENT_LEN     /*!< segment size (RSEG)                               */
+#define NDEF_T1T_STATIC_MEM_SIZE    RFAL_T1T_STATIC_MEM_LEN  /*!< Static memory size (RALL)                         */
+#define NDEF_T1T_MAX_MEM_SIZE       2048U                    /*!< Max dynamic memory size: 256 blocks               */
+#define NDEF_T1T_RALL_RESP_SIZE     (RFAL_T1T_HR_LENGTH + RFAL_T1T_STATIC_MEM_LEN) /*!< RALL response: HR0, HR1 and static memory */
+#define NDEF_T1T_RSEG_RESP_SIZE     (1U + RFAL_T1T_SEGMENT_LEN) /*!< RSEG response: ADDS and segment                */
+#define NDEF_T1T_3_BYTES_TLV_LEN    0xFFU         /* FFh indicates the use of 3 bytes got the L field    */
+
+#define NDEF_T1T_CC_OFFSET             8U         /*!< CC offset                                         */
+#define NDEF_T1T_CC_LEN                4U         /*!< CC length                                         */
+#define NDEF_T1T_AREA_OFFSET          12U         /*!< T1T Area starts after the CC                      */
+
+#define NDEF_T1T_RSVD_OFFSET         104U         /*!< Blocks 0Dh-0Fh: reserved, static lock and OTP     */
+#define NDEF_T1T_RSVD_LEN             24U         /*!< Blocks 0Dh-0Fh length                             */
+#define NDEF_T1T_STATLOCK_OFFSET     112U         /*!< Static Lock offset                                */
+#define NDEF_T1T_STATLOCK_LEN          2U         /*!< Static Lock length                                */
+
+#define NDEF_T1T_MAGIC              0xE1U         /*!< CC Magic Number                                   */
+#define NDEF_T1T_CC_0                  0U         /*!< CC_0: Magic Number                                */
+#define NDEF_T1T_CC_1                  1U         /*!< CC_1: Version                                     */
+#define NDEF_T1T_CC_2                  2U         /*!< CC_2: Tag Memory Size                             */
+#define NDEF_T1T_CC_3                  3U         /*!< CC_3: Access conditions                           */
+
+#define NDEF_T1T_VERSION_1_0        0x10U         /*!< Version 1.0                                       */
+
+#define NDEF_T1T_SIZE_DIVIDER          8U         /*!< Tag memory size is equal to 8 * (TMS + 1)         */
+#define NDEF_T1T_TMS_STATIC         0x0EU         /*!< Default TMS of static memory tags: 120 bytes      */
+#define NDEF_T1T_TMS_DYNAMIC        0x3FU         /*!< Default TMS of dynamic memory tags: Topaz 512     */
+
+#define NDEF_T1T_TLV_NULL           0x00U         /*!< Null TLV                                          */
+#define NDEF_T1T_TLV_LOCK_CTRL      0x01U         /*!< Lock Control TLV                                  */
+#define NDEF_T1T_TLV_MEMORY_CTRL    0x02U         /*!< Memory Control TLV                                */
+#define NDEF_T1T_TLV_NDEF_MESSAGE   0x03U         /*!< NDEF Message TLV                                  */
+#define NDEF_T1T_TLV_PROPRIETRARY   0xFDU         /*!< Proprietary TLV                                   */
+#define NDEF_T1T_TLV_TERMINATOR     0xFEU         /*!< Terminator TLV                                    */
+
+#define NDEF_T1T_TLV_L_3_BYTES_LEN     3U         /*!< TLV L Length: 3 bytes                             */
+#define NDEF_T1T_TLV_L_1_BYTES_LEN     1U         /*!< TLV L Length: 1 byte                              */
+#define NDEF_T1T_TLV_T_LEN             1U         /*!< TLV T Length: 1 byte                              */
+
+#define NDEF_T1T_LOCK_CTRL_LEN         3U         /*!< Dyn Lock Control Length: 3 bytes                  */
+#define NDEF_T1T_MEM_CTRL_LEN          3U         /*!< Memory Control Length: 3 bytes                    */
+
+#define NDEF_T1T_WR_ACCESS_GRANTED   0x0U         /*!< Write Access 0h: Access granted w/o any security  */
+#define NDEF_T1T_WR_ACCESS_NONE      0xFU         /*!< Write Access Fh: No access granted                */
+
+#ifndef NDEF_T1T_N_RETRY_ERROR
+  #define NDEF_T1T_N_RETRY_ERROR         1U         /*!< nT1T,RETRY,ERROR                                  */
+#endif /* NDEF_T1T_N_RETRY_ERROR */
+
+#define NDEF_T1T_DYN_LOCK_BYTES_MAX   32U         /*!< Max number of Dyn Lock Bytes                      */
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+/*
+ ******************************************************************************
+ * GLOBAL MACROS
+ ******************************************************************************
+ */
+
+#define ndefT1TisT1TDevice(device) ((((device)->type == RFAL_NFC_LISTEN_TYPE_NFCA) && ((device)->dev.nfca.type == RFAL_NFCA_T1T)))
+#define ndefT1TInvalidateCache(ctx) { (ctx)->subCtx.t1t.cacheAddr = 0xFFFFFFFFU; }
+
+#define ndefT1TIsReadOnlyAccessGranted(ctx)  (((ctx)->cc.t1t.readAccess == 0x0U) && ((ctx)->cc.t1t.writeAccess == NDEF_T1T_WR_ACCESS_NONE))
+#define ndefT1TIsReadWriteAccessGranted(ctx) (((ctx)->cc.t1t.readAccess == 0x0U) && ((ctx)->cc.t1t.writeAccess == NDEF_T1T_WR_ACCESS_GRANTED))
+
+#define ndefT1TIsTransmissionError(err)      ( ((err) == ERR_FRAMING) || ((err) == ERR_CRC) || ((err) == ERR_PAR) )
+
+#define ndefT1TMemSize(ctx)                  ((ctx)->subCtx.t1t.dynamicMemory ? NDEF_T1T_MAX_MEM_SIZE : NDEF_T1T_STATIC_MEM_SIZE)
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+static ReturnCode ndefT1TPollerReadSegment(ndefContext *ctx, uint8_t segment);
+
+#if NDEF_FEATURE_FULL_API
+  static ReturnCode ndefT1TPollerWriteBlock(ndefContext *ctx, uint16_t blockAddr, const uint8_t *buf);
+#endif /* NDEF_FEATURE_FULL_API */
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerReadSegment(ndefContext *ctx, uint8_t segment)
+{
+  ReturnCode           ret;
+  uint8_t              rxBuf[NDEF_T1T_RSEG_RESP_SIZE];
+  uint16_t             rcvdLen;
+  uint32_t             retry;
+
+  RfalNfcClass *rfal_nfc = ((NdefClass *)(ctx->ndef_class_instance))->rfal_nfc;
+
+  ndefT1TInvalidateCache(ctx);
+
+  retry = NDEF_T1T_N_RETRY_ERROR;
+  if (ctx->subCtx.t1t.dynamicMemory) {
+    /* One RSEG frame returns the 16 blocks of the segment */
+    do {
+      ret = rfal_nfc->rfalT1TPollerRseg(ctx->subCtx.t1t.uid, segment, rxBuf, (uint16_t)sizeof(rxBuf), &rcvdLen);
+    } while ((retry-- != 0U) && ndefT1TIsTransmissionError(ret));
+    if ((ret == ERR_NONE) && ((rcvdLen != NDEF_T1T_RSEG_RESP_SIZE) || (rxBuf[0] != (uint8_t)(segment << 4U)))) {
+      ret = ERR_PROTO;
+    }
+    if (ret == ERR_NONE) {
+      (void)ST_MEMCPY(ctx->subCtx.t1t.cacheBuf, &rxBuf[1], NDEF_T1T_SEGMENT_SIZE);
+    }
+  } else {
+    /* Static memory: one RALL frame returns HR0, HR1 and the whole memory */
+    if (segment != 0U) {
+      return ERR_PARAM;
+    }
+    do {
+      ret = rfal_nfc->rfalT1TPollerRall(ctx->subCtx.t1t.uid, rxBuf, (uint16_t)sizeof(rxBuf), &rcvdLen);
+    } while ((retry-- != 0U) && ndefT1TIsTransmissionError(ret));
+    if ((ret == ERR_NONE) && (rcvdLen != NDEF_T1T_RALL_RESP_SIZE)) {
+      ret = ERR_PROTO;
+    }
+    if (ret == ERR_NONE) {
+      (void)ST_MEMCPY(ctx->subCtx.t1t.cacheBuf, &rxBuf[RFAL_T1T_HR_LENGTH], NDEF_T1T_STATIC_MEM_SIZE);
+    }
+  }
+
+  if (ret == ERR_NONE) {
+    ctx->subCtx.t1t.cacheAddr = (uint32_t)segment * NDEF_T1T_SEGMENT_SIZE;
+  }
+  return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+{
+  ReturnCode           ret;
+  uint32_t             le;
+  uint32_t             lvOffset = offset;
+  uint32_t             lvLen    = len;
+  uint8_t             *lvBuf    = buf;
+  uint32_t             segAddr;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || (lvLen == 0U) || ((offset + len) > ndefT1TMemSize(ctx))) {
+    return ERR_PARAM;
+  }
+
+  do {
+    segAddr = (lvOffset / NDEF_T1T_SEGMENT_SIZE) * NDEF_T1T_SEGMENT_SIZE;
+    if (segAddr != ctx->subCtx.t1t.cacheAddr) {
+      ret = ndefT1TPollerReadSegment(ctx, (uint8_t)(lvOffset / NDEF_T1T_SEGMENT_SIZE));
+      if (ret != ERR_NONE) {
+        return ret;
+      }
+    }
+    le = MIN(lvLen, NDEF_T1T_SEGMENT_SIZE - (lvOffset - segAddr));
+    (void)ST_MEMCPY(lvBuf, &ctx->subCtx.t1t.cacheBuf[lvOffset - segAddr], le);
+
+    lvBuf     = &lvBuf[le];
+    lvOffset += le;
+    lvLen    -= le;
+
+  } while (lvLen != 0U);
+
+  if (rcvdLen != NULL) {
+    *rcvdLen = len;
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerSplitIntoAvailableAreas(ndefContext *ctx, uint32_t offset, uint32_t len, uint32_t *physOffset, uint32_t *maxLen)
+{
+  uint32_t updatedOffset;
+  uint32_t updatedLen;
+  uint32_t i;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || (physOffset == NULL) || (maxLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  updatedOffset = offset;
+  updatedLen    = len;
+
+  for (i = 0; i < ctx->subCtx.t1t.nbrRsvdAreas; i++) {
+    if (updatedOffset >= ctx->subCtx.t1t.rsvdAreaFirstByteAddr[i]) {
+      updatedOffset += ctx->subCtx.t1t.rsvdAreaSize[i];
+    } else {
+      if ((updatedOffset + len) > ctx->subCtx.t1t.rsvdAreaFirstByteAddr[i]) {
+        updatedLen = ctx->subCtx.t1t.rsvdAreaFirstByteAddr[i] - updatedOffset;
+      }
+      break;
+    }
+  }
+  *physOffset = updatedOffset;
+  *maxLen = updatedLen;
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerReadBytesFromAvailableAreas(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+{
+  ReturnCode ret;
+  uint32_t curOffset;
+  uint32_t curPhyOffset;
+  uint32_t remainingLen;
+  uint32_t curRcvdLen;
+  uint32_t maxLen;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  curOffset = offset;
+  remainingLen = len;
+  if (rcvdLen != NULL) {
+    *rcvdLen = 0U;
+  }
+  while (remainingLen > 0U) {
+    (void)ndefT1TPollerSplitIntoAvailableAreas(ctx, curOffset, remainingLen, &curPhyOffset, &maxLen);
+    ret = ndefT1TPollerReadBytes(ctx, curPhyOffset, maxLen, &buf[len - remainingLen], &curRcvdLen);
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+    if (rcvdLen != NULL) {
+      *rcvdLen += curRcvdLen;
+    }
+    remainingLen -= maxLen;
+    curOffset += maxLen;
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerReadMessageBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+{
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  return ndefT1TPollerReadBytesFromAvailableAreas(ctx, offset, len, buf, rcvdLen);
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TSetState(ndefContext *ctx)
+{
+  if (ctx->messageLen == 0U) {
+    if (!(ndefT1TIsReadWriteAccessGranted(ctx))) {
+      /* Conclude procedure  */
+      return ERR_REQUEST;
+    }
+    /* Empty message found */
+    ctx->state = NDEF_STATE_INITIALIZED;
+  } else {
+    if ((ndefT1TIsReadWriteAccessGranted(ctx))) {
+      ctx->state = NDEF_STATE_READWRITE;
+    } else {
+      if (!(ndefT1TIsReadOnlyAccessGranted(ctx))) {
+        /* Conclude procedure  */
+        return ERR_REQUEST;
+      }
+      ctx->state = NDEF_STATE_READONLY;
+    }
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TReadLField(ndefContext *ctx)
+{
+  ReturnCode           ret;
+  uint32_t             offset;
+  uint8_t              data[3];
+  uint16_t             lenTLV;
+
+  ctx->state = NDEF_STATE_INVALID;
+  offset = ctx->subCtx.t1t.offsetNdefTLV;
+  offset++;
+  ret = ndefT1TPollerReadBytesFromAvailableAreas(ctx, offset, 1, data, NULL);
+  if (ret != ERR_NONE) {
+    /* Conclude procedure */
+    return ret;
+  }
+  offset++;
+  lenTLV = data[0];
+  if (lenTLV == NDEF_T1T_3_BYTES_TLV_LEN) {
+    ret = ndefT1TPollerReadBytesFromAvailableAreas(ctx, offset, 2, data, NULL);
+    if (ret != ERR_NONE) {
+      /* Conclude procedure */
+      return ret;
+    }
+    offset += 2U;
+    lenTLV = GETU16(&data[0]);
+  }
+  ctx->messageLen    = lenTLV;
+  ctx->messageOffset = offset;
+
+  return ndefT1TSetState(ctx);
+}
+
+/*!
+ *****************************************************************************
+ * \brief Insert a reserved area, sorted by address, in the T1T sub context
+ *
+ * The area is clipped to the tag memory and its length accumulated in
+ * rsvdAreasLen. Areas starting beyond the tag memory are ignored.
+ *****************************************************************************
+ */
+static ReturnCode ndefT1TAddRsvdArea(ndefContext *ctx, uint32_t firstByteAddr, uint32_t size, uint32_t maxAddr, uint32_t *rsvdAreasLen)
+{
+  uint32_t i;
+  uint32_t j;
+
+  if (firstByteAddr >= maxAddr) {
+    return ERR_NONE;
+  }
+  if (ctx->subCtx.t1t.nbrRsvdAreas >= NDEF_T1T_MAX_RSVD_AREAS) {
+    return ERR_REQUEST;
+  }
+
+  for (i = 0; i < ctx->subCtx.t1t.nbrRsvdAreas; i++) {
+    if (firstByteAddr < ctx->subCtx.t1t.rsvdAreaFirstByteAddr[i]) {
+      break;
+    }
+  }
+  for (j = ctx->subCtx.t1t.nbrRsvdAreas; j > i; j--) {
+    ctx->subCtx.t1t.rsvdAreaFirstByteAddr[j] = ctx->subCtx.t1t.rsvdAreaFirstByteAddr[j - 1U];
+    ctx->subCtx.t1t.rsvdAreaSize[j]          = ctx->subCtx.t1t.rsvdAreaSize[j - 1U];
+  }
+  ctx->subCtx.t1t.rsvdAreaFirstByteAddr[i] = firstByteAddr;
+  ctx->subCtx.t1t.rsvdAreaSize[i]          = (uint16_t)(((firstByteAddr + size) > maxAddr) ? (maxAddr - firstByteAddr) : size);
+  *rsvdAreasLen += ctx->subCtx.t1t.rsvdAreaSize[i];
+  ctx->subCtx.t1t.nbrRsvdAreas++;
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerContextInitialization(ndefContext *ctx, const ndefDevice *dev)
+{
+  if ((ctx == NULL) || (dev == NULL) || !ndefT1TisT1TDevice(dev)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMCPY(&ctx->device, dev, sizeof(ctx->device));
+
+  ctx->type                     = NDEF_DEV_T1T;
+  ctx->state                    = NDEF_STATE_INVALID;
+  (void)ST_MEMCPY(ctx->subCtx.t1t.uid, dev->dev.nfca.ridRes.uid, RFAL_T1T_UID_LEN);
+  ctx->subCtx.t1t.hr0           = dev->dev.nfca.ridRes.hr0;
+  ctx->subCtx.t1t.dynamicMemory = ((ctx->subCtx.t1t.hr0 & 0x0FU) == RFAL_T1T_HR0_DYNAMIC_MEM);
+  ndefT1TInvalidateCache(ctx);
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerNdefDetect(ndefContext *ctx, ndefInfo *info)
+{
+  ReturnCode           ret;
+  uint8_t              data[3];
+  uint32_t             offset;
+  uint16_t             lenTLV;
+  uint8_t              typeTLV;
+  uint8_t              nbrMajorOffsets;
+  uint8_t              nbrMinorOffsets;
+  uint8_t              majorOffsetSize;
+  uint32_t             rsvdAreaFirstByteAddr;
+  uint32_t             maxAddr;
+  uint32_t             rsvdAreasLen;
+
+  if (info != NULL) {
+    info->state                = NDEF_STATE_INVALID;
+    info->majorVersion         = 0U;
+    info->minorVersion         = 0U;
+    info->areaLen              = 0U;
+    info->areaAvalableSpaceLen = 0U;
+    info->messageLen           = 0U;
+  }
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  ctx->state = NDEF_STATE_INVALID;
+
+  /* Read CC: static memory tags are fully read by this single RALL */
+  ndefT1TInvalidateCache(ctx);
+  ret = ndefT1TPollerReadBytes(ctx, NDEF_T1T_CC_OFFSET, NDEF_T1T_CC_LEN, ctx->ccBuf, NULL);
+  if (ret != ERR_NONE) {
+    /* Conclude procedure */
+    return ret;
+  }
+  ctx->cc.t1t.magicNumber   = ctx->ccBuf[NDEF_T1T_CC_0];
+  ctx->cc.t1t.majorVersion  = ndefMajorVersion(ctx->ccBuf[NDEF_T1T_CC_1]);
+  ctx->cc.t1t.minorVersion  = ndefMinorVersion(ctx->ccBuf[NDEF_T1T_CC_1]);
+  ctx->cc.t1t.tagMemorySize = (uint16_t)(((uint32_t)ctx->ccBuf[NDEF_T1T_CC_2] + 1U) * NDEF_T1T_SIZE_DIVIDER);
+  ctx->cc.t1t.readAccess    = (uint8_t)(ctx->ccBuf[NDEF_T1T_CC_3] >> 4U);
+  ctx->cc.t1t.writeAccess   = (uint8_t)(ctx->ccBuf[NDEF_T1T_CC_3] & 0xFU);
+
+  /* Check version number */
+  if ((ctx->cc.t1t.magicNumber != NDEF_T1T_MAGIC) || (ctx->cc.t1t.majorVersion > ndefMajorVersion(NDEF_T1T_VERSION_1_0))) {
+    /* Conclude procedure */
+    return ERR_REQUEST;
+  }
+
+  maxAddr = MIN((uint32_t)ctx->cc.t1t.tagMemorySize, ndefT1TMemSize(ctx));
+  ctx->areaLen = maxAddr - NDEF_T1T_AREA_OFFSET;
+  rsvdAreasLen = 0U;
+  ctx->subCtx.t1t.nbrRsvdAreas         = 0U;
+  ctx->subCtx.t1t.dynLockNbrLockBits   = 0U;
+  ctx->subCtx.t1t.dynLockFirstByteAddr = 0U;
+
+  /* Blocks 0Dh-0Fh (reserved, static lock and OTP) are never part of the T1T area */
+  (void)ndefT1TAddRsvdArea(ctx, NDEF_T1T_RSVD_OFFSET, NDEF_T1T_RSVD_LEN, maxAddr, &rsvdAreasLen);
+
+  /* Search for NDEF message TLV */
+  offset = NDEF_T1T_AREA_OFFSET;
+  while ((offset < (NDEF_T1T_AREA_OFFSET + ctx->areaLen - rsvdAreasLen))) {
+    ret = ndefT1TPollerReadBytesFromAvailableAreas(ctx, offset, 1, data, NULL);
+    if (ret != ERR_NONE) {
+      /* Conclude procedure */
+      return ret;
+    }
+    typeTLV = data[0];
+    if (typeTLV == NDEF_T1T_TLV_NDEF_MESSAGE) {
+      ctx->subCtx.t1t.offsetNdefTLV = offset;
+    }
+    offset++;
+    if (typeTLV == NDEF_T1T_TLV_TERMINATOR) {
+      break;
+    }
+    if (typeTLV == NDEF_T1T_TLV_NULL) {
+      continue;
+    }
+    /* read TLV Len */
+    ret = ndefT1TPollerReadBytesFromAvailableAreas(ctx, offset, 1, data, NULL);
+    if (ret != ERR_NONE) {
+      /* Conclude procedure */
+      return ret;
+    }
+    offset++;
+    lenTLV = data[0];
+    if (lenTLV == NDEF_T1T_3_BYTES_TLV_LEN) {
+      ret = ndefT1TPollerReadBytesFromAvailableAreas(ctx, offset, 2, data, NULL);
+      if (ret != ERR_NONE) {
+        /* Conclude procedure */
+        return ret;
+      }
+      offset += 2U;
+      lenTLV = GETU16(&data[0]);
+    }
+    if ((typeTLV == NDEF_T1T_TLV_LOCK_CTRL) || (typeTLV == NDEF_T1T_TLV_MEMORY_CTRL)) {
+      if (lenTLV != ((typeTLV == NDEF_T1T_TLV_LOCK_CTRL) ? NDEF_T1T_LOCK_CTRL_LEN : NDEF_T1T_MEM_CTRL_LEN)) {
+        offset += lenTLV;
+        continue;
+      }
+      ret = ndefT1TPollerReadBytesFromAvailableAreas(ctx, offset, lenTLV, data, NULL);
+      if (ret != ERR_NONE) {
+        /* Conclude procedure */
+        return ret;
+      }
+      nbrMajorOffsets = (uint8_t)(data[0] >> 4U);
+      nbrMinorOffsets = (uint8_t)(data[0] & 0x0FU);
+      majorOffsetSize = (uint8_t)(data[2] & 0x0FU);
+      if (majorOffsetSize == 0U) {
+        /* value 0h is RFU */
+        return ERR_REQUEST;
+      }
+      rsvdAreaFirstByteAddr = (nbrMajorOffsets * ((uint32_t)1U << majorOffsetSize)) + nbrMinorOffsets;
+      if (typeTLV == NDEF_T1T_TLV_LOCK_CTRL) {
+        /* Size is the number of dynamic lock bits */
+        ctx->subCtx.t1t.dynLockNbrLockBits   = (data[1] == 0U) ? 256U : (uint16_t)data[1];
+        ctx->subCtx.t1t.dynLockFirstByteAddr = rsvdAreaFirstByteAddr;
+        ret = ndefT1TAddRsvdArea(ctx, rsvdAreaFirstByteAddr, (ctx->subCtx.t1t.dynLockNbrLockBits + 7U) / 8U, maxAddr, &rsvdAreasLen);
+      } else {
+        /* Size is the number of reserved bytes */
+        ret = ndefT1TAddRsvdArea(ctx, rsvdAreaFirstByteAddr, (data[1] == 0U) ? 256U : (uint32_t)data[1], maxAddr, &rsvdAreasLen);
+      }
+      if (ret != ERR_NONE) {
+        return ret;
+      }
+    }
+    /* NDEF message present TLV */
+    if (typeTLV == NDEF_T1T_TLV_NDEF_MESSAGE) {
+      /* Read length */
+      ctx->messageLen    = lenTLV;
+      ctx->messageOffset = offset;
+      ret = ndefT1TSetState(ctx);
+      if (ret != ERR_NONE) {
+        return ret;
+      }
+      ctx->areaLen -= rsvdAreasLen;
+      if (info != NULL) {
+        info->state                = ctx->state;
+        info->majorVersion         = ctx->cc.t1t.majorVersion;
+        info->minorVersion         = ctx->cc.t1t.minorVersion;
+        info->areaLen              = ctx->areaLen;
+        info->areaAvalableSpaceLen = ctx->areaLen - ctx->messageOffset;
+        info->messageLen           = ctx->messageLen;
+      }
+      return ERR_NONE;
+    }
+    offset += lenTLV;
+  }
+  return ERR_REQUEST;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerReadRawMessage(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen, bool single)
+{
+  ReturnCode ret;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  /* T1T NDEF Detect should have been called at least once before NDEF read procedure */
+
+  if (! single) {
+    ndefT1TInvalidateCache(ctx);
+    ret = ndefT1TReadLField(ctx);
+    if (ret != ERR_NONE) {
+      /* Conclude procedure */
+      return ret;
+    }
+  }
+
+  /* Check presence of NDEF message */
+  if (ctx->state <= NDEF_STATE_INITIALIZED) {
+    /* Conclude procedure */
+    return ERR_WRONG_STATE;
+  }
+
+  if (ctx->messageLen > bufLen) {
+    return ERR_NOMEM;
+  }
+
+  ret = ndefT1TPollerReadBytesFromAvailableAreas(ctx, ctx->messageOffset, ctx->messageLen, buf, rcvdLen);
+  if (ret != ERR_NONE) {
+    ctx->state = NDEF_STATE_INVALID;
+  }
+  return ret;
+}
+
+#if NDEF_FEATURE_FULL_API
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerWriteBlock(ndefContext *ctx, uint16_t blockAddr, const uint8_t *buf)
+{
+  ReturnCode ret;
+  uint32_t   addr;
+  uint32_t   segAddr;
+  uint32_t   retry;
+  uint8_t    i;
+  bool       cached;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  RfalNfcClass *rfal_nfc = ((NdefClass *)(ctx->ndef_class_instance))->rfal_nfc;
+
+  addr    = (uint32_t)blockAddr * NDEF_T1T_BLOCK_SIZE;
+  segAddr = (addr / NDEF_T1T_SEGMENT_SIZE) * NDEF_T1T_SEGMENT_SIZE;
+  cached  = (segAddr == ctx->subCtx.t1t.cacheAddr);
+
+  if (ctx->subCtx.t1t.dynamicMemory) {
+    /* One WRITE-E8 frame per block */
+    retry = NDEF_T1T_N_RETRY_ERROR;
+    do {
+      ret = rfal_nfc->rfalT1TPollerWriteE8(ctx->subCtx.t1t.uid, (uint8_t)blockAddr, buf);
+    } while ((retry-- != 0U) && ndefT1TIsTransmissionError(ret));
+    if (ret != ERR_NONE) {
+      ndefT1TInvalidateCache(ctx);
+      return ret;
+    }
+  } else {
+    /* Static memory only supports single byte WRITE-E: skip the unchanged bytes */
+    for (i = 0U; i < NDEF_T1T_BLOCK_SIZE; i++) {
+      if (cached && (ctx->subCtx.t1t.cacheBuf[(addr - segAddr) + i] == buf[i])) {
+        continue;
+      }
+      retry = NDEF_T1T_N_RETRY_ERROR;
+      do {
+        ret = rfal_nfc->rfalT1TPollerWrite(ctx->subCtx.t1t.uid, (uint8_t)(addr + i), buf[i]);
+      } while ((retry-- != 0U) && ndefT1TIsTransmissionError(ret));
+      if (ret != ERR_NONE) {
+        ndefT1TInvalidateCache(ctx);
+        return ret;
+      }
+    }
+  }
+
+  if (cached) {
+    (void)ST_MEMCPY(&ctx->subCtx.t1t.cacheBuf[addr - segAddr], buf, NDEF_T1T_BLOCK_SIZE);
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator)
+{
+  ReturnCode           ret;
+  uint32_t             lvOffset = offset;
+  uint32_t             lvLen    = len;
+  const uint8_t       *lvBuf    = buf;
+  uint16_t             blockAddr;
+  uint8_t              byteNo;
+  uint8_t              le;
+  uint8_t              tempBuf[NDEF_T1T_BLOCK_SIZE];
+  bool                 lvWriteTerminator = writeTerminator;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || (lvLen == 0U) || ((offset + len) > ndefT1TMemSize(ctx))) {
+    return ERR_PARAM;
+  }
+
+  do {
+    blockAddr = (uint16_t)(lvOffset / NDEF_T1T_BLOCK_SIZE);
+    byteNo    = (uint8_t)(lvOffset % NDEF_T1T_BLOCK_SIZE);
+    le = (lvLen < NDEF_T1T_BLOCK_SIZE) ? (uint8_t)lvLen : (uint8_t)NDEF_T1T_BLOCK_SIZE;
+    if ((byteNo != 0U) || (lvLen < NDEF_T1T_BLOCK_SIZE) || !ctx->subCtx.t1t.dynamicMemory) {
+      /* Partial block, or static memory where the current content avoids rewriting unchanged bytes */
+      if ((byteNo != 0U) || !pad || !ctx->subCtx.t1t.dynamicMemory) {
+        ret = ndefT1TPollerReadBytes(ctx, (uint32_t)blockAddr * NDEF_T1T_BLOCK_SIZE, NDEF_T1T_BLOCK_SIZE, tempBuf, NULL);
+        if (ret != ERR_NONE) {
+          return ret;
+        }
+      }
+      if ((byteNo + lvLen) < NDEF_T1T_BLOCK_SIZE) {
+        if (pad) {
+          (void)ST_MEMSET(&tempBuf[byteNo + lvLen], 0x00, NDEF_T1T_BLOCK_SIZE - (byteNo + lvLen));
+        }
+        if (lvWriteTerminator) {
+          tempBuf[byteNo + lvLen] = NDEF_T1T_TLV_TERMINATOR;
+          lvWriteTerminator = false;
+        }
+      }
+      if ((NDEF_T1T_BLOCK_SIZE - byteNo) < le) {
+        le = NDEF_T1T_BLOCK_SIZE - byteNo;
+      }
+      if (le > 0U) {
+        (void)ST_MEMCPY(&tempBuf[byteNo], lvBuf, le);
+      }
+      ret = ndefT1TPollerWriteBlock(ctx, blockAddr, tempBuf);
+      if (ret != ERR_NONE) {
+        return ret;
+      }
+    } else {
+      ret = ndefT1TPollerWriteBlock(ctx, blockAddr, lvBuf);
+      if (ret != ERR_NONE) {
+        return ret;
+      }
+    }
+    lvBuf     = &lvBuf[le];
+    lvOffset += le;
+    lvLen    -= le;
+
+  } while (lvLen != 0U);
+  if (lvWriteTerminator) {
+    blockAddr++;
+    (void)ST_MEMSET(tempBuf, 0x00, NDEF_T1T_BLOCK_SIZE);
+    tempBuf[0] = NDEF_T1T_TLV_TERMINATOR;
+    (void)ndefT1TPollerWriteBlock(ctx, blockAddr, tempBuf);
+  }
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+static ReturnCode ndefT1TPollerWriteBytesToAvailableAreas(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator)
+{
+  ReturnCode ret;
+  uint32_t curOffset;
+  uint32_t curPhyOffset;
+  uint32_t remainingLen;
+  uint32_t maxLen;
+  uint32_t maxLenTerm;
+  bool     term = false;
+  bool     lvWriteTerminator = writeTerminator;
+  uint8_t  termBuf[1];
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+  curOffset = offset;
+  remainingLen = len;
+
+  while (remainingLen > 0U) {
+    (void)ndefT1TPollerSplitIntoAvailableAreas(ctx, curOffset, remainingLen, &curPhyOffset, &maxLen);
+    if ((remainingLen == maxLen) &&  writeTerminator) { /* last part */
+      (void)ndefT1TPollerSplitIntoAvailableAreas(ctx, curOffset, remainingLen + 1U, &curPhyOffset, &maxLenTerm);
+      if ((remainingLen + 1U) == maxLenTerm) { /* check enough room for terminator in that area */
+        term = true;
+        lvWriteTerminator = false;
+      }
+    }
+    ret = ndefT1TPollerWriteBytes(ctx, curPhyOffset, &buf[len - remainingLen], maxLen, (remainingLen == maxLen) && pad, term);
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+    remainingLen -= maxLen;
+    curOffset += maxLen;
+  }
+  if (lvWriteTerminator) {
+    (void)ndefT1TPollerSplitIntoAvailableAreas(ctx, curOffset, 1U, &curPhyOffset, &maxLen);
+    termBuf[0] = NDEF_T1T_TLV_TERMINATOR;
+    (void)ndefT1TPollerWriteBytes(ctx, curPhyOffset, termBuf, 1U, pad, false);
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerWriteMessageBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator)
+{
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  return ndefT1TPollerWriteBytesToAvailableAreas(ctx, offset, buf, len, pad, writeTerminator);
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerWriteRawMessageLen(ndefContext *ctx, uint32_t rawMessageLen, bool writeTerminator)
+{
+  ReturnCode           ret;
+  uint8_t              buf[NDEF_T1T_BLOCK_SIZE];
+  uint8_t              dataIt;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  if ((ctx->state != NDEF_STATE_INITIALIZED) && (ctx->state != NDEF_STATE_READWRITE)) {
+    return ERR_WRONG_STATE;
+  }
+
+  if (writeTerminator && (rawMessageLen != 0U) && ((ctx->messageOffset + rawMessageLen) < (ctx->areaLen + NDEF_T1T_AREA_OFFSET))) {
+    /* Write Terminator TLV */
+    dataIt = 0U;
+    buf[dataIt] = NDEF_T1T_TLV_TERMINATOR;
+    dataIt++;
+    ret = ndefT1TPollerWriteBytesToAvailableAreas(ctx, ctx->messageOffset + rawMessageLen, buf, dataIt, true, false);
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+  }
+
+  dataIt = 0U;
+  buf[dataIt] = NDEF_T1T_TLV_NDEF_MESSAGE;
+  dataIt++;
+  if (rawMessageLen <= NDEF_SHORT_VFIELD_MAX_LEN) {
+    buf[dataIt] = (uint8_t) rawMessageLen;
+    dataIt++;
+    if ((rawMessageLen == 0U) && writeTerminator) {
+      buf[dataIt] = NDEF_T1T_TLV_TERMINATOR;
+      dataIt++;
+    }
+  } else {
+    buf[dataIt] = (uint8_t)(NDEF_SHORT_VFIELD_MAX_LEN + 1U);
+    dataIt++;
+    buf[dataIt] = (uint8_t)(rawMessageLen >> 8U);
+    dataIt++;
+    buf[dataIt] = (uint8_t) rawMessageLen;
+    dataIt++;
+  }
+
+  ret = ndefT1TPollerWriteBytesToAvailableAreas(ctx, ctx->subCtx.t1t.offsetNdefTLV, buf, dataIt, writeTerminator && (rawMessageLen == 0U), false);
+  return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerWriteRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen)
+{
+  ReturnCode ret;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T) || ((buf == NULL) && (bufLen != 0U))) {
+    return ERR_PARAM;
+  }
+
+  /* T1T NDEF Detect should have been called before NDEF write procedure */
+  /* Warning: current tag content must not be changed between NDEF Detect procedure and NDEF Write procedure*/
+
+  /* Check write access condition */
+  if ((ctx->state != NDEF_STATE_INITIALIZED) && (ctx->state != NDEF_STATE_READWRITE)) {
+    /* Conclude procedure */
+    return ERR_WRONG_STATE;
+  }
+
+  /* Verify available space */
+  ret = ndefT1TPollerCheckAvailableSpace(ctx, bufLen);
+  if (ret != ERR_NONE) {
+    /* Conclude procedures */
+    return ERR_PARAM;
+  }
+
+  /* Reset L_Field to 0 and update ctx->messageOffset according to L-field len */
+  ret = ndefT1TPollerBeginWriteMessage(ctx, bufLen);
+  if (ret != ERR_NONE) {
+    ctx->state = NDEF_STATE_INVALID;
+    /* Conclude procedure */
+    return ret;
+  }
+
+  if (bufLen != 0U) {
+    /* Write new NDEF message */
+    ret = ndefT1TPollerWriteBytesToAvailableAreas(ctx, ctx->messageOffset, buf, bufLen, true, ndefT1TPollerCheckAvailableSpace(ctx, bufLen + 1U) == ERR_NONE);
+    if (ret != ERR_NONE) {
+      /* Conclude procedure */
+      ctx->state = NDEF_STATE_INVALID;
+      return ret;
+    }
+
+    /* Update L_Field and write Terminator TLV */
+    ret = ndefT1TPollerEndWriteMessage(ctx, bufLen, false);
+    if (ret != ERR_NONE) {
+      /* Conclude procedure */
+      ctx->state = NDEF_STATE_INVALID;
+      return ret;
+    }
+  }
+
+  return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerTagFormat(ndefContext *ctx, const ndefCapabilityContainer *cc, uint32_t options)
+{
+  ReturnCode           ret;
+  uint8_t              dataIt;
+  uint8_t              data[2];
+  uint32_t             offset;
+  static const uint8_t emptyNdef[] = {NDEF_T1T_TLV_NDEF_MESSAGE, 0x00U, NDEF_T1T_TLV_TERMINATOR};
+
+  NO_WARNING(options);
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  /*
+   * Read CC area
+   */
+  ndefT1TInvalidateCache(ctx);
+  ret = ndefT1TPollerReadBytes(ctx, NDEF_T1T_CC_OFFSET, NDEF_T1T_CC_LEN, ctx->ccBuf, NULL);
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  /*
+   * Write CC only in case of virgin CC area
+   */
+  if ((ctx->ccBuf[NDEF_T1T_CC_0] == 0U) && (ctx->ccBuf[NDEF_T1T_CC_1] == 0U) && (ctx->ccBuf[NDEF_T1T_CC_2] == 0U) && (ctx->ccBuf[NDEF_T1T_CC_3] == 0U)) {
+    dataIt = 0U;
+    if (cc == NULL) {
+      /* Use default values if no cc provided */
+      ctx->ccBuf[dataIt] = NDEF_T1T_MAGIC;
+      dataIt++;
+      ctx->ccBuf[dataIt] = NDEF_T1T_VERSION_1_0;
+      dataIt++;
+      ctx->ccBuf[dataIt] = ctx->subCtx.t1t.dynamicMemory ? NDEF_T1T_TMS_DYNAMIC : NDEF_T1T_TMS_STATIC;
+      dataIt++;
+      ctx->ccBuf[dataIt] = 0x00U;
+      dataIt++;
+    } else {
+      ctx->ccBuf[dataIt] = cc->t1t.magicNumber;
+      dataIt++;
+      ctx->ccBuf[dataIt] = (uint8_t)(cc->t1t.majorVersion << 4U) | cc->t1t.minorVersion;
+      dataIt++;
+      ctx->ccBuf[dataIt] = (uint8_t)((cc->t1t.tagMemorySize / NDEF_T1T_SIZE_DIVIDER) - 1U);
+      dataIt++;
+      ctx->ccBuf[dataIt] = (uint8_t)(cc->t1t.readAccess << 4U) | cc->t1t.writeAccess;
+      dataIt++;
+    }
+    ret = ndefT1TPollerWriteBytes(ctx, NDEF_T1T_CC_OFFSET, ctx->ccBuf, NDEF_T1T_CC_LEN, false, false);
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+  }
+
+  /*
+   * Skip the Lock/Memory Control TLVs the tag is delivered with
+   */
+  offset = NDEF_T1T_AREA_OFFSET;
+  while ((offset + sizeof(data)) <= NDEF_T1T_RSVD_OFFSET) {
+    ret = ndefT1TPollerReadBytes(ctx, offset, sizeof(data), data, NULL);
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+    if (data[0] == NDEF_T1T_TLV_NULL) {
+      offset++;
+    } else if ((data[0] == NDEF_T1T_TLV_LOCK_CTRL) || (data[0] == NDEF_T1T_TLV_MEMORY_CTRL)) {
+      offset += (uint32_t)NDEF_T1T_TLV_T_LEN + NDEF_T1T_TLV_L_1_BYTES_LEN + data[1];
+    } else {
+      break;
+    }
+  }
+  if ((offset + sizeof(emptyNdef)) > NDEF_T1T_RSVD_OFFSET) {
+    return ERR_REQUEST;
+  }
+
+  /*
+   * Write NDEF place holder
+   */
+  ret = ndefT1TPollerWriteBytes(ctx, offset, emptyNdef, sizeof(emptyNdef), false, false);
+
+  return ret;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerCheckPresence(ndefContext *ctx)
+{
+  ReturnCode    ret;
+  rfalT1TRidRes ridRes;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  RfalNfcClass *rfal_nfc = ((NdefClass *)(ctx->ndef_class_instance))->rfal_nfc;
+
+  ret = rfal_nfc->rfalT1TPollerRid(&ridRes);
+  if (ret != ERR_NONE) {
+    ndefT1TInvalidateCache(ctx);
+    return ret;
+  }
+  if (ST_BYTECMP(ridRes.uid, ctx->subCtx.t1t.uid, RFAL_T1T_UID_LEN) != 0) {
+    ndefT1TInvalidateCache(ctx);
+    return ERR_PROTO;
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerCheckAvailableSpace(const ndefContext *ctx, uint32_t messageLen)
+{
+  uint32_t lLen;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  if (ctx->state == NDEF_STATE_INVALID) {
+    return ERR_WRONG_STATE;
+  }
+
+  lLen = (messageLen > NDEF_SHORT_VFIELD_MAX_LEN) ? NDEF_T1T_TLV_L_3_BYTES_LEN : NDEF_T1T_TLV_L_1_BYTES_LEN;
+
+  if ((messageLen + ctx->subCtx.t1t.offsetNdefTLV + NDEF_T1T_TLV_T_LEN + lLen) > (ctx->areaLen + NDEF_T1T_AREA_OFFSET)) {
+    return ERR_NOMEM;
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerBeginWriteMessage(ndefContext *ctx, uint32_t messageLen)
+{
+  ReturnCode ret;
+  uint32_t   lLen;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  if ((ctx->state != NDEF_STATE_INITIALIZED) && (ctx->state != NDEF_STATE_READWRITE)) {
+    return ERR_WRONG_STATE;
+  }
+
+  /* Reset L_Field to 0 */
+  ret = ndefT1TPollerWriteRawMessageLen(ctx, 0U, true);
+  if (ret != ERR_NONE) {
+    /* Conclude procedure */
+    ctx->state = NDEF_STATE_INVALID;
+    return ret;
+  }
+
+  lLen = (messageLen > NDEF_SHORT_VFIELD_MAX_LEN) ? NDEF_T1T_TLV_L_3_BYTES_LEN : NDEF_T1T_TLV_L_1_BYTES_LEN;
+  ctx->messageOffset  = ctx->subCtx.t1t.offsetNdefTLV;
+  ctx->messageOffset += NDEF_T1T_TLV_T_LEN; /* T Len */
+  ctx->messageOffset += lLen;               /* L Len */
+
+  ctx->state = NDEF_STATE_INITIALIZED;
+
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerEndWriteMessage(ndefContext *ctx, uint32_t messageLen, bool writeTerminator)
+{
+  ReturnCode ret;
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  if (ctx->state != NDEF_STATE_INITIALIZED) {
+    return ERR_WRONG_STATE;
+  }
+
+  /* Update L_Field and write Terminator TLV */
+  ret = ndefT1TPollerWriteRawMessageLen(ctx, messageLen, writeTerminator);
+  if (ret != ERR_NONE) {
+    /* Conclude procedure */
+    ctx->state = NDEF_STATE_INVALID;
+    return ret;
+  }
+  ctx->messageLen = messageLen;
+  ctx->state = (ctx->messageLen == 0U) ? NDEF_STATE_INITIALIZED : NDEF_STATE_READWRITE;
+  return ERR_NONE;
+}
+
+/*!
+ *****************************************************************************
+ * \brief Set lock bits
+ *
+ * On dynamic memory tags the lock bits are set with WRITE-NE8: the bits
+ * already set and the neighbouring bytes of the block (OTP) are kept as is.
+ *****************************************************************************
+ */
+static ReturnCode ndefT1TPollerSetLockBits(ndefContext *ctx, uint32_t offset, const uint8_t *bits, uint32_t len)
+{
+  ReturnCode ret;
+  uint8_t    tempBuf[NDEF_T1T_BLOCK_SIZE];
+  uint32_t   lvOffset = offset;
+  uint32_t   lvLen    = len;
+  uint32_t   byteNo;
+  uint32_t   le;
+  uint32_t   retry;
+
+  if (!ctx->subCtx.t1t.dynamicMemory) {
+    return ndefT1TPollerWriteBytes(ctx, offset, bits, len, false, false);
+  }
+
+  RfalNfcClass *rfal_nfc = ((NdefClass *)(ctx->ndef_class_instance))->rfal_nfc;
+
+  ndefT1TInvalidateCache(ctx);
+  while (lvLen != 0U) {
+    byteNo = lvOffset % NDEF_T1T_BLOCK_SIZE;
+    le     = MIN(lvLen, NDEF_T1T_BLOCK_SIZE - byteNo);
+    (void)ST_MEMSET(tempBuf, 0x00, NDEF_T1T_BLOCK_SIZE);
+    (void)ST_MEMCPY(&tempBuf[byteNo], &bits[len - lvLen], le);
+    retry = NDEF_T1T_N_RETRY_ERROR;
+    do {
+      ret = rfal_nfc->rfalT1TPollerWriteNE8(ctx->subCtx.t1t.uid, (uint8_t)(lvOffset / NDEF_T1T_BLOCK_SIZE), tempBuf);
+    } while ((retry-- != 0U) && ndefT1TIsTransmissionError(ret));
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+    lvOffset += le;
+    lvLen    -= le;
+  }
+  return ERR_NONE;
+}
+
+/*******************************************************************************/
+ReturnCode ndefT1TPollerSetReadOnly(ndefContext *ctx)
+{
+  ReturnCode ret;
+  uint8_t    dynLockBits[NDEF_T1T_DYN_LOCK_BYTES_MAX];
+  uint32_t   nbrDynLockBytes;
+  uint32_t   i;
+
+  static const uint8_t staticBits[NDEF_T1T_STATLOCK_LEN] = {0xFF, 0xFF};
+
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T1T)) {
+    return ERR_PARAM;
+  }
+
+  if (ctx->state != NDEF_STATE_READWRITE) {
+    return ERR_WRONG_STATE;
+  }
+
+  /* Set the Access Conditions for Write (in the lower nibble) of CC_3 to Fh */
+  ctx->cc.t1t.writeAccess = NDEF_T1T_WR_ACCESS_NONE;
+  ctx->ccBuf[NDEF_T1T_CC_3] |= ctx->cc.t1t.writeAccess;
+  ret = ndefT1TPollerWriteBytes(ctx, NDEF_T1T_CC_OFFSET + NDEF_T1T_CC_3, &ctx->ccBuf[NDEF_T1T_CC_3], 1U, false, false);
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  /* Set all Static Lock bits to 1b */
+  ret = ndefT1TPollerSetLockBits(ctx, NDEF_T1T_STATLOCK_OFFSET, staticBits, sizeof(staticBits));
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  /* Set all Dynamic Lock bits to 1b */
+  if (ctx->subCtx.t1t.dynLockNbrLockBits != 0U) {
+    nbrDynLockBytes = MIN(((uint32_t)ctx->subCtx.t1t.dynLockNbrLockBits + 7U) / 8U, NDEF_T1T_DYN_LOCK_BYTES_MAX);
+    for (i = 0; i < nbrDynLockBytes; i++) {
+      dynLockBits[i] = 0xFFU;
+    }
+    if ((ctx->subCtx.t1t.dynLockNbrLockBits % 8U) != 0U) {
+      dynLockBits[nbrDynLockBytes - 1U] = (uint8_t)((1U << (ctx->subCtx.t1t.dynLockNbrLockBits % 8U)) - 1U);
+    }
+    ret = ndefT1TPollerSetLockBits(ctx, ctx->subCtx.t1t.dynLockFirstByteAddr, dynLockBits, nbrDynLockBytes);
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+  }
+
+  ctx->state = NDEF_STATE_READONLY;
+  return ERR_NONE;
+}
+
+#endif /* NDEF_FEATURE_FULL_API */
+
+#endif /* NDEF_FEATURE_T1T */
@@ -0,0 +1,382 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_t1t.h
+  * @brief          : Provides NDEF methods and definitions to access NFC Forum T1T
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+
+#ifndef NDEF_T1T_H
+#define NDEF_T1T_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+#include "ndef_poller.h"
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL MACROS
+ ******************************************************************************
+ */
+
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+/*!
+ *****************************************************************************
+ * \brief Handle T1T NDEF context activation
+ *
+ * This method performs the initialization of the NDEF context from the
+ * RID_RES of the device (UID and HR0 memory type). It must be called after
+ * a successful anti-collision procedure and prior to any NDEF procedures
+ * such as NDEF detection procedure.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   dev    : ndef Device
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerContextInitialization(ndefContext *ctx, const ndefDevice *dev);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T NDEF Detection procedure
+ *
+ * This method performs the T1T NDEF Detection procedure
+ *
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[out]  info   : ndef Information (optional parameter, NULL may be used when no NDEF Information is needed)
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : Detection failed (application or ccfile not found)
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerNdefDetect(ndefContext *ctx, ndefInfo *info);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Read data from tag memory
+ *
+ * This method reads arbitrary length data from the tag memory. Static
+ * memory tags are read with one RALL, dynamic memory tags segment by
+ * segment with RSEG (128 bytes per frame); the last one is cached.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   len    : requested length
+ * \param[in]   offset : file offset of where to start reading data
+ * \param[out]  buf    : buffer to place the data read from the tag
+ * \param[out]  rcvdLen: received length
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Read data from the NDEF storage area
+ *
+ * This method reads data at an offset of the NDEF storage area, i.e. skipping
+ * the lock and reserved areas, as used by ctx->messageOffset
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   offset : offset in the NDEF storage area
+ * \param[in]   len    : requested length
+ * \param[out]  buf    : buffer to place the data read from the tag
+ * \param[out]  rcvdLen: received length
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerReadMessageBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T write data to tag memory
+ *
+ * This method writes arbitrary length data to the tag memory. Dynamic
+ * memory tags are written block by block with WRITE-E8 (8 bytes per
+ * frame), static memory tags byte by byte with WRITE-E, skipping the
+ * bytes whose content is unchanged.
+ *
+ * \param[in]   ctx            : ndef Context
+ * \param[in]   offset         : file offset of where to start writing data
+ * \param[in]   buf            : data to write
+ * \param[in]   len            : buf length
+ * \param[in]   pad            : pad remaining bytes of last modified block with 0s
+ * \param[in]   writeTerminator: write Terminator TLV after data
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Write data to the NDEF storage area
+ *
+ * This method writes data at an offset of the NDEF storage area, i.e.
+ * skipping the lock and reserved areas, as used by ctx->messageOffset
+ *
+ * \param[in]   ctx            : ndef Context
+ * \param[in]   offset         : offset in the NDEF storage area
+ * \param[in]   buf            : data to write
+ * \param[in]   len            : buf length
+ * \param[in]   pad            : pad remaining bytes of last modified block with 0s
+ * \param[in]   writeTerminator: write Terminator TLV after data
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerWriteMessageBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Read raw NDEF message
+ *
+ * This method reads a raw NDEF message from the tag.
+ * Prior to NDEF Read procedure, a successful ndefT1TPollerNdefDetect()
+ * has to be performed.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[out]  buf    : buffer to place the NDEF message
+ * \param[in]   bufLen : buffer length
+ * \param[out]  rcvdLen: received length
+ * \param[in]   single : performs the procedure as part of a single NDEF read operation
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerReadRawMessage(ndefContext *ctx, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen, bool single);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Write raw NDEF message
+ *
+ * This method writes a raw NDEF message in the tag.
+ * Prior to NDEF Write procedure, a successful ndefT1TPollerNdefDetect()
+ * has to be performed.
+ *
+ * \warning Current tag content must not be changed between NDEF Detect
+ * procedure and NDEF Write procedure.
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   buf    : raw message buffer
+ * \param[in]   bufLen : buffer length
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerWriteRawMessage(ndefContext *ctx, const uint8_t *buf, uint32_t bufLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Write NDEF message length
+ *
+ * This method writes the L-field of the NDEF Message TLV.
+ *
+ * \param[in]   ctx            : ndef Context
+ * \param[in]   rawMessageLen  : len
+ * \param[in]   writeTerminator: write Terminator TLV after data
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerWriteRawMessageLen(ndefContext *ctx, uint32_t rawMessageLen, bool writeTerminator);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Format Tag
+ *
+ * This method formats a tag to make it ready for NDEF storage.
+ * The Capability Container block is written only for virgin tags.
+ * If the cc parameter is not provided (i.e. NULL), a default one is used
+ * with the whole tag memory (TMS 0Eh for static memory tags, 3Fh for
+ * dynamic memory tags i.e. Topaz 512). The empty NDEF TLV is written after
+ * the Lock/Memory Control TLVs already present.
+ * Beware that formatting is on most tags a one time operation (OTP bits!!!!)
+ * Doing a wrong format may render your tag unusable.
+ * options parameter is not used for T1T Tag Format method
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   cc     : Capability Container
+ * \param[in]   options: specific flags
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerTagFormat(ndefContext *ctx, const ndefCapabilityContainer *cc, uint32_t options);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Check Presence
+ *
+ * This method checks whether a T1T tag is still present in the operating field
+ *
+ * \param[in]   ctx    : ndef Context
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerCheckPresence(ndefContext *ctx);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Check Available Space
+ *
+ * This method checks whether a T1T tag has enough space to write a message of a given length
+ *
+ * \param[in]   ctx       : ndef Context
+ * \param[in]   messageLen: message length
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOMEM        : not enough space
+ * \return ERR_NONE         : Enough space for message of messageLen length
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerCheckAvailableSpace(const ndefContext *ctx, uint32_t messageLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Begin Write Message
+ *
+ * This method sets the L-field to 0 and sets the message offset to the proper value according to messageLen
+ *
+ * \param[in]   ctx       : ndef Context
+ * \param[in]   messageLen: message length
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOMEM        : not enough space
+ * \return ERR_NONE         : Enough space for message of messageLen length
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerBeginWriteMessage(ndefContext *ctx, uint32_t messageLen);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T End Write Message
+ *
+ * This method updates the L-field value after the message has been written
+ *
+ * \param[in]   ctx            : ndef Context
+ * \param[in]   messageLen     : message length
+ * \param[in]   writeTerminator: write Terminator TLV after data
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NOMEM        : not enough space
+ * \return ERR_NONE         : Enough space for message of messageLen length
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerEndWriteMessage(ndefContext *ctx, uint32_t messageLen, bool writeTerminator);
+
+
+/*!
+ *****************************************************************************
+ * \brief T1T Set Read Only
+ *
+ * This method perform the transition from the READ/WRITE state to the READ-ONLY state:
+ * the CC write access is set to Fh, then the static and dynamic lock bits are set
+ *
+ * \param[in]   ctx       : ndef Context
+ *
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT1TPollerSetReadOnly(ndefContext *ctx);
+
+
+
+#endif /* NDEF_T1T_H */
+
+/**
+  * @}
+  */
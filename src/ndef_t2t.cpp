@@ -317,6 +317,16 @@ static ReturnCode ndefT2TPollerReadBytesFromAvailableAreas(ndefContext *ctx, uin
   return ERR_NONE;
 }
 
+/*******************************************************************************/
+ReturnCode ndefT2TPollerReadMessageBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen)
+{
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T2T) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  return ndefT2TPollerReadBytesFromAvailableAreas(ctx, offset, len, buf, rcvdLen);
+}
+
 /*******************************************************************************/
 static ReturnCode ndefT2TReadLField(ndefContext *ctx)
 {
@@ -792,6 +802,16 @@ static ReturnCode ndefT2TPollerWriteBytesToAvailableAreas(ndefContext *ctx, uint
   return ERR_NONE;
 }
 
+/*******************************************************************************/
+ReturnCode ndefT2TPollerWriteMessageBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator)
+{
+  if ((ctx == NULL) || (ctx->type != NDEF_DEV_T2T) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  return ndefT2TPollerWriteBytesToAvailableAreas(ctx, offset, buf, len, pad, writeTerminator);
+}
+
 /*******************************************************************************/
 ReturnCode ndefT2TPollerWriteRawMessageLen(ndefContext *ctx, uint32_t rawMessageLen, bool writeTerminator)
 {
@@ -117,6 +117,29 @@ ReturnCode ndefT2TPollerNdefDetect(ndefContext *ctx, ndefInfo *info);
 ReturnCode ndefT2TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen);
 
 
+/*!
+ *****************************************************************************
+ * \brief T2T Read data from the NDEF storage area
+ *
+ * This method reads data at an offset of the NDEF storage area, i.e. skipping
+ * the lock and reserved areas, as used by ctx->messageOffset
+ *
+ * \param[in]   ctx    : ndef Context
+ * \param[in]   offset : offset in the NDEF storage area
+ * \param[in]   len    : requested length
+ * \param[out]  buf    : buffer to place the data read from the tag
+ * \param[out]  rcvdLen: received length
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : read failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT2TPollerReadMessageBytes(ndefContext *ctx, uint32_t offset, uint32_t len, uint8_t *buf, uint32_t *rcvdLen);
+
+
 /*!
  *****************************************************************************
  * \brief T2T write data to tag memory
@@ -140,6 +163,30 @@ ReturnCode ndefT2TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t le
 ReturnCode ndefT2TPollerWriteBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator);
 
 
+/*!
+ *****************************************************************************
+ * \brief T2T Write data to the NDEF storage area
+ *
+ * This method writes data at an offset of the NDEF storage area, i.e.
+ * skipping the lock and reserved areas, as used by ctx->messageOffset
+ *
+ * \param[in]   ctx            : ndef Context
+ * \param[in]   offset         : offset in the NDEF storage area
+ * \param[in]   buf            : data to write
+ * \param[in]   len            : buf length
+ * \param[in]   pad            : pad remaining bytes of last modified block with 0s
+ * \param[in]   writeTerminator: write Terminator TLV after data
+ *
+ * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+ * \return ERR_REQUEST      : write failed
+ * \return ERR_PARAM        : Invalid parameter
+ * \return ERR_PROTO        : Protocol error
+ * \return ERR_NONE         : No error
+ *****************************************************************************
+ */
+ReturnCode ndefT2TPollerWriteMessageBytes(ndefContext *ctx, uint32_t offset, const uint8_t *buf, uint32_t len, bool pad, bool writeTerminator);
+
+
 /*!
  *****************************************************************************
  * \brief T2T Read raw NDEF message
@@ -203,7 +203,7 @@ ReturnCode ndefT3TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t le
         nbRead = (uint16_t) currentLen;
       }
       if (nbRead > 0U) {
-        (void)ST_MEMCPY(buf, &ctx->subCtx.t3t.rxbuf[offset], (uint32_t)nbRead);
+        (void)ST_MEMCPY(buf, &ctx->subCtx.t3t.rxbuf[startOffset], (uint32_t)nbRead);
       }
       lvRcvLen   += (uint32_t) nbRead;
       currentLen -= (uint32_t) nbRead;
@@ -225,7 +225,7 @@ ReturnCode ndefT3TPollerReadBytes(ndefContext *ctx, uint32_t offset, uint32_t le
       /* Check length */
       return ERR_MEM_CORRUPT;
     } else {
-      (void)ST_MEMCPY(&buf[lvRcvLen], ctx->subCtx.t3t.rxbuf, (uint32_t)currentLen);
+      (void)ST_MEMCPY(&buf[lvRcvLen], ctx->subCtx.t3t.rxbuf, (uint32_t)nbRead);
       lvRcvLen   += nbRead;
       currentLen -= nbRead;
       startBlock += nbBlocks;
@@ -0,0 +1,447 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_tnep.cpp
+  * @brief          : NDEF TNEP (Tag NDEF Exchange Protocol) reader engine
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_tnep.h"
+#include "ndef_message.h"
+#include "nfc_utils.h"
+#include "ndef_class.h"
+
+
+#if NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * \brief Tell whether the tag device has answered
+ *
+ * The NDEF message is the tag device answer once it is neither empty nor
+ * the message just written by the reader.
+ *****************************************************************************
+ */
+static bool ndefTnepIsAnswer(const uint8_t *txBuf, uint32_t txLen, const uint8_t *rxBuf, uint32_t rcvdLen)
+{
+  if (rcvdLen == 0U) {
+    return false;
+  }
+
+  if ((rcvdLen == txLen) && (ST_BYTECMP(txBuf, rxBuf, txLen) == 0)) {
+    return false;
+  }
+
+  return true;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Write a message and start waiting for the tag device answer
+ *****************************************************************************
+ */
+static ReturnCode ndefTnepTransceiveStart(ndefTnep *tnep, ndefTnepState state, uint8_t index, const uint8_t *txBuf, uint32_t txLen, uint8_t *rxBuf, uint32_t rxBufLen, uint32_t *rcvdLen)
+{
+  ReturnCode err;
+
+  (void)ST_MEMSET(&tnep->stats, 0, sizeof(ndefTnepExchangeStats));
+  tnep->op.startTime  = micros();
+  tnep->stats.txBytes = txLen;
+
+  err = ndefPollerWriteRawMessage(tnep->ctx, txBuf, txLen);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  tnep->op.state      = state;
+  tnep->op.service    = index;
+  tnep->op.txBuf      = txBuf;
+  tnep->op.txLen      = txLen;
+  tnep->op.rxBuf      = rxBuf;
+  tnep->op.rxBufLen   = rxBufLen;
+  tnep->op.rcvdLen    = rcvdLen;
+  tnep->op.extensions = 0;
+  tnep->op.waitStart  = micros();
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Check the Status record answered to a Service Select
+ *****************************************************************************
+ */
+static ReturnCode ndefTnepCheckSelectStatus(ndefTnep *tnep)
+{
+  ReturnCode      err;
+  ndefConstBuffer bufRecord;
+  ndefRecord      record;
+  ndefType        statusType;
+  uint8_t         status;
+  uint32_t        offset;
+
+  /* Look for the Status record */
+  offset = 0;
+  while (offset < tnep->rcvdLen) {
+    bufRecord.buffer = &tnep->op.rxBuf[offset];
+    bufRecord.length = tnep->rcvdLen - offset;
+    err = ndefRecordDecode(&bufRecord, &record);
+    if (err != ERR_NONE) {
+      return err;
+    }
+    offset += ndefRecordGetLength(&record);
+
+    if (ndefRecordToRtdTnepStatus(&record, &statusType) == ERR_NONE) {
+      (void)ndefGetRtdTnepStatus(&statusType, &status);
+      if (status != TNEP_STATUS_TYPE_SUCCESS) {
+        return ERR_PROTO;
+      }
+      tnep->selected = tnep->op.service;
+      return ERR_NONE;
+    }
+  }
+
+  return ERR_PROTO;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Run the blocking wrappers until the exchange completes
+ *****************************************************************************
+ */
+static ReturnCode ndefTnepRunBlocking(ndefTnep *tnep)
+{
+  ReturnCode err;
+
+  RfalNfcClass *rfal_nfc = ((NdefClass *)(tnep->ctx->ndef_class_instance))->rfal_nfc;
+
+  do {
+    /* Keep the RFAL worker running while waiting for the tag device */
+    rfal_nfc->rfalNfcWorker();
+    err = ndefTnepGetStatus(tnep);
+  } while (err == ERR_BUSY);
+
+  return err;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepInit(ndefTnep *tnep, ndefContext *ctx)
+{
+  if ((tnep == NULL) || (ctx == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMSET(tnep, 0, sizeof(ndefTnep));
+  tnep->ctx      = ctx;
+  tnep->selected = NDEF_TNEP_NO_SERVICE;
+  tnep->op.state = NDEF_TNEP_STATE_IDLE;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepDiscover(ndefTnep *tnep, uint8_t *buf, uint32_t bufLen)
+{
+  ReturnCode       err;
+  uint32_t         rcvdLen;
+  uint32_t         offset;
+  ndefConstBuffer  bufRecord;
+  ndefRecord       record;
+  ndefType         type;
+  ndefTnepService *service;
+  ndefConstBuffer  bufServiceNameUri;
+  uint8_t          tnepVersion;
+
+  if ((tnep == NULL) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (tnep->op.state != NDEF_TNEP_STATE_IDLE) {
+    return ERR_BUSY;
+  }
+
+  tnep->serviceCount = 0;
+  tnep->selected     = NDEF_TNEP_NO_SERVICE;
+
+  err = ndefPollerReadRawMessage(tnep->ctx, buf, bufLen, &rcvdLen, true);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  /* Walk the initial message in place and keep the Service Parameter records */
+  offset = 0;
+  while ((offset < rcvdLen) && (tnep->serviceCount < NDEF_TNEP_SERVICE_MAX)) {
+    bufRecord.buffer = &buf[offset];
+    bufRecord.length = rcvdLen - offset;
+    err = ndefRecordDecode(&bufRecord, &record);
+    if (err != ERR_NONE) {
+      return err;
+    }
+    offset += ndefRecordGetLength(&record);
+
+    if (ndefRecordToRtdTnepServiceParameter(&record, &type) == ERR_NONE) {
+      service = &tnep->service[tnep->serviceCount];
+      (void)ndefGetRtdTnepServiceParameter(&type, &tnepVersion, &bufServiceNameUri, &service->communicationMode,
+                                           &service->minimumWaitingTime, &service->maximumWaitingTimeExtensions, &service->maximumNdefMessageSize);
+      if (bufServiceNameUri.length > NDEF_TNEP_SERVICE_NAME_LEN_MAX) {
+        /* Service name too long to be kept, skip the service */
+        continue;
+      }
+      /* Copy the name as buf is overwritten by the next exchange */
+      (void)ST_MEMCPY(service->serviceNameUri, bufServiceNameUri.buffer, bufServiceNameUri.length);
+      service->serviceNameUriLen = (uint8_t)bufServiceNameUri.length;
+      /* Twait kept in us so that short waits are not rounded up */
+      service->twait = (uint32_t)(ndefRtdTnepServiceParameterComputeTwait(service->minimumWaitingTime) * 1000.0f);
+      tnep->serviceCount++;
+    }
+  }
+
+  return (tnep->serviceCount != 0U) ? ERR_NONE : ERR_NOTFOUND;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepFindService(const ndefTnep *tnep, const ndefConstBuffer *bufServiceUri, uint8_t *index)
+{
+  uint8_t i;
+
+  if ((tnep == NULL) || (bufServiceUri == NULL) || (bufServiceUri->buffer == NULL) || (index == NULL)) {
+    return ERR_PARAM;
+  }
+
+  for (i = 0; i < tnep->serviceCount; i++) {
+    if ((tnep->service[i].serviceNameUriLen == bufServiceUri->length) &&
+        (ST_BYTECMP(tnep->service[i].serviceNameUri, bufServiceUri->buffer, bufServiceUri->length) == 0)) {
+      *index = i;
+      return ERR_NONE;
+    }
+  }
+
+  return ERR_NOTFOUND;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepSelectStart(ndefTnep *tnep, uint8_t index, uint8_t *rxBuf, uint32_t rxBufLen)
+{
+  ReturnCode      err;
+  ndefBuffer      bufTx;
+  ndefConstBuffer bufServiceNameUri;
+  ndefType        selectType;
+  ndefRecord      selectRecord;
+  ndefMessage     selectMessage;
+
+  if ((tnep == NULL) || (rxBuf == NULL) || (index >= tnep->serviceCount)) {
+    return ERR_PARAM;
+  }
+
+  if (tnep->op.state != NDEF_TNEP_STATE_IDLE) {
+    return ERR_BUSY;
+  }
+
+  /* Build the Service Select message, kept in the session to recognize the answer */
+  bufServiceNameUri.buffer = tnep->service[index].serviceNameUri;
+  bufServiceNameUri.length = tnep->service[index].serviceNameUriLen;
+  err = ndefRtdTnepServiceSelectInit(&selectType, &bufServiceNameUri);
+  if (err != ERR_NONE) {
+    return err;
+  }
+  (void)ndefTypeToRecord(&selectType, &selectRecord);
+  (void)ndefMessageInit(&selectMessage);
+  (void)ndefMessageAppend(&selectMessage, &selectRecord);
+
+  bufTx.buffer = tnep->selectBuf;
+  bufTx.length = sizeof(tnep->selectBuf);
+  err = ndefMessageEncode(&selectMessage, &bufTx);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  tnep->selected = NDEF_TNEP_NO_SERVICE;
+
+  return ndefTnepTransceiveStart(tnep, NDEF_TNEP_STATE_SELECT, index, tnep->selectBuf, bufTx.length, rxBuf, rxBufLen, &tnep->rcvdLen);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepExchangeStart(ndefTnep *tnep, const uint8_t *txBuf, uint32_t txLen, uint8_t *rxBuf, uint32_t rxBufLen, uint32_t *rcvdLen)
+{
+  if ((tnep == NULL) || (txBuf == NULL) || (rxBuf == NULL) || (rcvdLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (tnep->op.state != NDEF_TNEP_STATE_IDLE) {
+    return ERR_BUSY;
+  }
+
+  if (tnep->selected >= tnep->serviceCount) {
+    return ERR_WRONG_STATE;
+  }
+
+  if (txLen > tnep->service[tnep->selected].maximumNdefMessageSize) {
+    return ERR_NOMEM;
+  }
+
+  return ndefTnepTransceiveStart(tnep, NDEF_TNEP_STATE_EXCHANGE, tnep->selected, txBuf, txLen, rxBuf, rxBufLen, rcvdLen);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepGetStatus(ndefTnep *tnep)
+{
+  ReturnCode             err;
+  ndefTnepState          state;
+  const ndefTnepService *service;
+
+  if (tnep == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (tnep->op.state == NDEF_TNEP_STATE_IDLE) {
+    return ERR_WRONG_STATE;
+  }
+
+  service = &tnep->service[tnep->op.service];
+
+  /* Wait Twait for the tag device to process the message */
+  if ((micros() - tnep->op.waitStart) < service->twait) {
+    return ERR_BUSY;
+  }
+  tnep->stats.waitTime += (micros() - tnep->op.waitStart);
+
+  state          = tnep->op.state;
+  tnep->op.state = NDEF_TNEP_STATE_IDLE;
+
+  /* Force the NDEF length to be read again */
+  err = ndefPollerReadRawMessage(tnep->ctx, tnep->op.rxBuf, tnep->op.rxBufLen, tnep->op.rcvdLen, false);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  if (!ndefTnepIsAnswer(tnep->op.txBuf, tnep->op.txLen, tnep->op.rxBuf, *tnep->op.rcvdLen)) {
+    tnep->stats.extensions = tnep->op.extensions;
+
+    if (tnep->op.extensions >= service->maximumWaitingTimeExtensions) {
+      return ERR_TIMEOUT;
+    }
+
+    /* Extend the wait by Twait */
+    tnep->op.extensions++;
+    tnep->op.waitStart = micros();
+    tnep->op.state     = state;
+    return ERR_BUSY;
+  }
+
+  tnep->stats.extensions  = tnep->op.extensions;
+  tnep->stats.rxBytes     = *tnep->op.rcvdLen;
+  tnep->stats.duration    = (micros() - tnep->op.startTime);
+  tnep->stats.bytesPerSec = ((tnep->stats.duration != 0U) ? (uint32_t)(((uint64_t)(tnep->stats.txBytes + tnep->stats.rxBytes) * 1000000U) / tnep->stats.duration) : 0U);
+
+  if (state == NDEF_TNEP_STATE_SELECT) {
+    return ndefTnepCheckSelectStatus(tnep);
+  }
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepSelect(ndefTnep *tnep, uint8_t index, uint8_t *rxBuf, uint32_t rxBufLen)
+{
+  ReturnCode err;
+
+  err = ndefTnepSelectStart(tnep, index, rxBuf, rxBufLen);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  return ndefTnepRunBlocking(tnep);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepExchange(ndefTnep *tnep, const uint8_t *txBuf, uint32_t txLen, uint8_t *rxBuf, uint32_t rxBufLen, uint32_t *rcvdLen)
+{
+  ReturnCode err;
+
+  err = ndefTnepExchangeStart(tnep, txBuf, txLen, rxBuf, rxBufLen, rcvdLen);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  return ndefTnepRunBlocking(tnep);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepDeselect(ndefTnep *tnep)
+{
+  if (tnep == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (tnep->op.state != NDEF_TNEP_STATE_IDLE) {
+    return ERR_BUSY;
+  }
+
+  tnep->selected = NDEF_TNEP_NO_SERVICE;
+
+  return ndefPollerWriteRawMessage(tnep->ctx, NULL, 0);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefTnepGetExchangeStats(const ndefTnep *tnep, ndefTnepExchangeStats *stats)
+{
+  if ((tnep == NULL) || (stats == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMCPY(stats, &tnep->stats, sizeof(ndefTnepExchangeStats));
+
+  return ERR_NONE;
+}
+
+#endif /* NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API */
@@ -0,0 +1,320 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_tnep.h
+  * @brief          : NDEF TNEP (Tag NDEF Exchange Protocol) reader engine header file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NDEF_TNEP_H
+#define NDEF_TNEP_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_poller.h"
+#include "ndef_types.h"
+
+
+#if NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef NDEF_TNEP_SERVICE_MAX
+  #define NDEF_TNEP_SERVICE_MAX  4U      /*!< Maximum number of services kept from the initial NDEF message */
+#endif
+
+#ifndef NDEF_TNEP_SERVICE_NAME_LEN_MAX
+  #define NDEF_TNEP_SERVICE_NAME_LEN_MAX  64U /*!< Maximum Service Name URI length kept per service (bytes) */
+#endif
+
+#define NDEF_TNEP_NO_SERVICE     0xFFU   /*!< No service selected */
+
+/*! Service Select message max length: header, "Ts", URI length byte and URI */
+#define NDEF_TNEP_SELECT_MESSAGE_LEN   (NDEF_RECORD_HEADER_LEN + 2U + 1U + NDEF_TNEP_SERVICE_NAME_LEN_MAX)
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*! TNEP service, as advertised by a Service Parameter record */
+typedef struct {
+  uint8_t         serviceNameUri[NDEF_TNEP_SERVICE_NAME_LEN_MAX]; /*!< Service Name URI, copied from the discovery buffer */
+  uint8_t         serviceNameUriLen;            /*!< Service Name URI length                           */
+  uint8_t         communicationMode;            /*!< TNEP communication mode                           */
+  uint8_t         minimumWaitingTime;           /*!< Minimum Waiting Time WT_INT                       */
+  uint8_t         maximumWaitingTimeExtensions; /*!< Maximum number of waiting time extensions         */
+  uint16_t        maximumNdefMessageSize;       /*!< Maximum NDEF message size (bytes)                 */
+  uint32_t        twait;                        /*!< Twait computed from WT_INT (us)                   */
+} ndefTnepService;
+
+
+/*! TNEP exchange statistics, updated by each write/wait/read exchange */
+typedef struct {
+  uint32_t        txBytes;                      /*!< NDEF bytes written                                */
+  uint32_t        rxBytes;                      /*!< NDEF bytes read                                   */
+  uint8_t         extensions;                   /*!< Waiting time extensions used                      */
+  uint32_t        waitTime;                     /*!< Time spent waiting for the tag device (us)        */
+  uint32_t        duration;                     /*!< Overall exchange duration (us)                    */
+  uint32_t        bytesPerSec;                  /*!< Exchange throughput, tx and rx bytes (bytes/s)    */
+} ndefTnepExchangeStats;
+
+
+/*! TNEP exchange states */
+typedef enum {
+  NDEF_TNEP_STATE_IDLE     = 0x00U,             /*!< No exchange in progress                           */
+  NDEF_TNEP_STATE_SELECT   = 0x01U,             /*!< Service Select written, waiting for the status    */
+  NDEF_TNEP_STATE_EXCHANGE = 0x02U,             /*!< Message written, waiting for the answer           */
+} ndefTnepState;
+
+
+/*! TNEP exchange in progress */
+typedef struct {
+  ndefTnepState   state;                        /*!< Exchange state                                    */
+  uint8_t         service;                      /*!< Service index                                     */
+  const uint8_t  *txBuf;                        /*!< Message written                                   */
+  uint32_t        txLen;                        /*!< Message written length                            */
+  uint8_t        *rxBuf;                        /*!< Buffer to read the answer                         */
+  uint32_t        rxBufLen;                     /*!< Buffer length                                     */
+  uint32_t       *rcvdLen;                      /*!< Answer length                                     */
+  uint32_t        startTime;                    /*!< Exchange start time (us)                          */
+  uint32_t        waitStart;                    /*!< Current Twait start time (us)                     */
+  uint8_t         extensions;                   /*!< Waiting time extensions used                      */
+} ndefTnepOp;
+
+
+/*! TNEP reader session */
+typedef struct {
+  ndefContext          *ctx;                            /*!< NDEF context of the tag device       */
+  ndefTnepService       service[NDEF_TNEP_SERVICE_MAX]; /*!< Services of the initial NDEF message */
+  uint8_t               serviceCount;                   /*!< Number of services                   */
+  uint8_t               selected;                       /*!< Selected service index               */
+  ndefTnepExchangeStats stats;                          /*!< Statistics of the last exchange      */
+  ndefTnepOp            op;                             /*!< Exchange in progress                 */
+  uint32_t              rcvdLen;                        /*!< Service Select answer length         */
+  uint8_t               selectBuf[NDEF_TNEP_SELECT_MESSAGE_LEN]; /*!< Service Select message     */
+} ndefTnep;
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize a TNEP reader session
+ *
+ * \param[out] tnep: TNEP session
+ * \param[in]  ctx:  NDEF context, NDEF detected
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepInit(ndefTnep *tnep, ndefContext *ctx);
+
+
+/*!
+ *****************************************************************************
+ * Discover the services of the tag device
+ *
+ * Read the initial NDEF message and keep its Service Parameter records.
+ * The service names are copied into the session, buf can be reused once
+ * this returns. Services whose name is longer than
+ * NDEF_TNEP_SERVICE_NAME_LEN_MAX are skipped.
+ *
+ * \param[in,out] tnep:   TNEP session
+ * \param[out]    buf:    Buffer to store the initial NDEF message
+ * \param[in]     bufLen: Buffer length
+ *
+ * \return ERR_NOTFOUND if the tag device offers no service
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepDiscover(ndefTnep *tnep, uint8_t *buf, uint32_t bufLen);
+
+
+/*!
+ *****************************************************************************
+ * Find a discovered service by name
+ *
+ * \param[in]  tnep:          TNEP session
+ * \param[in]  bufServiceUri: Service Name URI
+ * \param[out] index:         Service index
+ *
+ * \return ERR_NOTFOUND if the service is not offered
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepFindService(const ndefTnep *tnep, const ndefConstBuffer *bufServiceUri, uint8_t *index);
+
+
+/*!
+ *****************************************************************************
+ * Start the selection of a service
+ *
+ * Write a Service Select record. The Status record of the tag device is
+ * then waited for and read by ndefTnepGetStatus().
+ *
+ * \param[in,out] tnep:     TNEP session
+ * \param[in]     index:    Service index
+ * \param[out]    rxBuf:    Buffer to read the answer, kept until completion
+ * \param[in]     rxBufLen: Buffer length
+ *
+ * \return ERR_BUSY if an exchange is already in progress
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepSelectStart(ndefTnep *tnep, uint8_t index, uint8_t *rxBuf, uint32_t rxBufLen);
+
+
+/*!
+ *****************************************************************************
+ * Start an NDEF message exchange with the selected service
+ *
+ * Write the raw NDEF message. The answer is then waited for and read by
+ * ndefTnepGetStatus().
+ *
+ * \param[in,out] tnep:     TNEP session
+ * \param[in]     txBuf:    Raw NDEF message to write, kept until completion
+ * \param[in]     txLen:    Raw NDEF message length
+ * \param[out]    rxBuf:    Buffer to read the answer, kept until completion
+ * \param[in]     rxBufLen: Buffer length
+ * \param[out]    rcvdLen:  Answer length
+ *
+ * \return ERR_WRONG_STATE if no service is selected
+ * \return ERR_BUSY if an exchange is already in progress
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepExchangeStart(ndefTnep *tnep, const uint8_t *txBuf, uint32_t txLen, uint8_t *rxBuf, uint32_t rxBufLen, uint32_t *rcvdLen);
+
+
+/*!
+ *****************************************************************************
+ * Get the status of the exchange in progress
+ *
+ * Once Twait has elapsed since the write, read the NDEF message; while the
+ * tag device has not answered, wait Twait again up to the number of
+ * extensions allowed by the service. No time is spent waiting in this
+ * function: it is to be called periodically, e.g. along with the RFAL
+ * worker, until it no longer returns ERR_BUSY.
+ *
+ * \param[in,out] tnep: TNEP session
+ *
+ * \return ERR_BUSY while waiting for the tag device
+ * \return ERR_WRONG_STATE if no exchange is in progress
+ * \return ERR_TIMEOUT if the tag device did not answer in time
+ * \return ERR_PROTO if the tag device answered a protocol error to a select
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepGetStatus(ndefTnep *tnep);
+
+
+/*!
+ *****************************************************************************
+ * Select a service
+ *
+ * Write a Service Select record, wait for the tag device and read its
+ * Status record. Blocking wrapper of ndefTnepSelectStart() and
+ * ndefTnepGetStatus(), running the RFAL worker while waiting.
+ *
+ * \param[in,out] tnep:     TNEP session
+ * \param[in]     index:    Service index
+ * \param[out]    rxBuf:    Buffer to read the answer
+ * \param[in]     rxBufLen: Buffer length
+ *
+ * \return ERR_TIMEOUT if the tag device did not answer in time
+ * \return ERR_PROTO if the tag device answered a protocol error
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepSelect(ndefTnep *tnep, uint8_t index, uint8_t *rxBuf, uint32_t rxBufLen);
+
+
+/*!
+ *****************************************************************************
+ * Exchange NDEF messages with the selected service
+ *
+ * Write the raw NDEF message, wait Twait and read the answer, extending the
+ * wait up to the number of extensions allowed by the service. Blocking
+ * wrapper of ndefTnepExchangeStart() and ndefTnepGetStatus(), running the
+ * RFAL worker while waiting.
+ *
+ * \param[in,out] tnep:     TNEP session
+ * \param[in]     txBuf:    Raw NDEF message to write
+ * \param[in]     txLen:    Raw NDEF message length
+ * \param[out]    rxBuf:    Buffer to read the answer
+ * \param[in]     rxBufLen: Buffer length
+ * \param[out]    rcvdLen:  Answer length
+ *
+ * \return ERR_WRONG_STATE if no service is selected
+ * \return ERR_TIMEOUT if the tag device did not answer in time
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepExchange(ndefTnep *tnep, const uint8_t *txBuf, uint32_t txLen, uint8_t *rxBuf, uint32_t rxBufLen, uint32_t *rcvdLen);
+
+
+/*!
+ *****************************************************************************
+ * Deselect the selected service
+ *
+ * Write an empty NDEF message so that the tag device returns to its
+ * initial NDEF message.
+ *
+ * \param[in,out] tnep: TNEP session
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepDeselect(ndefTnep *tnep);
+
+
+/*!
+ *****************************************************************************
+ * Get the statistics of the last exchange
+ *
+ * \param[in]  tnep:  TNEP session
+ * \param[out] stats: Statistics of the last select or exchange
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTnepGetExchangeStats(const ndefTnep *tnep, ndefTnepExchangeStats *stats);
+
+
+#endif /* NDEF_TYPE_RTD_TNEP_SUPPORT && NDEF_FEATURE_FULL_API */
+
+#endif /* NDEF_TNEP_H */
+
+/**
+  * @}
+  *
+  */
@@ -0,0 +1,732 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_type_handover.cpp
+  * @brief          : NDEF RTD Connection Handover types
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_record.h"
+#include "ndef_message.h"
+#include "ndef_types.h"
+#include "ndef_type_handover.h"
+#include "nfc_utils.h"
+
+
+#if NDEF_TYPE_RTD_HANDOVER_SUPPORT
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+
+/*! Handover Select/Request defines */
+#define NDEF_RTD_HANDOVER_VERSION_OFFSET            0U    /*!< Handover version offset                           */
+#define NDEF_RTD_HANDOVER_LOCAL_RECORDS_OFFSET      1U    /*!< Handover local records offset                     */
+#define NDEF_RTD_HANDOVER_MINIMUM_LENGTH            1U    /*!< Handover minimum length (bytes)                   */
+
+/*! Handover payload items, local records are walked one segment at a time */
+#define NDEF_RTD_HANDOVER_ITEM_VERSION              0U    /*!< Version byte                                      */
+#define NDEF_RTD_HANDOVER_ITEM_HEADER               1U    /*!< Local record header                               */
+#define NDEF_RTD_HANDOVER_ITEM_TYPE                 2U    /*!< Local record type                                 */
+#define NDEF_RTD_HANDOVER_ITEM_ID                   3U    /*!< Local record id                                   */
+#define NDEF_RTD_HANDOVER_ITEM_PAYLOAD              4U    /*!< Local record payload items                        */
+
+/*! Alternative Carrier defines */
+#define NDEF_RTD_AC_CPS_OFFSET                      0U    /*!< Alternative Carrier CPS offset                    */
+#define NDEF_RTD_AC_CDR_LENGTH_OFFSET               1U    /*!< Alternative Carrier Data Reference length offset  */
+#define NDEF_RTD_AC_CDR_OFFSET                      2U    /*!< Alternative Carrier Data Reference offset         */
+#define NDEF_RTD_AC_MINIMUM_LENGTH                  4U    /*!< Alternative Carrier minimum length (bytes)        */
+
+/*! Collision Resolution defines */
+#define NDEF_RTD_CR_LENGTH                          2U    /*!< Collision Resolution length (bytes)               */
+
+
+/*
+ ******************************************************************************
+ * LOCAL VARIABLES
+ ******************************************************************************
+ */
+
+
+/*! RTD Connection Handover Type strings */
+static const uint8_t ndefRtdTypeHandoverSelect[]      = "Hs";             /*!< Handover Select Record Type       */
+static const uint8_t ndefRtdTypeHandoverRequest[]     = "Hr";             /*!< Handover Request Record Type      */
+static const uint8_t ndefRtdTypeAlternativeCarrier[]  = "ac";             /*!< Alternative Carrier Record Type   */
+static const uint8_t ndefRtdTypeCollisionResolution[] = "cr";             /*!< Collision Resolution Record Type  */
+
+const ndefConstBuffer8 bufRtdTypeHandoverSelect      = { ndefRtdTypeHandoverSelect,      sizeof(ndefRtdTypeHandoverSelect) - 1U };      /*!< Handover Select Record Type buffer      */
+const ndefConstBuffer8 bufRtdTypeHandoverRequest     = { ndefRtdTypeHandoverRequest,     sizeof(ndefRtdTypeHandoverRequest) - 1U };     /*!< Handover Request Record Type buffer     */
+const ndefConstBuffer8 bufRtdTypeAlternativeCarrier  = { ndefRtdTypeAlternativeCarrier,  sizeof(ndefRtdTypeAlternativeCarrier) - 1U };  /*!< Alternative Carrier Record Type buffer  */
+const ndefConstBuffer8 bufRtdTypeCollisionResolution = { ndefRtdTypeCollisionResolution, sizeof(ndefRtdTypeCollisionResolution) - 1U }; /*!< Collision Resolution Record Type buffer */
+
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*
+ * Handover Select and Handover Request
+ */
+
+/*****************************************************************************/
+static bool ndefRtdIsHandover(const ndefType *type)
+{
+  return (type != NULL) && ((type->id == NDEF_TYPE_ID_RTD_HANDOVER_SELECT) || (type->id == NDEF_TYPE_ID_RTD_HANDOVER_REQUEST));
+}
+
+
+/*****************************************************************************/
+static uint32_t ndefRtdHandoverGetPayloadLength(const ndefType *type)
+{
+  const ndefTypeRtdHandover *rtdHandover;
+  ndefMessageInfo info;
+
+  if (!ndefRtdIsHandover(type)) {
+    return 0;
+  }
+
+  rtdHandover = &type->data.handover;
+
+  if (rtdHandover->message != NULL) {
+    (void)ndefMessageGetInfo(rtdHandover->message, &info);
+    return sizeof(rtdHandover->version) + info.length;
+  }
+
+  return sizeof(rtdHandover->version) + rtdHandover->bufLocalRecords.length;
+}
+
+
+/*****************************************************************************/
+static const uint8_t *ndefRtdHandoverToPayloadItem(const ndefType *type, ndefConstBuffer *bufItem, bool begin)
+{
+  static uint32_t          item = 0;
+  static const ndefRecord *record;
+  static bool              payloadBegin;
+  static uint8_t           recordHeader[NDEF_RECORD_HEADER_LEN];
+  const ndefTypeRtdHandover *rtdHandover;
+  ndefBuffer               bufHeader;
+
+  if (!ndefRtdIsHandover(type) || (bufItem == NULL)) {
+    return NULL;
+  }
+
+  rtdHandover = &type->data.handover;
+
+  if (begin == true) {
+    item = NDEF_RTD_HANDOVER_ITEM_VERSION;
+  }
+
+  bufItem->buffer = NULL;
+  bufItem->length = 0;
+
+  if (item == NDEF_RTD_HANDOVER_ITEM_VERSION) {
+    /* Version byte */
+    bufItem->buffer = &rtdHandover->version;
+    bufItem->length = sizeof(rtdHandover->version);
+    item            = NDEF_RTD_HANDOVER_ITEM_HEADER;
+    record          = (rtdHandover->message != NULL) ? ndefMessageGetFirstRecord(rtdHandover->message) : NULL;
+    return bufItem->buffer;
+  }
+
+  if (rtdHandover->message == NULL) {
+    /* Decoded type: local records are returned as a single raw item */
+    if ((item == NDEF_RTD_HANDOVER_ITEM_HEADER) && (rtdHandover->bufLocalRecords.length != 0U)) {
+      bufItem->buffer = rtdHandover->bufLocalRecords.buffer;
+      bufItem->length = rtdHandover->bufLocalRecords.length;
+    }
+    item = NDEF_RTD_HANDOVER_ITEM_PAYLOAD;
+    return bufItem->buffer;
+  }
+
+  /* Walk the local records, one segment per call */
+  while (record != NULL) {
+    switch (item) {
+      case NDEF_RTD_HANDOVER_ITEM_HEADER:
+        bufHeader.buffer = recordHeader;
+        bufHeader.length = sizeof(recordHeader);
+        (void)ndefRecordEncodeHeader(record, &bufHeader);
+        bufItem->buffer = bufHeader.buffer;
+        bufItem->length = bufHeader.length;
+        item = NDEF_RTD_HANDOVER_ITEM_TYPE;
+        return bufItem->buffer;
+
+      case NDEF_RTD_HANDOVER_ITEM_TYPE:
+        item = NDEF_RTD_HANDOVER_ITEM_ID;
+        if (record->typeLength != 0U) {
+          bufItem->buffer = record->type;
+          bufItem->length = record->typeLength;
+          return bufItem->buffer;
+        }
+        break;
+
+      case NDEF_RTD_HANDOVER_ITEM_ID:
+        item         = NDEF_RTD_HANDOVER_ITEM_PAYLOAD;
+        payloadBegin = true;
+        if (record->idLength != 0U) {
+          bufItem->buffer = record->id;
+          bufItem->length = record->idLength;
+          return bufItem->buffer;
+        }
+        break;
+
+      default:
+        if (ndefRecordGetPayloadItem(record, bufItem, payloadBegin) != NULL) {
+          payloadBegin = false;
+          return bufItem->buffer;
+        }
+        /* Move to the next local record */
+        record = ndefMessageGetNextRecord(record);
+        item   = NDEF_RTD_HANDOVER_ITEM_HEADER;
+        break;
+    }
+  }
+
+  bufItem->buffer = NULL;
+  bufItem->length = 0;
+
+  return NULL;
+}
+
+
+/*****************************************************************************/
+static ReturnCode ndefRtdHandoverInit(ndefType *type, ndefTypeId id, uint8_t version, const ndefMessage *localMessage)
+{
+  ndefTypeRtdHandover *rtdHandover;
+
+  if ((type == NULL) || (localMessage == NULL)) {
+    return ERR_PARAM;
+  }
+
+  type->id               = id;
+  type->getPayloadLength = ndefRtdHandoverGetPayloadLength;
+  type->getPayloadItem   = ndefRtdHandoverToPayloadItem;
+  type->typeToRecord     = ndefRtdHandoverToRecord;
+  rtdHandover            = &type->data.handover;
+
+  rtdHandover->version                = version;
+  rtdHandover->message                = localMessage;
+  rtdHandover->bufLocalRecords.buffer = NULL;
+  rtdHandover->bufLocalRecords.length = 0;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRtdHandoverSelectInit(ndefType *type, uint8_t version, const ndefMessage *localMessage)
+{
+  return ndefRtdHandoverInit(type, NDEF_TYPE_ID_RTD_HANDOVER_SELECT, version, localMessage);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRtdHandoverRequestInit(ndefType *type, uint8_t version, const ndefMessage *localMessage)
+{
+  return ndefRtdHandoverInit(type, NDEF_TYPE_ID_RTD_HANDOVER_REQUEST, version, localMessage);
+}
+
+
+/*****************************************************************************/
+static ReturnCode ndefRtdHandoverFindLocalRecord(const ndefType *type, const ndefConstBuffer8 *bufType, uint32_t index, ndefRecord *localRecord)
+{
+  const ndefTypeRtdHandover *rtdHandover;
+  const ndefRecord          *record;
+  ndefConstBuffer            bufRecord;
+  uint32_t                   offset;
+  uint32_t                   count;
+
+  if (!ndefRtdIsHandover(type) || (localRecord == NULL)) {
+    return ERR_PARAM;
+  }
+
+  rtdHandover = &type->data.handover;
+  count       = 0;
+
+  if (rtdHandover->message != NULL) {
+    record = ndefMessageGetFirstRecord(rtdHandover->message);
+    while (record != NULL) {
+      if (ndefRecordTypeMatch(record, NDEF_TNF_RTD_WELL_KNOWN_TYPE, bufType)) {
+        if (count == index) {
+          (void)ST_MEMCPY(localRecord, record, sizeof(ndefRecord));
+          return ERR_NONE;
+        }
+        count++;
+      }
+      record = ndefMessageGetNextRecord(record);
+    }
+    return ERR_NOTFOUND;
+  }
+
+  /* Decoded type: walk the raw local records in place */
+  offset = 0;
+  while (offset < rtdHandover->bufLocalRecords.length) {
+    bufRecord.buffer = &rtdHandover->bufLocalRecords.buffer[offset];
+    bufRecord.length = rtdHandover->bufLocalRecords.length - offset;
+    if (ndefRecordDecode(&bufRecord, localRecord) != ERR_NONE) {
+      return ERR_PROTO;
+    }
+    if (ndefRecordTypeMatch(localRecord, NDEF_TNF_RTD_WELL_KNOWN_TYPE, bufType)) {
+      if (count == index) {
+        return ERR_NONE;
+      }
+      count++;
+    }
+    offset += ndefRecordGetLength(localRecord);
+  }
+
+  return ERR_NOTFOUND;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefGetRtdHandoverAlternativeCarrier(const ndefType *type, uint32_t index, ndefType *ac)
+{
+  ReturnCode err;
+  ndefRecord localRecord;
+
+  if (ac == NULL) {
+    return ERR_PARAM;
+  }
+
+  err = ndefRtdHandoverFindLocalRecord(type, &bufRtdTypeAlternativeCarrier, index, &localRecord);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  return ndefRecordToRtdAlternativeCarrier(&localRecord, ac);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefGetRtdHandoverCollisionResolution(const ndefType *type, ndefType *cr)
+{
+  ReturnCode err;
+  ndefRecord localRecord;
+
+  if ((type == NULL) || (type->id != NDEF_TYPE_ID_RTD_HANDOVER_REQUEST) || (cr == NULL)) {
+    return ERR_PARAM;
+  }
+
+  err = ndefRtdHandoverFindLocalRecord(type, &bufRtdTypeCollisionResolution, 0, &localRecord);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  return ndefRecordToRtdCollisionResolution(&localRecord, cr);
+}
+
+
+/*****************************************************************************/
+static ReturnCode ndefRecordToRtdHandover(const ndefRecord *record, ndefType *type, ndefTypeId id, const ndefConstBuffer8 *bufType)
+{
+  const ndefType *ndefData;
+  ndefTypeRtdHandover *rtdHandover;
+
+  if ((record == NULL) || (type == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (! ndefRecordTypeMatch(record, NDEF_TNF_RTD_WELL_KNOWN_TYPE, bufType)) { /* "Hs" or "Hr" */
+    return ERR_PROTO;
+  }
+
+  ndefData = ndefRecordGetNdefType(record);
+  if ((ndefData != NULL) && (ndefData->id == id)) {
+    (void)ST_MEMCPY(type, ndefData, sizeof(ndefType));
+    return ERR_NONE;
+  }
+
+  if ((record->bufPayload.buffer == NULL) || (record->bufPayload.length < NDEF_RTD_HANDOVER_MINIMUM_LENGTH)) {
+    return ERR_PROTO;
+  }
+
+  type->id               = id;
+  type->getPayloadLength = ndefRtdHandoverGetPayloadLength;
+  type->getPayloadItem   = ndefRtdHandoverToPayloadItem;
+  type->typeToRecord     = ndefRtdHandoverToRecord;
+  rtdHandover            = &type->data.handover;
+
+  rtdHandover->version                = record->bufPayload.buffer[NDEF_RTD_HANDOVER_VERSION_OFFSET];
+  rtdHandover->message                = NULL;
+  rtdHandover->bufLocalRecords.buffer = &record->bufPayload.buffer[NDEF_RTD_HANDOVER_LOCAL_RECORDS_OFFSET];
+  rtdHandover->bufLocalRecords.length = record->bufPayload.length - NDEF_RTD_HANDOVER_LOCAL_RECORDS_OFFSET;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRecordToRtdHandoverSelect(const ndefRecord *record, ndefType *type)
+{
+  return ndefRecordToRtdHandover(record, type, NDEF_TYPE_ID_RTD_HANDOVER_SELECT, &bufRtdTypeHandoverSelect);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRecordToRtdHandoverRequest(const ndefRecord *record, ndefType *type)
+{
+  return ndefRecordToRtdHandover(record, type, NDEF_TYPE_ID_RTD_HANDOVER_REQUEST, &bufRtdTypeHandoverRequest);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRtdHandoverToRecord(const ndefType *type, ndefRecord *record)
+{
+  if (!ndefRtdIsHandover(type) || (record == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ndefRecordReset(record);
+
+  /* "Hs" or "Hr" */
+  (void)ndefRecordSetType(record, NDEF_TNF_RTD_WELL_KNOWN_TYPE,
+                          (type->id == NDEF_TYPE_ID_RTD_HANDOVER_SELECT) ? &bufRtdTypeHandoverSelect : &bufRtdTypeHandoverRequest);
+
+  (void)ndefRecordSetNdefType(record, type);
+
+  return ERR_NONE;
+}
+
+
+/*
+ * Alternative Carrier
+ */
+
+/*****************************************************************************/
+static uint32_t ndefRtdAlternativeCarrierGetPayloadLength(const ndefType *type)
+{
+  const ndefTypeRtdAlternativeCarrier *rtdAc;
+
+  if ((type == NULL) || (type->id != NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER)) {
+    return 0;
+  }
+
+  rtdAc = &type->data.alternativeCarrier;
+
+  return sizeof(rtdAc->cps)
+         + sizeof(rtdAc->bufCarrierDataRef.length)
+         + rtdAc->bufCarrierDataRef.length
+         + sizeof(rtdAc->auxDataRefCount)
+         + rtdAc->bufAuxDataRefs.length;
+}
+
+
+/*****************************************************************************/
+static const uint8_t *ndefRtdAlternativeCarrierToPayloadItem(const ndefType *type, ndefConstBuffer *bufItem, bool begin)
+{
+  static uint32_t item = 0;
+  const ndefTypeRtdAlternativeCarrier *rtdAc;
+
+  if ((type    == NULL) || (type->id != NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER)
+      || (bufItem == NULL)) {
+    return NULL;
+  }
+
+  rtdAc = &type->data.alternativeCarrier;
+
+  if (begin == true) {
+    item = 0;
+  }
+
+  switch (item) {
+    case 0:
+      /* Carrier Power State byte */
+      bufItem->buffer = &rtdAc->cps;
+      bufItem->length = sizeof(rtdAc->cps);
+      break;
+
+    case 1:
+      /* Carrier Data Reference length byte */
+      bufItem->buffer = &rtdAc->bufCarrierDataRef.length;
+      bufItem->length = sizeof(rtdAc->bufCarrierDataRef.length);
+      break;
+
+    case 2:
+      /* Carrier Data Reference */
+      bufItem->buffer = rtdAc->bufCarrierDataRef.buffer;
+      bufItem->length = rtdAc->bufCarrierDataRef.length;
+      break;
+
+    case 3:
+      /* Auxiliary Data Reference count byte */
+      bufItem->buffer = &rtdAc->auxDataRefCount;
+      bufItem->length = sizeof(rtdAc->auxDataRefCount);
+      break;
+
+    case 4:
+      /* Auxiliary Data References */
+      bufItem->buffer = rtdAc->bufAuxDataRefs.buffer;
+      bufItem->length = rtdAc->bufAuxDataRefs.length;
+      break;
+
+    default:
+      bufItem->buffer = NULL;
+      bufItem->length = 0;
+      break;
+  }
+
+  /* Move to next item for next call */
+  item++;
+
+  return bufItem->buffer;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRtdAlternativeCarrierInit(ndefType *type, uint8_t cps, const ndefConstBuffer8 *bufCarrierDataRef, uint8_t auxDataRefCount, const ndefConstBuffer *bufAuxDataRefs)
+{
+  ndefTypeRtdAlternativeCarrier *rtdAc;
+
+  if ((type == NULL) || (bufCarrierDataRef == NULL)
+      || (bufCarrierDataRef->buffer == NULL) || (bufCarrierDataRef->length == 0U)
+      || ((auxDataRefCount != 0U) && ((bufAuxDataRefs == NULL) || (bufAuxDataRefs->buffer == NULL)))) {
+    return ERR_PARAM;
+  }
+
+  type->id               = NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER;
+  type->getPayloadLength = ndefRtdAlternativeCarrierGetPayloadLength;
+  type->getPayloadItem   = ndefRtdAlternativeCarrierToPayloadItem;
+  type->typeToRecord     = ndefRtdAlternativeCarrierToRecord;
+  rtdAc                  = &type->data.alternativeCarrier;
+
+  rtdAc->cps                      = cps & NDEF_HANDOVER_CPS_MASK;
+  rtdAc->bufCarrierDataRef.buffer = bufCarrierDataRef->buffer;
+  rtdAc->bufCarrierDataRef.length = bufCarrierDataRef->length;
+  rtdAc->auxDataRefCount          = auxDataRefCount;
+  if (auxDataRefCount != 0U) {
+    rtdAc->bufAuxDataRefs.buffer  = bufAuxDataRefs->buffer;
+    rtdAc->bufAuxDataRefs.length  = bufAuxDataRefs->length;
+  } else {
+    rtdAc->bufAuxDataRefs.buffer  = NULL;
+    rtdAc->bufAuxDataRefs.length  = 0;
+  }
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefGetRtdAlternativeCarrier(const ndefType *type, uint8_t *cps, ndefConstBuffer8 *bufCarrierDataRef)
+{
+  const ndefTypeRtdAlternativeCarrier *rtdAc;
+
+  if ((type == NULL) || (type->id != NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER)
+      || (cps  == NULL) || (bufCarrierDataRef == NULL)) {
+    return ERR_PARAM;
+  }
+
+  rtdAc = &type->data.alternativeCarrier;
+
+  *cps                      = rtdAc->cps;
+  bufCarrierDataRef->buffer = rtdAc->bufCarrierDataRef.buffer;
+  bufCarrierDataRef->length = rtdAc->bufCarrierDataRef.length;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRecordToRtdAlternativeCarrier(const ndefRecord *record, ndefType *type)
+{
+  const ndefType  *ndefData;
+  ndefConstBuffer8 bufCarrierDataRef;
+  ndefConstBuffer  bufAuxDataRefs;
+  uint32_t         offset;
+
+  if ((record == NULL) || (type == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (! ndefRecordTypeMatch(record, NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeAlternativeCarrier)) { /* "ac" */
+    return ERR_PROTO;
+  }
+
+  ndefData = ndefRecordGetNdefType(record);
+  if ((ndefData != NULL) && (ndefData->id == NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER)) {
+    (void)ST_MEMCPY(type, ndefData, sizeof(ndefType));
+    return ERR_NONE;
+  }
+
+  if ((record->bufPayload.buffer == NULL) || (record->bufPayload.length < NDEF_RTD_AC_MINIMUM_LENGTH)) {
+    return ERR_PROTO;
+  }
+
+  bufCarrierDataRef.length = record->bufPayload.buffer[NDEF_RTD_AC_CDR_LENGTH_OFFSET];
+  bufCarrierDataRef.buffer = &record->bufPayload.buffer[NDEF_RTD_AC_CDR_OFFSET];
+  offset                   = NDEF_RTD_AC_CDR_OFFSET + bufCarrierDataRef.length;
+  if (offset >= record->bufPayload.length) {
+    return ERR_PROTO;
+  }
+
+  /* Auxiliary Data References are kept raw, right after their count */
+  bufAuxDataRefs.buffer = &record->bufPayload.buffer[offset + 1U];
+  bufAuxDataRefs.length = record->bufPayload.length - (offset + 1U);
+
+  return ndefRtdAlternativeCarrierInit(type, record->bufPayload.buffer[NDEF_RTD_AC_CPS_OFFSET], &bufCarrierDataRef, record->bufPayload.buffer[offset], &bufAuxDataRefs);
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRtdAlternativeCarrierToRecord(const ndefType *type, ndefRecord *record)
+{
+  if ((type   == NULL) || (type->id != NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER) ||
+      (record == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ndefRecordReset(record);
+
+  /* "ac" */
+  (void)ndefRecordSetType(record, NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeAlternativeCarrier);
+
+  (void)ndefRecordSetNdefType(record, type);
+
+  return ERR_NONE;
+}
+
+
+/*
+ * Collision Resolution
+ */
+
+/*****************************************************************************/
+static uint32_t ndefRtdCollisionResolutionGetPayloadLength(const ndefType *type)
+{
+  if ((type == NULL) || (type->id != NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION)) {
+    return 0;
+  }
+
+  return sizeof(type->data.collisionResolution.randomNumber);
+}
+
+
+/*****************************************************************************/
+static const uint8_t *ndefRtdCollisionResolutionToPayloadItem(const ndefType *type, ndefConstBuffer *bufItem, bool begin)
+{
+  if ((type    == NULL) || (type->id != NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION)
+      || (bufItem == NULL)) {
+    return NULL;
+  }
+
+  if (begin == true) {
+    bufItem->buffer = type->data.collisionResolution.randomNumber;
+    bufItem->length = sizeof(type->data.collisionResolution.randomNumber);
+  } else {
+    bufItem->buffer = NULL;
+    bufItem->length = 0;
+  }
+
+  return bufItem->buffer;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRtdCollisionResolutionInit(ndefType *type, uint16_t randomNumber)
+{
+  ndefTypeRtdCollisionResolution *rtdCr;
+
+  if (type == NULL) {
+    return ERR_PARAM;
+  }
+
+  type->id               = NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION;
+  type->getPayloadLength = ndefRtdCollisionResolutionGetPayloadLength;
+  type->getPayloadItem   = ndefRtdCollisionResolutionToPayloadItem;
+  type->typeToRecord     = ndefRtdCollisionResolutionToRecord;
+  rtdCr                  = &type->data.collisionResolution;
+
+  rtdCr->randomNumber[0] = (uint8_t)(randomNumber >> 8U);
+  rtdCr->randomNumber[1] = (uint8_t)(randomNumber & 0xFFU);
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefGetRtdCollisionResolution(const ndefType *type, uint16_t *randomNumber)
+{
+  if ((type == NULL) || (type->id != NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION) || (randomNumber == NULL)) {
+    return ERR_PARAM;
+  }
+
+  *randomNumber = GETU16(type->data.collisionResolution.randomNumber);
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRecordToRtdCollisionResolution(const ndefRecord *record, ndefType *type)
+{
+  const ndefType *ndefData;
+
+  if ((record == NULL) || (type == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (! ndefRecordTypeMatch(record, NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeCollisionResolution)) { /* "cr" */
+    return ERR_PROTO;
+  }
+
+  ndefData = ndefRecordGetNdefType(record);
+  if ((ndefData != NULL) && (ndefData->id == NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION)) {
+    (void)ST_MEMCPY(type, ndefData, sizeof(ndefType));
+    return ERR_NONE;
+  }
+
+  if ((record->bufPayload.buffer == NULL) || (record->bufPayload.length < NDEF_RTD_CR_LENGTH)) {
+    return ERR_PROTO;
+  }
+
+  return ndefRtdCollisionResolutionInit(type, GETU16(record->bufPayload.buffer));
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRtdCollisionResolutionToRecord(const ndefType *type, ndefRecord *record)
+{
+  if ((type   == NULL) || (type->id != NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION) ||
+      (record == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ndefRecordReset(record);
+
+  /* "cr" */
+  (void)ndefRecordSetType(record, NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeCollisionResolution);
+
+  (void)ndefRecordSetNdefType(record, type);
+
+  return ERR_NONE;
+}
+
+#endif
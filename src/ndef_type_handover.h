@@ -0,0 +1,328 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_type_handover.h
+  * @brief          : NDEF RTD Connection Handover types header file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NDEF_TYPE_HANDOVER_H
+#define NDEF_TYPE_HANDOVER_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_record.h"
+#include "ndef_buffer.h"
+
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+
+/*! RTD Connection Handover defines */
+#define NDEF_HANDOVER_VERSION_1_5               0x15U   /*!< Connection Handover version 1.5               */
+
+#define NDEF_HANDOVER_CPS_INACTIVE              0x00U   /*!< Carrier Power State: inactive                 */
+#define NDEF_HANDOVER_CPS_ACTIVE                0x01U   /*!< Carrier Power State: active                   */
+#define NDEF_HANDOVER_CPS_ACTIVATING            0x02U   /*!< Carrier Power State: activating               */
+#define NDEF_HANDOVER_CPS_UNKNOWN               0x03U   /*!< Carrier Power State: unknown                  */
+#define NDEF_HANDOVER_CPS_MASK                  0x03U   /*!< Carrier Power State mask                      */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*! RTD Handover Select or Handover Request */
+typedef struct {
+  uint8_t            version;          /*!< Connection Handover version                                   */
+  const ndefMessage *message;          /*!< Local records (ac, cr) to encode, NULL when decoded           */
+  ndefConstBuffer    bufLocalRecords;  /*!< Raw local records, set when decoded from a record             */
+} ndefTypeRtdHandover;
+
+
+/*! RTD Alternative Carrier */
+typedef struct {
+  uint8_t          cps;                /*!< Carrier Power State                                           */
+  ndefConstBuffer8 bufCarrierDataRef;  /*!< Carrier Data Reference, i.e. the Id of the carrier record     */
+  uint8_t          auxDataRefCount;    /*!< Number of Auxiliary Data References                           */
+  ndefConstBuffer  bufAuxDataRefs;     /*!< Raw Auxiliary Data References (length-prefixed)               */
+} ndefTypeRtdAlternativeCarrier;
+
+
+/*! RTD Collision Resolution */
+typedef struct {
+  uint8_t          randomNumber[2];    /*!< Random number (Big Endian)                                    */
+} ndefTypeRtdCollisionResolution;
+
+
+/*! RTD Connection Handover Record Type buffers */
+extern const ndefConstBuffer8 bufRtdTypeHandoverSelect;         /*! Handover Select Record Type buffer      */
+extern const ndefConstBuffer8 bufRtdTypeHandoverRequest;        /*! Handover Request Record Type buffer     */
+extern const ndefConstBuffer8 bufRtdTypeAlternativeCarrier;     /*! Alternative Carrier Record Type buffer  */
+extern const ndefConstBuffer8 bufRtdTypeCollisionResolution;    /*! Collision Resolution Record Type buffer */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/****************************************
+ * Handover Select and Handover Request
+ ****************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize a Handover Select RTD type
+ *
+ * The local records (Alternative Carrier records) are referenced, not copied.
+ * They must be appended to the local message before the type is converted
+ * to a record.
+ *
+ * \param[out] type:         Type to initialize
+ * \param[in]  version:      Connection Handover version
+ * \param[in]  localMessage: Message made of the Alternative Carrier records
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdHandoverSelectInit(ndefType *type, uint8_t version, const ndefMessage *localMessage);
+
+
+/*!
+ *****************************************************************************
+ * Initialize a Handover Request RTD type
+ *
+ * \param[out] type:         Type to initialize
+ * \param[in]  version:      Connection Handover version
+ * \param[in]  localMessage: Message made of the Collision Resolution record
+ *                           followed by the Alternative Carrier records
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdHandoverRequestInit(ndefType *type, uint8_t version, const ndefMessage *localMessage);
+
+
+/*!
+ *****************************************************************************
+ * Get the n-th Alternative Carrier of a Handover Select or Request RTD type
+ *
+ * \param[in]  type:  Handover Select or Request type
+ * \param[in]  index: Alternative Carrier index, starting at 0
+ * \param[out] ac:    Alternative Carrier type
+ *
+ * \return ERR_NOTFOUND if there is no such Alternative Carrier
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefGetRtdHandoverAlternativeCarrier(const ndefType *type, uint32_t index, ndefType *ac);
+
+
+/*!
+ *****************************************************************************
+ * Get the Collision Resolution of a Handover Request RTD type
+ *
+ * \param[in]  type: Handover Request type
+ * \param[out] cr:   Collision Resolution type
+ *
+ * \return ERR_NOTFOUND if there is no Collision Resolution record
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefGetRtdHandoverCollisionResolution(const ndefType *type, ndefType *cr);
+
+
+/*!
+ *****************************************************************************
+ * Convert an NDEF record to a Handover Select RTD type
+ *
+ * \param[in]  record: Record to convert
+ * \param[out] type:   The converted type
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRecordToRtdHandoverSelect(const ndefRecord *record, ndefType *type);
+
+
+/*!
+ *****************************************************************************
+ * Convert an NDEF record to a Handover Request RTD type
+ *
+ * \param[in]  record: Record to convert
+ * \param[out] type:   The converted type
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRecordToRtdHandoverRequest(const ndefRecord *record, ndefType *type);
+
+
+/*!
+ *****************************************************************************
+ * Convert a Handover Select or Request RTD type to an NDEF record
+ *
+ * \param[in]  type:   Type to convert
+ * \param[out] record: The converted type
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdHandoverToRecord(const ndefType *type, ndefRecord *record);
+
+
+/************************
+ * Alternative Carrier
+ ************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize an Alternative Carrier RTD type
+ *
+ * \param[out] type:              Type to initialize
+ * \param[in]  cps:               Carrier Power State
+ * \param[in]  bufCarrierDataRef: Id of the carrier configuration record
+ * \param[in]  auxDataRefCount:   Number of Auxiliary Data References
+ * \param[in]  bufAuxDataRefs:    Raw length-prefixed Auxiliary Data References, NULL if none
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdAlternativeCarrierInit(ndefType *type, uint8_t cps, const ndefConstBuffer8 *bufCarrierDataRef, uint8_t auxDataRefCount, const ndefConstBuffer *bufAuxDataRefs);
+
+
+/*!
+ *****************************************************************************
+ * Get Alternative Carrier RTD type content
+ *
+ * \param[in]  type:              Type to get information from
+ * \param[out] cps:               Carrier Power State
+ * \param[out] bufCarrierDataRef: Id of the carrier configuration record
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefGetRtdAlternativeCarrier(const ndefType *type, uint8_t *cps, ndefConstBuffer8 *bufCarrierDataRef);
+
+
+/*!
+ *****************************************************************************
+ * Convert an NDEF record to an Alternative Carrier RTD type
+ *
+ * \param[in]  record: Record to convert
+ * \param[out] type:   The converted type
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRecordToRtdAlternativeCarrier(const ndefRecord *record, ndefType *type);
+
+
+/*!
+ *****************************************************************************
+ * Convert an Alternative Carrier RTD type to an NDEF record
+ *
+ * \param[in]  type:   Type to convert
+ * \param[out] record: The converted type
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdAlternativeCarrierToRecord(const ndefType *type, ndefRecord *record);
+
+
+/************************
+ * Collision Resolution
+ ************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize a Collision Resolution RTD type
+ *
+ * \param[out] type:         Type to initialize
+ * \param[in]  randomNumber: Random number
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdCollisionResolutionInit(ndefType *type, uint16_t randomNumber);
+
+
+/*!
+ *****************************************************************************
+ * Get Collision Resolution RTD type content
+ *
+ * \param[in]  type:         Type to get information from
+ * \param[out] randomNumber: Random number
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefGetRtdCollisionResolution(const ndefType *type, uint16_t *randomNumber);
+
+
+/*!
+ *****************************************************************************
+ * Convert an NDEF record to a Collision Resolution RTD type
+ *
+ * \param[in]  record: Record to convert
+ * \param[out] type:   The converted type
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRecordToRtdCollisionResolution(const ndefRecord *record, ndefType *type);
+
+
+/*!
+ *****************************************************************************
+ * Convert a Collision Resolution RTD type to an NDEF record
+ *
+ * \param[in]  type:   Type to convert
+ * \param[out] record: The converted type
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdCollisionResolutionToRecord(const ndefType *type, ndefRecord *record);
+
+
+
+#endif /* NDEF_TYPE_HANDOVER_H */
+
+/**
+  * @}
+  *
+  */
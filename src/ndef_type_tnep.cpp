@@ -197,6 +197,7 @@ uint8_t ndefRtdTnepServiceParameterComputeWtInt(float twait)
 {
   return ceil(4 * ((log(twait) / 0.69314) + 1));
 }
+#endif
 
 
 /*****************************************************************************/
@@ -204,7 +205,6 @@ float ndefRtdTnepServiceParameterComputeTwait(uint8_t wtInt)
 {
   return powf(2, (((float)wtInt / 4) - 1));
 }
-#endif
 
 
 /*****************************************************************************/
@@ -24,6 +24,7 @@
 
 #include "ndef_record.h"
 #include "ndef_types.h"
+#include "ndef_message.h"
 #include "ndef_type_uri.h"
 #include "nfc_utils.h"
 
@@ -139,6 +140,28 @@ static const ndefConstBuffer ndefUriPrefix[NDEF_URI_PREFIX_COUNT] = {
   { ndefUriPrefixEmpty, sizeof(ndefUriPrefixEmpty) - 1U }
 };
 
+/*! URI prefix codes bucketed by first character, longest prefix first within a bucket */
+static const uint8_t ndefUriPrefixByChar[] = {
+  /* b */ NDEF_URI_PREFIX_BTL2CAP, NDEF_URI_PREFIX_BTGOEP, NDEF_URI_PREFIX_BTSPP,
+  /* d */ NDEF_URI_PREFIX_DAV,
+  /* f */ NDEF_URI_PREFIX_FTP_ANONYMOUS, NDEF_URI_PREFIX_FTP_FTP, NDEF_URI_PREFIX_FTPS, NDEF_URI_PREFIX_FILE, NDEF_URI_PREFIX_FTP,
+  /* h */ NDEF_URI_PREFIX_HTTPS_WWW, NDEF_URI_PREFIX_HTTP_WWW, NDEF_URI_PREFIX_HTTPS, NDEF_URI_PREFIX_HTTP,
+  /* i */ NDEF_URI_PREFIX_IRDAOBEX, NDEF_URI_PREFIX_IMAP,
+  /* m */ NDEF_URI_PREFIX_MAILTO,
+  /* n */ NDEF_URI_PREFIX_NFS, NDEF_URI_PREFIX_NEWS,
+  /* p */ NDEF_URI_PREFIX_POP,
+  /* r */ NDEF_URI_PREFIX_RTSP,
+  /* s */ NDEF_URI_PREFIX_SFTP, NDEF_URI_PREFIX_SMB, NDEF_URI_PREFIX_SIPS, NDEF_URI_PREFIX_SIP,
+  /* t */ NDEF_URI_PREFIX_TCPOBEX, NDEF_URI_PREFIX_TELNET, NDEF_URI_PREFIX_TFTP, NDEF_URI_PREFIX_TEL,
+  /* u */ NDEF_URI_PREFIX_URN_EPC_PAT, NDEF_URI_PREFIX_URN_EPC_RAW, NDEF_URI_PREFIX_URN_EPC_ID, NDEF_URI_PREFIX_URN_EPC_TAG,
+          NDEF_URI_PREFIX_URN_EPC, NDEF_URI_PREFIX_URN_NFC, NDEF_URI_PREFIX_URN
+};
+
+/*! Start of each 'a'..'z' bucket in ndefUriPrefixByChar, the last entry ends the 'z' bucket */
+static const uint8_t ndefUriPrefixBucket[('z' - 'a') + 2] = {
+  0,  0,  3,  3,  4,  4,  9,  9, 13, 15, 15, 15, 15, 16, 18, 18, 19, 19, 20, 24, 28, 35, 35, 35, 35, 35, 35
+};
+
 
 /*
  ******************************************************************************
@@ -217,28 +240,48 @@ static const uint8_t *ndefRtdUriToPayloadItem(const ndefType *uri, ndefConstBuff
 }
 
 
-/*****************************************************************************/
+/*!
+ *****************************************************************************
+ * \brief Find the longest URI prefix of a URI string
+ *
+ * Only the prefixes sharing the first character of the URI are compared,
+ * longest first, so the first match is the best abbreviation.
+ *****************************************************************************
+ */
 static ReturnCode ndefRtdUriProtocolAutodetect(uint8_t *protocol, ndefConstBuffer *bufUriString)
 {
+  const ndefConstBuffer *prefix;
+  uint8_t                c;
+
   if ((protocol  == NULL)                       ||
       (*protocol != NDEF_URI_PREFIX_AUTODETECT) ||
-      (bufUriString == NULL)) {
+      (bufUriString == NULL) || (bufUriString->buffer == NULL)) {
     return ERR_PARAM;
   }
 
-  for (uint8_t i = 0; i < NDEF_URI_PREFIX_COUNT; i++) { /* Protocol fits in 1 byte => uint8_t */
-    if (ndefUriPrefix[i].length > 0U) {
-      if (ST_BYTECMP(bufUriString->buffer, ndefUriPrefix[i].buffer, ndefUriPrefix[i].length) == 0) {
-        *protocol = i;
-        /* Move after the protocol string */
-        bufUriString->buffer  = &bufUriString->buffer[ndefUriPrefix[i].length];
-        bufUriString->length -= ndefUriPrefix[i].length;
-        return ERR_NONE;
-      }
-    }
+  *protocol = NDEF_URI_PREFIX_NONE;
+
+  if (bufUriString->length == 0U) {
+    return ERR_NOTFOUND;
   }
 
-  *protocol = NDEF_URI_PREFIX_NONE;
+  c = bufUriString->buffer[0];
+  if ((c < (uint8_t)'a') || (c > (uint8_t)'z')) {
+    return ERR_NOTFOUND;
+  }
+  c -= (uint8_t)'a';
+
+  for (uint8_t i = ndefUriPrefixBucket[c]; i < ndefUriPrefixBucket[c + 1U]; i++) {
+    prefix = &ndefUriPrefix[ndefUriPrefixByChar[i]];
+    if ((prefix->length <= bufUriString->length) &&
+        (ST_BYTECMP(bufUriString->buffer, prefix->buffer, prefix->length) == 0)) {
+      *protocol = ndefUriPrefixByChar[i];
+      /* Move after the protocol string */
+      bufUriString->buffer  = &bufUriString->buffer[prefix->length];
+      bufUriString->length -= prefix->length;
+      return ERR_NONE;
+    }
+  }
 
   return ERR_NOTFOUND;
 }
@@ -367,4 +410,50 @@ ReturnCode ndefRtdUriToRecord(const ndefType *uri, ndefRecord *record)
   return ERR_NONE;
 }
 
+
+/*****************************************************************************/
+ReturnCode ndefRtdUriEncodeBatch(const ndefConstBuffer *bufUriStrings, uint32_t count, ndefBuffer *bufMessages, uint32_t *messageLen)
+{
+  ReturnCode  err;
+  ndefType    uri;
+  ndefRecord  record;
+  ndefMessage message;
+  ndefBuffer  bufMessage;
+  uint32_t    offset;
+  uint32_t    i;
+
+  if ((bufUriStrings == NULL) || (bufMessages == NULL) || (bufMessages->buffer == NULL) || (messageLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMSET(messageLen, 0, count * sizeof(uint32_t));
+
+  offset = 0;
+  for (i = 0; i < count; i++) {
+    err = ndefRtdUriInit(&uri, NDEF_URI_PREFIX_AUTODETECT, &bufUriStrings[i]);
+    if (err != ERR_NONE) {
+      return err;
+    }
+    (void)ndefRtdUriToRecord(&uri, &record);
+    (void)ndefMessageInit(&message);
+    (void)ndefMessageAppend(&message, &record);
+
+    bufMessage.buffer = &bufMessages->buffer[offset];
+    bufMessage.length = bufMessages->length - offset;
+    err = ndefMessageEncode(&message, &bufMessage);
+    if (err != ERR_NONE) {
+      /* Messages 0..i-1 are encoded, the caller may flush them and resume at i */
+      bufMessages->length = offset;
+      return err;
+    }
+
+    messageLen[i] = bufMessage.length;
+    offset       += bufMessage.length;
+  }
+
+  bufMessages->length = offset;
+
+  return ERR_NONE;
+}
+
 #endif
@@ -161,6 +161,29 @@ ReturnCode ndefRecordToRtdUri(const ndefRecord *record, ndefType *uri);
 ReturnCode ndefRtdUriToRecord(const ndefType *uri, ndefRecord *record);
 
 
+/*!
+ *****************************************************************************
+ * Encode a batch of single URI record NDEF messages
+ *
+ * Each URI string is abbreviated with its longest URI prefix and encoded as
+ * a raw NDEF message made of one URI record, ready to be written to a tag.
+ * The messages are stored back to back in bufMessages.
+ *
+ * \param[in]     bufUriStrings: Array of full URI strings
+ * \param[in]     count:         Number of URI strings
+ * \param[in,out] bufMessages:   Output buffer; on return its length is
+ *                               the length of the messages encoded
+ * \param[out]    messageLen:    Array of count message lengths, 0 for the
+ *                               messages not encoded
+ *
+ * \return ERR_NOMEM if the buffer is too short: the messages encoded so far
+ *         are kept, the next one has a 0 length
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefRtdUriEncodeBatch(const ndefConstBuffer *bufUriStrings, uint32_t count, ndefBuffer *bufMessages, uint32_t *messageLen);
+
+
 
 #endif /* NDEF_TYPE_URI_H */
 
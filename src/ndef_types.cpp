@@ -40,94 +40,134 @@
  ******************************************************************************
  */
 
-/*! NDEF type table to associate a TNF, type and the recordToType function pointers */
+/*! NDEF type table to associate a type Id, a TNF, type and the recordToType function pointers */
 typedef struct {
+  ndefTypeId              id;            /*!< Type Id            */
   uint8_t                 tnf;           /*!< TNF                */
   const ndefConstBuffer8 *bufTypeString; /*!< Type String buffer */
   ReturnCode(*recordToType)(const ndefRecord *record, ndefType *type);  /*!< Pointer to read function  */
 } ndefTypeConverter;
 
-
-/*
- ******************************************************************************
- * LOCAL VARIABLES
- ******************************************************************************
- */
+/*! Build a converter table entry from a NDEF_TYPE_REGISTRY entry */
+#define NDEF_TYPE_CONVERTER(id, tnf, bufTypeString, recordToType)  { (id), (tnf), &(bufTypeString), (recordToType) },
 
 
 /*
  ******************************************************************************
- * LOCAL FUNCTION PROTOTYPES
- ******************************************************************************
- */
-
-
-/*
- ******************************************************************************
- * GLOBAL FUNCTIONS
+ * LOCAL VARIABLES
  ******************************************************************************
  */
 
-
-/*****************************************************************************/
-ReturnCode ndefRecordToType(const ndefRecord *record, ndefType *type)
-{
 #if NDEF_TYPE_EMPTY_SUPPORT
-  /*! Empty string */
-  static const uint8_t    ndefTypeEmpty[] = "";    /*!< Empty string */
-  static ndefConstBuffer8 bufTypeEmpty    = { ndefTypeEmpty, sizeof(ndefTypeEmpty) - 1U };
+/*! Empty string */
+static const uint8_t          ndefTypeEmpty[] = "";    /*!< Empty string */
+static const ndefConstBuffer8 bufTypeEmpty    = { ndefTypeEmpty, sizeof(ndefTypeEmpty) - 1U };
 #endif
 
-  /*! Array to match RTD strings with Well-known types, and converting functions */
-  static const ndefTypeConverter typeConverterTable[] = {
+/*! Array to match RTD strings with Well-known types, and converting functions */
+static const ndefTypeConverter typeConverterTable[] = {
+#if defined(NDEF_TYPE_REGISTRY)
+  /* Application provided registry: only the listed converters are linked */
+  NDEF_TYPE_REGISTRY(NDEF_TYPE_CONVERTER)
+#else
 #if NDEF_TYPE_EMPTY_SUPPORT
-    { NDEF_TNF_EMPTY,               &bufTypeEmpty,            ndefRecordToEmptyType        },
+  { NDEF_TYPE_ID_EMPTY,                      NDEF_TNF_EMPTY,               &bufTypeEmpty,                   ndefRecordToEmptyType               },
 #endif
 #if NDEF_TYPE_RTD_DEVICE_INFO_SUPPORT
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeDeviceInfo,    ndefRecordToRtdDeviceInfo    },
+  { NDEF_TYPE_ID_RTD_DEVICE_INFO,            NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeDeviceInfo,           ndefRecordToRtdDeviceInfo           },
 #endif
 #if NDEF_TYPE_RTD_TEXT_SUPPORT
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeText,          ndefRecordToRtdText          },
+  { NDEF_TYPE_ID_RTD_TEXT,                   NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeText,                 ndefRecordToRtdText                 },
 #endif
 #if NDEF_TYPE_RTD_URI_SUPPORT
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeUri,           ndefRecordToRtdUri           },
+  { NDEF_TYPE_ID_RTD_URI,                    NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeUri,                  ndefRecordToRtdUri                  },
 #endif
 #if NDEF_TYPE_RTD_AAR_SUPPORT
-    { NDEF_TNF_RTD_EXTERNAL_TYPE,   &bufRtdTypeAar,           ndefRecordToRtdAar           },
+  { NDEF_TYPE_ID_RTD_AAR,                    NDEF_TNF_RTD_EXTERNAL_TYPE,   &bufRtdTypeAar,                  ndefRecordToRtdAar                  },
 #endif
 #if NDEF_TYPE_RTD_WLC_SUPPORT
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcCapability, ndefRecordToRtdWlcCapability },
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcStatusInfo, ndefRecordToRtdWlcStatusInfo },
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcPollInfo,   ndefRecordToRtdWlcPollInfo   },
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcListenCtl,  ndefRecordToRtdWlcListenCtl  },
+  { NDEF_TYPE_ID_RTD_WLCCAP,                 NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcCapability,        ndefRecordToRtdWlcCapability        },
+  { NDEF_TYPE_ID_RTD_WLCSTAI,                NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcStatusInfo,        ndefRecordToRtdWlcStatusInfo        },
+  { NDEF_TYPE_ID_RTD_WLCINFO,                NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcPollInfo,          ndefRecordToRtdWlcPollInfo          },
+  { NDEF_TYPE_ID_RTD_WLCCTL,                 NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufTypeRtdWlcListenCtl,         ndefRecordToRtdWlcListenCtl         },
 #endif
 #if NDEF_TYPE_RTD_WPCWLC_SUPPORT
-    { NDEF_TNF_RTD_EXTERNAL_TYPE,   &bufRtdTypeWpcWlc,        ndefRecordToRtdWpcWlc        },
+  { NDEF_TYPE_ID_RTD_WPCWLC,                 NDEF_TNF_RTD_EXTERNAL_TYPE,   &bufRtdTypeWpcWlc,               ndefRecordToRtdWpcWlc               },
 #endif
 #if NDEF_TYPE_RTD_TNEP_SUPPORT
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeTnepServiceParameter, ndefRecordToRtdTnepServiceParameter },
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeTnepServiceSelect,    ndefRecordToRtdTnepServiceSelect    },
-    { NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeTnepStatus,           ndefRecordToRtdTnepStatus           },
+  { NDEF_TYPE_ID_RTD_TNEP_SERVICE_PARAMETER, NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeTnepServiceParameter, ndefRecordToRtdTnepServiceParameter },
+  { NDEF_TYPE_ID_RTD_TNEP_SERVICE_SELECT,    NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeTnepServiceSelect,    ndefRecordToRtdTnepServiceSelect    },
+  { NDEF_TYPE_ID_RTD_TNEP_STATUS,            NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeTnepStatus,           ndefRecordToRtdTnepStatus           },
+#endif
+#if NDEF_TYPE_RTD_HANDOVER_SUPPORT
+  { NDEF_TYPE_ID_RTD_HANDOVER_SELECT,        NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeHandoverSelect,       ndefRecordToRtdHandoverSelect       },
+  { NDEF_TYPE_ID_RTD_HANDOVER_REQUEST,       NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeHandoverRequest,      ndefRecordToRtdHandoverRequest      },
+  { NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER,    NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeAlternativeCarrier,   ndefRecordToRtdAlternativeCarrier   },
+  { NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION,   NDEF_TNF_RTD_WELL_KNOWN_TYPE, &bufRtdTypeCollisionResolution,  ndefRecordToRtdCollisionResolution  },
 #endif
 #if NDEF_TYPE_BLUETOOTH_SUPPORT
-    { NDEF_TNF_MEDIA_TYPE, &bufMediaTypeBluetoothBrEdr,       ndefRecordToBluetooth        },
-    { NDEF_TNF_MEDIA_TYPE, &bufMediaTypeBluetoothLe,          ndefRecordToBluetooth        },
-    { NDEF_TNF_MEDIA_TYPE, &bufMediaTypeBluetoothSecureBrEdr, ndefRecordToBluetooth        },
-    { NDEF_TNF_MEDIA_TYPE, &bufMediaTypeBluetoothSecureLe,    ndefRecordToBluetooth        },
+  { NDEF_TYPE_ID_BLUETOOTH_BREDR,            NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeBluetoothBrEdr,       ndefRecordToBluetooth               },
+  { NDEF_TYPE_ID_BLUETOOTH_LE,               NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeBluetoothLe,          ndefRecordToBluetooth               },
+  { NDEF_TYPE_ID_BLUETOOTH_SECURE_BREDR,     NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeBluetoothSecureBrEdr, ndefRecordToBluetooth               },
+  { NDEF_TYPE_ID_BLUETOOTH_SECURE_LE,        NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeBluetoothSecureLe,    ndefRecordToBluetooth               },
 #endif
 #if NDEF_TYPE_VCARD_SUPPORT
-    { NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeVCard,       ndefRecordToVCard            },
+  { NDEF_TYPE_ID_MEDIA_VCARD,                NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeVCard,                ndefRecordToVCard                   },
 #endif
 #if NDEF_TYPE_WIFI_SUPPORT
-    { NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeWifi,        ndefRecordToWifi             },
+  { NDEF_TYPE_ID_MEDIA_WIFI,                 NDEF_TNF_MEDIA_TYPE,          &bufMediaTypeWifi,                 ndefRecordToWifi                    },
 #endif
-    /* Non-conditional field to avoid empty union when all types are disabled */
-    { 0,                            NULL,                     NULL                         }
-  };
+#endif /* NDEF_TYPE_REGISTRY */
+  /* Non-conditional field to avoid empty union when all types are disabled */
+  { NDEF_TYPE_ID_NONE,                       0,                            NULL,                              NULL                                }
+};
 
-  const ndefType *ndefData;
 
-  if (type == NULL) {
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * \brief Find the type table entry of a type Id
+ *
+ * \param[in] id: Type Id
+ *
+ * \return the table entry, NULL if the type is not in the table
+ *****************************************************************************
+ */
+static const ndefTypeConverter *ndefTypeFindConverter(ndefTypeId id)
+{
+  const ndefTypeConverter *converter;
+
+  for (converter = typeConverterTable; converter->recordToType != NULL; converter++) {
+    if (converter->id == id) {
+      return converter;
+    }
+  }
+
+  return NULL;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefRecordToType(const ndefRecord *record, ndefType *type)
+{
+  const ndefType         *ndefData;
+  const ndefTypeConverter *converter;
+  uint8_t                 tnf;
+
+  if ((record == NULL) || (type == NULL)) {
     return ERR_PARAM;
   }
 
@@ -138,12 +178,14 @@ ReturnCode ndefRecordToType(const ndefRecord *record, ndefType *type)
     return ERR_NONE;
   }
 
-  for (int32_t i = 0; i < (int32_t)SIZEOF_ARRAY(typeConverterTable); i++) {
-    if (ndefRecordTypeMatch(record, typeConverterTable[i].tnf, typeConverterTable[i].bufTypeString)) {
+  /* Compare TNF and type length first, the type string only when both match */
+  tnf = ndefHeaderTNF(record);
+  for (converter = typeConverterTable; converter->recordToType != NULL; converter++) {
+    if ((converter->tnf                   == tnf)                &&
+        (converter->bufTypeString->length == record->typeLength) &&
+        (ST_BYTECMP(record->type, converter->bufTypeString->buffer, record->typeLength) == 0)) {
       /* Call the appropriate function to the matching type */
-      if (typeConverterTable[i].recordToType != NULL) {
-        return typeConverterTable[i].recordToType(record, type);
-      }
+      return converter->recordToType(record, type);
     }
   }
 
@@ -162,6 +204,13 @@ ReturnCode ndefTypeToRecord(const ndefType *type, ndefRecord *record)
     return ERR_PARAM;
   }
 
+#if defined(NDEF_TYPE_REGISTRY)
+  /* Only the registered types, and the flat type records fall back to, are converted */
+  if ((type->id != NDEF_TYPE_ID_FLAT) && (ndefTypeFindConverter(type->id) == NULL)) {
+    return ERR_NOT_IMPLEMENTED;
+  }
+#endif
+
   if (type->typeToRecord != NULL) {
     return type->typeToRecord(type, record);
   }
@@ -170,6 +219,28 @@ ReturnCode ndefTypeToRecord(const ndefType *type, ndefRecord *record)
 }
 
 
+/*****************************************************************************/
+ReturnCode ndefTypeGetTypeString(ndefTypeId id, uint8_t *tnf, ndefConstBuffer8 *bufTypeString)
+{
+  const ndefTypeConverter *converter;
+
+  if ((tnf == NULL) || (bufTypeString == NULL)) {
+    return ERR_PARAM;
+  }
+
+  converter = ndefTypeFindConverter(id);
+  if (converter == NULL) {
+    return ERR_NOTFOUND;
+  }
+
+  *tnf                  = converter->tnf;
+  bufTypeString->buffer = converter->bufTypeString->buffer;
+  bufTypeString->length = converter->bufTypeString->length;
+
+  return ERR_NONE;
+}
+
+
 /*****************************************************************************/
 ReturnCode ndefRecordSetNdefType(ndefRecord *record, const ndefType *type)
 {
@@ -191,6 +262,8 @@ ReturnCode ndefRecordSetNdefType(ndefRecord *record, const ndefType *type)
   payloadLength = ndefRecordGetPayloadLength(record);
   ndefHeaderSetValueSR(record, (payloadLength <= NDEF_SHORT_RECORD_LENGTH_MAX) ? 1 : 0);
 
+  ndefRecordSetChanged(record);
+
   return ERR_NONE;
 }
 
@@ -59,6 +59,9 @@
 #if NDEF_TYPE_RTD_TNEP_SUPPORT
   #include "ndef_type_tnep.h"
 #endif
+#if NDEF_TYPE_RTD_HANDOVER_SUPPORT
+  #include "ndef_type_handover.h"
+#endif
 
 /* MIME types */
 #if NDEF_TYPE_MEDIA_SUPPORT
@@ -108,6 +111,10 @@ typedef enum {
   NDEF_TYPE_ID_RTD_TNEP_SERVICE_PARAMETER,
   NDEF_TYPE_ID_RTD_TNEP_SERVICE_SELECT,
   NDEF_TYPE_ID_RTD_TNEP_STATUS,
+  NDEF_TYPE_ID_RTD_HANDOVER_SELECT,
+  NDEF_TYPE_ID_RTD_HANDOVER_REQUEST,
+  NDEF_TYPE_ID_RTD_ALTERNATIVE_CARRIER,
+  NDEF_TYPE_ID_RTD_COLLISION_RESOLUTION,
   NDEF_TYPE_ID_MEDIA,
   NDEF_TYPE_ID_BLUETOOTH_BREDR,
   NDEF_TYPE_ID_BLUETOOTH_LE,
@@ -155,6 +162,11 @@ struct ndefTypeStruct {
     ndefTypeRtdTnepServiceSelect    tnepServiceSelect;    /*!< TNEP Service Select    */
     ndefTypeRtdTnepStatus           tnepStatus;           /*!< TNEP Status            */
 #endif
+#if NDEF_TYPE_RTD_HANDOVER_SUPPORT
+    ndefTypeRtdHandover             handover;             /*!< Handover Select/Request */
+    ndefTypeRtdAlternativeCarrier   alternativeCarrier;   /*!< Alternative Carrier     */
+    ndefTypeRtdCollisionResolution  collisionResolution;  /*!< Collision Resolution    */
+#endif
 #if NDEF_TYPE_MEDIA_SUPPORT
     ndefTypeMedia             media;            /*!< Media                */
 #endif
@@ -206,6 +218,24 @@ ReturnCode ndefRecordToType(const ndefRecord *record, ndefType *type);
 ReturnCode ndefTypeToRecord(const ndefType *type, ndefRecord *record);
 
 
+/*!
+ *****************************************************************************
+ * Get the TNF and type string of a type
+ *
+ * Looked up in the same type table as ndefRecordToType(), i.e. in
+ * NDEF_TYPE_REGISTRY when the application defines it.
+ *
+ * \param[in]  id:            Type Id
+ * \param[out] tnf:           TNF
+ * \param[out] bufTypeString: Type string
+ *
+ * \return ERR_NOTFOUND if the type is not in the type table
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefTypeGetTypeString(ndefTypeId id, uint8_t *tnf, ndefConstBuffer8 *bufTypeString);
+
+
 /*!
  *****************************************************************************
  * Set the NDEF specific structure to process NDEF types
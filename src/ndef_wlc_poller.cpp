@@ -0,0 +1,477 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_wlc_poller.cpp
+  * @brief          : NFC Forum WLC poller (WLC-P) control loop
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include <math.h>
+#include "ndef_wlc_poller.h"
+#include "ndef_message.h"
+#include "ndef_class.h"
+#include "nfc_utils.h"
+
+
+#if NDEF_TYPE_RTD_WLC_SUPPORT && NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#define NDEF_WLC_INFO_CAP    0x01U   /*!< WLC_CAP record read  */
+#define NDEF_WLC_INFO_STAI   0x02U   /*!< WLC_STAI record read */
+#define NDEF_WLC_INFO_CTL    0x04U   /*!< WLC_CTL record read  */
+
+
+/*
+ ******************************************************************************
+ * LOCAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTIONS
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * \brief Get the RF layer driving the WLC listener
+ *****************************************************************************
+ */
+static RfalRfClass *ndefWlcPollerGetRf(const ndefWlcPoller *wlc)
+{
+  RfalNfcClass *rfal_nfc = ((NdefClass *)(wlc->ctx->ndef_class_instance))->rfal_nfc;
+
+  return rfal_nfc->getRfalRf();
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Tell whether a scheduled time is reached, handling timer wrap
+ *****************************************************************************
+ */
+static bool ndefWlcPollerIsDue(uint32_t now, uint32_t time)
+{
+  return ((int32_t)(now - time) >= 0);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Read the listener NDEF message and keep its WLC records
+ *
+ * The message is walked in place so that the decoded record pool is left
+ * untouched.
+ *
+ * \param[in,out] wlc:  WLC poller context
+ * \param[out]    info: NDEF_WLC_INFO_xxx bit mask of the records read
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+static ReturnCode ndefWlcPollerReadInfo(ndefWlcPoller *wlc, uint8_t *info)
+{
+  ReturnCode      err;
+  uint32_t        rcvdLen;
+  uint32_t        offset;
+  ndefConstBuffer bufRecord;
+  ndefRecord      record;
+  ndefType        type;
+
+  *info = 0;
+
+  /* The listener updates its message: force the NDEF length to be read again */
+  err = ndefPollerReadRawMessage(wlc->ctx, wlc->buf, wlc->bufLen, &rcvdLen, false);
+  if (err != ERR_NONE) {
+    return err;
+  }
+  wlc->metrics.infoReads++;
+
+  offset = 0;
+  while (offset < rcvdLen) {
+    bufRecord.buffer = &wlc->buf[offset];
+    bufRecord.length = rcvdLen - offset;
+    err = ndefRecordDecode(&bufRecord, &record);
+    if (err != ERR_NONE) {
+      return err;
+    }
+    offset += ndefRecordGetLength(&record);
+
+    if (ndefRecordToRtdWlcCapability(&record, &type) == ERR_NONE) {
+      (void)ndefGetRtdWlcCapability(&type, &wlc->capability);
+      *info |= NDEF_WLC_INFO_CAP;
+    } else if (ndefRecordToRtdWlcStatusInfo(&record, &type) == ERR_NONE) {
+      (void)ndefGetRtdWlcStatusInfo(&type, &wlc->statusInfo);
+      *info |= NDEF_WLC_INFO_STAI;
+    } else if (ndefRecordToRtdWlcListenCtl(&record, &type) == ERR_NONE) {
+      (void)ndefGetRtdWlcListenCtl(&type, &wlc->listenCtl);
+      *info |= NDEF_WLC_INFO_CTL;
+    } else {
+      /* Not a WLC record */
+    }
+  }
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Tell whether the WLC_CTL just read has been updated by the listener
+ *
+ * The listener increments the status information CNT on each WLC_CTL
+ * update: a WLC_CTL with the same CNT as the previous one is stale.
+ *****************************************************************************
+ */
+static bool ndefWlcPollerIsCtlUpdated(const ndefWlcPoller *wlc, uint8_t info)
+{
+  if ((info & NDEF_WLC_INFO_CTL) == 0U) {
+    return false;
+  }
+
+  return (!wlc->ctlSeen || (wlc->listenCtl.statusInfoCnt != wlc->ctlCnt));
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Write the WLC_INFO message (negotiated mode)
+ *****************************************************************************
+ */
+static ReturnCode ndefWlcPollerWriteInfo(ndefWlcPoller *wlc)
+{
+  ndefType    type;
+  ndefRecord  record;
+  ndefMessage message;
+
+  (void)ndefRtdWlcPollInfoInit(&type, &wlc->pollInfo);
+  (void)ndefTypeToRecord(&type, &record);
+  (void)ndefMessageInit(&message);
+  (void)ndefMessageAppend(&message, &record);
+
+  return ndefPollerWriteMessage(wlc->ctx, &message);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Enter a terminal state
+ *
+ * \return ERR_NONE, or err when entering the error state
+ *****************************************************************************
+ */
+static ReturnCode ndefWlcPollerEnd(ndefWlcPoller *wlc, ndefWlcPollerState state, ReturnCode err)
+{
+  wlc->state = state;
+
+  return (state == NDEF_WLC_STATE_ERROR) ? err : ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Start the scheduled WPT slot and record its start deviation
+ *****************************************************************************
+ */
+static ReturnCode ndefWlcPollerStartSlot(ndefWlcPoller *wlc, uint32_t now)
+{
+  ReturnCode err;
+  uint32_t   jitter;
+
+  err = ndefWlcPollerGetRf(wlc)->rfalWlcPWptMonitorStart(NULL);
+  if (err != ERR_NONE) {
+    return err;
+  }
+
+  jitter = now - wlc->slotStart;
+  wlc->metrics.slots++;
+  wlc->metrics.jitterSum += jitter;
+  if (jitter > wlc->metrics.jitterMax) {
+    wlc->metrics.jitterMax = jitter;
+  }
+  if (jitter > NDEF_WLC_SCHEDULE_TOLERANCE) {
+    wlc->metrics.lateSlots++;
+  }
+
+  wlc->wptStart = now;
+  wlc->state    = NDEF_WLC_STATE_WPT;
+
+  return ERR_NONE;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief Apply a WLC_CTL record: schedule the next WPT slot or finish
+ *****************************************************************************
+ */
+static ReturnCode ndefWlcPollerApplyCtl(ndefWlcPoller *wlc, uint32_t now)
+{
+  wlc->ctlSeen = true;
+  wlc->ctlCnt  = wlc->listenCtl.statusInfoCnt;
+
+  if (wlc->listenCtl.statusInfoErrorFlag != 0U) {
+    return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, ERR_REQUEST);
+  }
+
+  if (wlc->listenCtl.wptConfigWptReq == 0U) {
+    /* The listener no longer requests power */
+    return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_DONE, ERR_NONE);
+  }
+
+  wlc->wptDuration = NDEF_WLC_WPT_DURATION_TO_US(wlc->listenCtl.wptConfigWptDuration);
+  wlc->slotStart   = now + NDEF_WLC_WT_INT_TO_US(wlc->listenCtl.holdOffWtInt);
+  wlc->state       = NDEF_WLC_STATE_WPT_WAIT;
+
+  return ERR_BUSY;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefWlcPollerInit(ndefWlcPoller *wlc, ndefContext *ctx, const ndefTypeRtdWlcPollInfo *pollInfo, uint8_t *buf, uint32_t bufLen)
+{
+  if ((wlc == NULL) || (ctx == NULL) || (pollInfo == NULL) || (buf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMSET(wlc, 0, sizeof(ndefWlcPoller));
+  (void)ST_MEMCPY(&wlc->pollInfo, pollInfo, sizeof(ndefTypeRtdWlcPollInfo));
+  wlc->ctx    = ctx;
+  wlc->buf    = buf;
+  wlc->bufLen = bufLen;
+  wlc->state  = NDEF_WLC_STATE_IDLE;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefWlcPollerStart(ndefWlcPoller *wlc)
+{
+  if (wlc == NULL) {
+    return ERR_PARAM;
+  }
+
+  if ((wlc->state != NDEF_WLC_STATE_IDLE) && (wlc->state < NDEF_WLC_STATE_DONE)) {
+    return ERR_WRONG_STATE;
+  }
+
+  (void)ST_MEMSET(&wlc->metrics, 0, sizeof(ndefWlcPollerMetrics));
+  wlc->retries = 0;
+  wlc->ctlSeen = false;
+  wlc->state   = NDEF_WLC_STATE_READ_CAP;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefWlcPollerWorker(ndefWlcPoller *wlc)
+{
+  ReturnCode   err;
+  RfalRfClass *rf;
+  uint32_t     now;
+  uint8_t      info;
+
+  if (wlc == NULL) {
+    return ERR_PARAM;
+  }
+
+  now = micros();
+
+  switch (wlc->state) {
+    case NDEF_WLC_STATE_READ_CAP:
+      err = ndefWlcPollerReadInfo(wlc, &info);
+      if (err != ERR_NONE) {
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, err);
+      }
+      if ((info & NDEF_WLC_INFO_CAP) == 0U) {
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, ERR_PROTO);
+      }
+      if ((info & NDEF_WLC_INFO_CTL) != 0U) {
+        /* WLC_CTL left from a previous session: not an answer to our WLC_INFO */
+        wlc->ctlSeen = true;
+        wlc->ctlCnt  = wlc->listenCtl.statusInfoCnt;
+      }
+
+      switch (wlc->capability.wlcConfigModeReq) {
+        case NDEF_RTD_WLC_CAPABILITY_MODE_STATIC:
+          /* No WLC_CTL: fixed slots, a communication slot of CAP_WT_INT in between */
+          wlc->wptDuration = NDEF_WLC_WPT_DURATION_TO_US(NDEF_WLC_STATIC_WPT_DURATION);
+          wlc->period      = wlc->wptDuration + NDEF_WLC_WT_INT_TO_US(wlc->capability.capWtInt);
+          wlc->slotStart   = now;
+          wlc->state       = NDEF_WLC_STATE_WPT_WAIT;
+          break;
+
+        case NDEF_RTD_WLC_CAPABILITY_MODE_NEGOTIATED:
+          wlc->state = NDEF_WLC_STATE_NEGOTIATE;
+          break;
+
+        case NDEF_RTD_WLC_CAPABILITY_MODE_BATTERY_FULL:
+          return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_DONE, ERR_NONE);
+
+        default:
+          return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, ERR_PROTO);
+      }
+      return ERR_BUSY;
+
+    case NDEF_WLC_STATE_NEGOTIATE:
+      err = ndefWlcPollerWriteInfo(wlc);
+      if (err != ERR_NONE) {
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, err);
+      }
+      /* Give the listener NDEF_WR_WT to process WLC_INFO and update WLC_CTL */
+      wlc->retries   = 0;
+      wlc->slotStart = micros() + NDEF_WLC_WT_INT_TO_US(wlc->capability.ndefWriteWtInt);
+      wlc->state     = NDEF_WLC_STATE_READ_CTL;
+      return ERR_BUSY;
+
+    case NDEF_WLC_STATE_READ_CTL:
+      if (!ndefWlcPollerIsDue(now, wlc->slotStart)) {
+        return ERR_BUSY;
+      }
+      err = ndefWlcPollerReadInfo(wlc, &info);
+      if (err != ERR_NONE) {
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, err);
+      }
+      if (!ndefWlcPollerIsCtlUpdated(wlc, info)) {
+        /* Missing or stale: read again after NDEF_RD_WT, up to WaitTimeRetry times */
+        if (wlc->retries >= wlc->capability.wlcConfigWaitTimeRetry) {
+          return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, ERR_TIMEOUT);
+        }
+        wlc->retries++;
+        wlc->slotStart = micros() + NDEF_WLC_WT_INT_TO_US(wlc->capability.ndefRdWt);
+        return ERR_BUSY;
+      }
+      return ndefWlcPollerApplyCtl(wlc, micros());
+
+    case NDEF_WLC_STATE_WPT_WAIT:
+      if (!ndefWlcPollerIsDue(now, wlc->slotStart)) {
+        return ERR_BUSY;
+      }
+      err = ndefWlcPollerStartSlot(wlc, now);
+      if (err != ERR_NONE) {
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, err);
+      }
+      return ERR_BUSY;
+
+    case NDEF_WLC_STATE_WPT:
+      rf = ndefWlcPollerGetRf(wlc);
+      if (rf->rfalWlcPWptIsFodDetected()) {
+        (void)rf->rfalWlcPWptMonitorStop();
+        wlc->metrics.wptTime += (now - wlc->wptStart);
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_FOD, ERR_NONE);
+      }
+      if (rf->rfalWlcPWptIsStopDetected()) {
+        (void)rf->rfalWlcPWptMonitorStop();
+        wlc->metrics.wptTime += (now - wlc->wptStart);
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_STOPPED, ERR_NONE);
+      }
+      if ((now - wlc->wptStart) < wlc->wptDuration) {
+        return ERR_BUSY;
+      }
+      (void)rf->rfalWlcPWptMonitorStop();
+      wlc->metrics.wptTime += (now - wlc->wptStart);
+      wlc->state = NDEF_WLC_STATE_COMM;
+      return ERR_BUSY;
+
+    case NDEF_WLC_STATE_COMM:
+      if (wlc->capability.wlcConfigModeReq == (uint8_t)NDEF_RTD_WLC_CAPABILITY_MODE_NEGOTIATED) {
+        /* Send WLC_INFO again when requested, otherwise only read WLC_CTL */
+        if (wlc->listenCtl.wptConfigInfoReq != 0U) {
+          wlc->state = NDEF_WLC_STATE_NEGOTIATE;
+        } else {
+          wlc->retries   = 0;
+          wlc->slotStart = now;
+          wlc->state     = NDEF_WLC_STATE_READ_CTL;
+        }
+        return ERR_BUSY;
+      }
+
+      /* Static mode: read the status on each communication slot, keep the slot cadence */
+      err = ndefWlcPollerReadInfo(wlc, &info);
+      if (err != ERR_NONE) {
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_ERROR, err);
+      }
+      if (((info & NDEF_WLC_INFO_CAP) != 0U) && (wlc->capability.wlcConfigModeReq == (uint8_t)NDEF_RTD_WLC_CAPABILITY_MODE_BATTERY_FULL)) {
+        return ndefWlcPollerEnd(wlc, NDEF_WLC_STATE_DONE, ERR_NONE);
+      }
+      wlc->slotStart += wlc->period;
+      wlc->state      = NDEF_WLC_STATE_WPT_WAIT;
+      return ERR_BUSY;
+
+    case NDEF_WLC_STATE_IDLE:
+      return ERR_WRONG_STATE;
+
+    case NDEF_WLC_STATE_ERROR:
+      return ERR_REQUEST;
+
+    default:
+      /* Terminal states */
+      return ERR_NONE;
+  }
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefWlcPollerStop(ndefWlcPoller *wlc)
+{
+  if (wlc == NULL) {
+    return ERR_PARAM;
+  }
+
+  if (wlc->state == NDEF_WLC_STATE_WPT) {
+    (void)ndefWlcPollerGetRf(wlc)->rfalWlcPWptMonitorStop();
+    wlc->metrics.wptTime += (micros() - wlc->wptStart);
+  }
+
+  wlc->state = NDEF_WLC_STATE_IDLE;
+
+  return ERR_NONE;
+}
+
+
+/*****************************************************************************/
+ndefWlcPollerState ndefWlcPollerGetState(const ndefWlcPoller *wlc)
+{
+  return (wlc != NULL) ? wlc->state : NDEF_WLC_STATE_IDLE;
+}
+
+
+/*****************************************************************************/
+ReturnCode ndefWlcPollerGetMetrics(const ndefWlcPoller *wlc, ndefWlcPollerMetrics *metrics)
+{
+  if ((wlc == NULL) || (metrics == NULL)) {
+    return ERR_PARAM;
+  }
+
+  (void)ST_MEMCPY(metrics, &wlc->metrics, sizeof(ndefWlcPollerMetrics));
+
+  return ERR_NONE;
+}
+
+#endif /* NDEF_TYPE_RTD_WLC_SUPPORT && NDEF_FEATURE_FULL_API */
@@ -0,0 +1,212 @@
+
+/**
+  ******************************************************************************
+  * @file           : ndef_wlc_poller.h
+  * @brief          : NFC Forum WLC poller (WLC-P) control loop header file
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2021 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#ifndef NDEF_WLC_POLLER_H
+#define NDEF_WLC_POLLER_H
+
+
+
+/*
+ ******************************************************************************
+ * INCLUDES
+ ******************************************************************************
+ */
+
+#include "ndef_poller.h"
+#include "ndef_types.h"
+
+
+#if NDEF_TYPE_RTD_WLC_SUPPORT && NDEF_FEATURE_FULL_API
+
+/*
+ ******************************************************************************
+ * GLOBAL DEFINES
+ ******************************************************************************
+ */
+
+#ifndef NDEF_WLC_STATIC_WPT_DURATION
+  #define NDEF_WLC_STATIC_WPT_DURATION   20U     /*!< WPT_DURATION used in static mode, where there is no WLC_CTL */
+#endif
+
+#ifndef NDEF_WLC_SCHEDULE_TOLERANCE
+  #define NDEF_WLC_SCHEDULE_TOLERANCE    1000U   /*!< Slot start deviation (us) above which a slot is counted late */
+#endif
+
+/*! WT_INT encoded time to us: 2^(WT_INT/4 - 1) ms */
+#ifndef NDEF_WLC_WT_INT_TO_US
+  #define NDEF_WLC_WT_INT_TO_US(wtInt)          ((uint32_t)(powf(2.0f, ((float)(wtInt) / 4.0f) - 1.0f) * 1000.0f))
+#endif
+
+/*! WPT_DURATION encoded time to us: 2^(WPT_DURATION/4 + 3) ms */
+#ifndef NDEF_WLC_WPT_DURATION_TO_US
+  #define NDEF_WLC_WPT_DURATION_TO_US(duration) ((uint32_t)(powf(2.0f, ((float)(duration) / 4.0f) + 3.0f) * 1000.0f))
+#endif
+
+
+/*
+ ******************************************************************************
+ * GLOBAL TYPES
+ ******************************************************************************
+ */
+
+
+/*! WLC poller states */
+typedef enum {
+  NDEF_WLC_STATE_IDLE,                  /*!< Not started                                        */
+  NDEF_WLC_STATE_READ_CAP,              /*!< Read WLC_CAP (and WLC_STAI) from the listener      */
+  NDEF_WLC_STATE_NEGOTIATE,             /*!< Write WLC_INFO (negotiated mode)                   */
+  NDEF_WLC_STATE_READ_CTL,              /*!< Read WLC_CTL once the write wait time has elapsed  */
+  NDEF_WLC_STATE_WPT_WAIT,              /*!< Wait for the scheduled WPT slot                    */
+  NDEF_WLC_STATE_WPT,                   /*!< Power transfer, FOD and stop monitored             */
+  NDEF_WLC_STATE_COMM,                  /*!< Communication slot after power transfer            */
+  NDEF_WLC_STATE_DONE,                  /*!< Charging complete or no more WPT requested         */
+  NDEF_WLC_STATE_FOD,                   /*!< Foreign object detected, power transfer stopped    */
+  NDEF_WLC_STATE_STOPPED,               /*!< WPT stop sequence detected                         */
+  NDEF_WLC_STATE_ERROR                  /*!< Communication or protocol error                    */
+} ndefWlcPollerState;
+
+
+/*! WLC poller schedule metrics */
+typedef struct {
+  uint32_t slots;                       /*!< WPT slots started                                  */
+  uint32_t lateSlots;                   /*!< Slots started later than NDEF_WLC_SCHEDULE_TOLERANCE */
+  uint32_t jitterMax;                   /*!< Maximum slot start deviation (us)                  */
+  uint32_t jitterSum;                   /*!< Sum of slot start deviations (us)                  */
+  uint32_t wptTime;                     /*!< Overall power transfer time (us)                   */
+  uint32_t infoReads;                   /*!< NDEF reads of the listener information             */
+} ndefWlcPollerMetrics;
+
+
+/*! WLC poller context */
+typedef struct {
+  ndefContext              *ctx;        /*!< NDEF context of the WLC listener                   */
+  ndefWlcPollerState        state;      /*!< Current state                                      */
+  ndefTypeRtdWlcCapability  capability; /*!< WLC_CAP read from the listener                     */
+  ndefTypeRtdWlcStatusInfo  statusInfo; /*!< Last WLC_STAI read from the listener               */
+  ndefTypeRtdWlcListenCtl   listenCtl;  /*!< Last WLC_CTL read from the listener                */
+  ndefTypeRtdWlcPollInfo    pollInfo;   /*!< WLC_INFO written in negotiated mode                */
+  uint8_t                  *buf;        /*!< Buffer to read the listener NDEF message           */
+  uint32_t                  bufLen;     /*!< Buffer length                                      */
+  uint32_t                  slotStart;  /*!< Scheduled time (us) of the next event              */
+  uint32_t                  wptStart;   /*!< Actual start (us) of the current WPT slot          */
+  uint32_t                  wptDuration;/*!< Duration (us) of the WPT slots                     */
+  uint32_t                  period;     /*!< Period (us) of the WPT slots in static mode        */
+  uint8_t                   retries;    /*!< WLC_CTL read retries                               */
+  bool                      ctlSeen;    /*!< A WLC_CTL has already been read or applied         */
+  uint8_t                   ctlCnt;     /*!< Status information CNT of that WLC_CTL             */
+  ndefWlcPollerMetrics      metrics;    /*!< Schedule metrics                                   */
+} ndefWlcPoller;
+
+
+/*
+ ******************************************************************************
+ * GLOBAL FUNCTION PROTOTYPES
+ ******************************************************************************
+ */
+
+
+/*!
+ *****************************************************************************
+ * Initialize the WLC poller
+ *
+ * \param[out] wlc:      WLC poller context
+ * \param[in]  ctx:      NDEF context, NDEF detected on the WLC listener
+ * \param[in]  pollInfo: WLC_INFO to advertise in negotiated mode
+ * \param[in]  buf:      Buffer to read the listener NDEF message
+ * \param[in]  bufLen:   Buffer length
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefWlcPollerInit(ndefWlcPoller *wlc, ndefContext *ctx, const ndefTypeRtdWlcPollInfo *pollInfo, uint8_t *buf, uint32_t bufLen);
+
+
+/*!
+ *****************************************************************************
+ * Start the WLC poller control loop
+ *
+ * \param[in,out] wlc: WLC poller context
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefWlcPollerStart(ndefWlcPoller *wlc);
+
+
+/*!
+ *****************************************************************************
+ * Run the WLC poller control loop
+ *
+ * Must be called periodically, as often as possible during the WPT and
+ * wait phases so that slots start on time and FOD/stop are caught early.
+ *
+ * \param[in,out] wlc: WLC poller context
+ *
+ * \return ERR_BUSY while the control loop is running
+ * \return ERR_NONE once finished: see ndefWlcPollerGetState() for the reason
+ * \return a standard error code on communication or protocol error
+ *****************************************************************************
+ */
+ReturnCode ndefWlcPollerWorker(ndefWlcPoller *wlc);
+
+
+/*!
+ *****************************************************************************
+ * Stop the WLC poller control loop
+ *
+ * \param[in,out] wlc: WLC poller context
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefWlcPollerStop(ndefWlcPoller *wlc);
+
+
+/*!
+ *****************************************************************************
+ * Get the WLC poller state
+ *
+ * \param[in] wlc: WLC poller context
+ *
+ * \return current state
+ *****************************************************************************
+ */
+ndefWlcPollerState ndefWlcPollerGetState(const ndefWlcPoller *wlc);
+
+
+/*!
+ *****************************************************************************
+ * Get the WLC poller schedule metrics
+ *
+ * \param[in]  wlc:     WLC poller context
+ * \param[out] metrics: Slot count, timing jitter and schedule adherence
+ *
+ * \return ERR_NONE if successful or a standard error code
+ *****************************************************************************
+ */
+ReturnCode ndefWlcPollerGetMetrics(const ndefWlcPoller *wlc, ndefWlcPollerMetrics *metrics);
+
+
+#endif /* NDEF_TYPE_RTD_WLC_SUPPORT && NDEF_FEATURE_FULL_API */
+
+#endif /* NDEF_WLC_POLLER_H */
+
+/**
+  * @}
+  *
+  */
@@ -528,6 +528,7 @@ void RfalNfcClass::rfalIsoDepInitialize(void)
   gIsoDep.APDUParam.rxBuf = NULL;
   gIsoDep.APDUParam.txBuf = NULL;
 
+  rfalIsoDepClearLinkQuality();
   isoDepClearCounters();
 }
 
@@ -545,6 +546,21 @@ void RfalNfcClass::rfalIsoDepInitializeWithParams(rfalComplianceMode compMode, u
   gIsoDep.maxRetriesRATS = maxRetriesRATS;
 }
 
+/*******************************************************************************/
+void RfalNfcClass::rfalIsoDepGetLinkQuality(rfalIsoDepLinkQuality *linkQuality)
+{
+  if (linkQuality != NULL) {
+    (*linkQuality) = gIsoDep.linkQuality;
+  }
+}
+
+/*******************************************************************************/
+void RfalNfcClass::rfalIsoDepClearLinkQuality(void)
+{
+  gIsoDep.linkQuality.blocks = 0U;
+  gIsoDep.linkQuality.errors = 0U;
+}
+
 #if RFAL_FEATURE_ISO_DEP_POLL
 /*******************************************************************************/
 ReturnCode RfalNfcClass::isoDepDataExchangePCD(uint16_t *outActRxLen, bool *outIsChaining)
@@ -584,6 +600,7 @@ ReturnCode RfalNfcClass::isoDepDataExchangePCD(uint16_t *outActRxLen, bool *outI
       ret = isoDepTx(isoDep_PCBIBlock(gIsoDep.blockNumber), gIsoDep.txBuf, &gIsoDep.txBuf[gIsoDep.txBufInfPos], gIsoDep.txBufLen, (gIsoDep.fwt + gIsoDep.dFwt));
       switch (ret) {
         case ERR_NONE:
+          gIsoDep.linkQuality.blocks++;
           gIsoDep.state = ISODEP_ST_PCD_RX;
           break;
 
@@ -605,6 +622,8 @@ ReturnCode RfalNfcClass::isoDepDataExchangePCD(uint16_t *outActRxLen, bool *outI
         case ERR_FRAMING:         /* added to handle test cases scenario TC_POL_NFCB_T4AT_BI_82_x_y & TC_POL_NFCB_T4BT_BI_82_x_y */
         case ERR_INCOMPLETE_BYTE: /* added to handle test cases scenario TC_POL_NFCB_T4AT_BI_82_x_y & TC_POL_NFCB_T4BT_BI_82_x_y  */
 
+          gIsoDep.linkQuality.errors++;
+
           if (gIsoDep.isRxChaining) {
             /* Rule 5 - In PICC chaining when a invalid/timeout occurs -> R-ACK */
             EXIT_ON_ERR(ret, isoDepHandleControlMsg(ISODEP_R_ACK, RFAL_ISODEP_NO_PARAM));
@@ -707,6 +726,7 @@ ReturnCode RfalNfcClass::isoDepDataExchangePCD(uint16_t *outActRxLen, bool *outI
             /* Digital 2.0  16.2.5.4 - Retransmit maximum two times                       */
             /* EMVCo 3.0 10.3.4.3 -  PCD may re-transmit the last I-Block or report error */
             if (gIsoDep.cntIRetrys++ < gIsoDep.maxRetriesI) {
+              gIsoDep.linkQuality.errors++;
               gIsoDep.cntRRetrys = 0; /* Clear R counter only */
               gIsoDep.state = ISODEP_ST_PCD_TX;
               return ERR_BUSY;
@@ -779,6 +799,7 @@ ReturnCode RfalNfcClass::isoDepDataExchangePCD(uint16_t *outActRxLen, bool *outI
           }
 
           /* Rule 4 - Invalid Block -> R-NAK */
+          gIsoDep.linkQuality.errors++;
           EXIT_ON_ERR(ret, isoDepHandleControlMsg(ISODEP_R_NAK, RFAL_ISODEP_NO_PARAM));
           return ERR_BUSY;
         }
@@ -839,6 +860,58 @@ ReturnCode RfalNfcClass::rfalIsoDepGetDeselectStatus(void)
   return ret;
 }
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalIsoDepPollerCheckPresence(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalIsoDepPollerStartCheckPresence());
+  rfalRunBlocking(ret, rfalIsoDepPollerGetCheckPresenceStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalIsoDepPollerStartCheckPresence(void)
+{
+  uint8_t    txBuf[RFAL_ISODEP_PCB_LEN + RFAL_ISODEP_DID_LEN];
+  uint16_t   txBufLen;
+
+  /* R(NAK) with the PCD block number differs from the PICC block number: PICC answers R(ACK)  ISO14443-4 7.5.6.2 rule 11 */
+  txBufLen = 0;
+  txBuf[txBufLen++] = isoDep_PCBRNAK(gIsoDep.blockNumber);
+
+  if (((gIsoDep.did != RFAL_ISODEP_NO_DID) && (gIsoDep.did != RFAL_ISODEP_DID_00)) || ((gIsoDep.did == RFAL_ISODEP_DID_00) && (gIsoDep.lastDID00))) {
+    txBuf[ISODEP_PCB_POS] |= ISODEP_PCB_DID_BIT;
+    txBuf[txBufLen++] = gIsoDep.did;
+  }
+
+  /* The answer is placed in the control message buffer, no exchange is ongoing */
+  return rfalRfDev->rfalTransceiveBlockingTx(txBuf, txBufLen, gIsoDep.ctrlBuf, sizeof(gIsoDep.ctrlBuf), &gIsoDep.ctrlRxLen, RFAL_TXRX_FLAGS_DEFAULT, (gIsoDep.fwt + gIsoDep.dFwt));
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalIsoDepPollerGetCheckPresenceStatus(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_BUSY(ret, rfalRfDev->rfalGetTransceiveStatus());
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  /* Convert bits to bytes */
+  gIsoDep.ctrlRxLen = rfalConvBitsToBytes(gIsoDep.ctrlRxLen);
+
+  if ((gIsoDep.ctrlRxLen < RFAL_ISODEP_PCB_LEN) || (!isoDep_PCBisRBlock(gIsoDep.ctrlBuf[ISODEP_PCB_POS]))) {
+    return ERR_PROTO;
+  }
+
+  return ERR_NONE;
+}
+
 #endif /* RFAL_FEATURE_ISO_DEP_POLL */
 
 /*******************************************************************************/
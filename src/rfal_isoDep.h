@@ -160,6 +160,9 @@
 #define RFAL_ISODEP_MAX_DSL_RETRYS              (0U)     /*!< Number of retries for a S(DESELECT) Digital 2.0 B9 - nRETRY DESELECT: [0,5] */
 #define RFAL_ISODEP_RATS_RETRIES                (1U)     /*!< RATS retries upon fail              Digital 2.0 B7 - nRETRY RATS [0,1]      */
 
+#define RFAL_ISODEP_LQ_WINDOW                   (16U)    /*!< Number of I-Blocks over which the link quality is evaluated                  */
+#define RFAL_ISODEP_LQ_ERR_THRESHOLD            (3U)     /*!< Transmission errors within a window that trigger a bit rate step down        */
+
 
 
 
@@ -436,6 +439,12 @@ typedef enum {
   ISODEP_ST_PCD_ACT_PPS,          /*!< PCD activation (PPS)           */
 } rfalIsoDepState;
 
+/*! ISO-DEP Poller link quality counters                                        */
+typedef struct {
+  uint32_t        blocks;        /*!< I-Blocks transmitted (incl. retransmitted)*/
+  uint32_t        errors;        /*!< Erroneous/missing responses and retrans.  */
+} rfalIsoDepLinkQuality;
+
 /*! Holds all ISO-DEP data(counters, buffers, ID, timeouts, frame size)         */
 typedef struct {
   rfalIsoDepState state;         /*!< ISO-DEP module state                      */
@@ -449,6 +458,7 @@ typedef struct {
   uint8_t         cntSDslRetrys; /*!< S(DESELECT) retry counter                 */
   uint8_t         cntSWtxRetrys; /*!< Overall S(WTX) retry counter              */
   uint8_t         cntSWtxNack;   /*!< R(NACK) answered with S(WTX) counter      */
+  rfalIsoDepLinkQuality linkQuality; /*!< Link quality counters (Poller)       */
   uint32_t        fwt;           /*!< Current FWT (Frame Waiting Time)          */
   uint32_t        dFwt;          /*!< Current delta FWT                         */
   uint16_t        fsx;           /*!< Current FSx FSC or FSD (max Frame size)   */
@@ -41,6 +41,8 @@
  ******************************************************************************
  */
 #include "rfal_nfc.h"
+#include "rfal_t1t.h"
+#include "rfal_t2t.h"
 #include "nfc_utils.h"
 
 
@@ -66,9 +68,29 @@
 #define rfalNfcpCbStartActivation()                    ((gNfcDev.disc.propNfc.rfalNfcpStartActivation != NULL) ? gNfcDev.disc.propNfc.rfalNfcpStartActivation() : ERR_NOTSUPP )
 #define rfalNfcpCbGetActivationStatus()                ((gNfcDev.disc.propNfc.rfalNfcpGetActivationStatus != NULL) ? gNfcDev.disc.propNfc.rfalNfcpGetActivationStatus() : ERR_NOTSUPP )
 
+#define rfalNfcIsAdaptiveDisc()                        (gNfcDev.disc.adaptiveDisc && (gNfcDev.disc.compMode != RFAL_COMPLIANCE_MODE_EMV))
+
+#define rfalNfcIsDevSleeping( d )                      ((((d)->type == RFAL_NFC_LISTEN_TYPE_NFCA) && (d)->dev.nfca.isSleep) || (((d)->type == RFAL_NFC_LISTEN_TYPE_NFCB) && (d)->dev.nfcb.isSleep))
+
+#define rfalNfcIsoDepActBR()                           (gNfcDev.disc.isoDepAdaptiveBR ? MIN(gNfcDev.isoDepMaxBR, RFAL_BR_848) : gNfcDev.disc.maxBR)
+
+#define rfalNfcIsWakeUpAdaptive()                      (gNfcDev.disc.wakeupAdaptive && (!gNfcDev.disc.wakeupConfigDefault))
+
 #define rfalNfcHasPollerTechs()                        ((gNfcDev.disc.techs2Find & (RFAL_NFC_POLL_TECH_A | RFAL_NFC_POLL_TECH_B | RFAL_NFC_POLL_TECH_F | RFAL_NFC_POLL_TECH_V |  \
                                                                                    RFAL_NFC_POLL_TECH_AP2P | RFAL_NFC_POLL_TECH_ST25TB | RFAL_NFC_POLL_TECH_PROP)) != 0U)
 
+#if RFAL_FEATURE_NFC_SHARED_BUF
+  #define rfalNfcColResBuf                             (*gNfcDev.colResBuf)   /*!< Collision Resolution buffer, in the caller-provided region */
+  #define rfalNfcTxBuf                                 (*gNfcDev.txBuf)       /*!< Tx buffer, in the caller-provided region                   */
+  #define rfalNfcRxBuf                                 (*gNfcDev.rxBuf)       /*!< Rx buffer, in the caller-provided region                   */
+  #define rfalNfcTmpBuf                                (*gNfcDev.tmpBuf)      /*!< Tmp buffer, in the caller-provided region                  */
+#else
+  #define rfalNfcColResBuf                             (gNfcDev.colResBuf)    /*!< Collision Resolution buffer                                */
+  #define rfalNfcTxBuf                                 (gNfcDev.txBuf)        /*!< Tx buffer                                                  */
+  #define rfalNfcRxBuf                                 (gNfcDev.rxBuf)        /*!< Rx buffer                                                  */
+  #define rfalNfcTmpBuf                                (gNfcDev.tmpBuf)       /*!< Tmp buffer                                                 */
+#endif /* RFAL_FEATURE_NFC_SHARED_BUF */
+
 
 
 /** Constructor I2C
@@ -82,6 +104,8 @@ RfalNfcClass::RfalNfcClass(RfalRfClass *rfal_rf) : rfalRfDev(rfal_rf)
   memset(&gRfalNfcb, 0, sizeof(rfalNfcb));
   memset(&gNfcip, 0, sizeof(rfalNfcDep));
   memset(&gRfalNfcfGreedyF, 0, sizeof(rfalNfcfGreedyF));
+  memset(&gT4tListener, 0, sizeof(rfalT4tListener));
+  memset(&gNfcfListener, 0, sizeof(rfalNfcfListener));
 }
 
 
@@ -95,7 +119,28 @@ ReturnCode RfalNfcClass::rfalNfcInitialize(void)
   //rfalRfDev->rfalAnalogConfigInitialize();//
   EXIT_ON_ERR(err, rfalRfDev->rfalInitialize());   /* Initialize RFAL */
 
+#if RFAL_FEATURE_NFC_SHARED_BUF
+  {
+    /* Keep the caller-provided buffer region across initializations */
+    rfalNfcColResBuffer *colResBuf = gNfcDev.colResBuf;
+    rfalNfcBuffer       *txBuf     = gNfcDev.txBuf;
+    rfalNfcBuffer       *rxBuf     = gNfcDev.rxBuf;
+#if RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP
+    rfalNfcTmpBuffer    *tmpBuf    = gNfcDev.tmpBuf;
+#endif /* RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP */
+
+    ST_MEMSET(&gNfcDev, 0x00, sizeof(gNfcDev));
+
+    gNfcDev.colResBuf = colResBuf;
+    gNfcDev.txBuf     = txBuf;
+    gNfcDev.rxBuf     = rxBuf;
+#if RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP
+    gNfcDev.tmpBuf    = tmpBuf;
+#endif /* RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP */
+  }
+#else
   ST_MEMSET(&gNfcDev, 0x00, sizeof(gNfcDev));
+#endif /* RFAL_FEATURE_NFC_SHARED_BUF */
 
   gNfcDev.state = RFAL_NFC_STATE_IDLE;         /* Go to initialized */
   return ERR_NONE;
@@ -109,6 +154,13 @@ ReturnCode RfalNfcClass::rfalNfcDiscover(const rfalNfcDiscoverParam *disParams)
     return ERR_WRONG_STATE;
   }
 
+#if RFAL_FEATURE_NFC_SHARED_BUF
+  /* Check if the buffer region has been provided */
+  if (gNfcDev.txBuf == NULL) {
+    return ERR_WRONG_STATE;
+  }
+#endif /* RFAL_FEATURE_NFC_SHARED_BUF */
+
   /* Check valid parameters */
   if ((disParams == NULL) || (disParams->devLimit > RFAL_NFC_MAX_DEVICES) || (disParams->devLimit == 0U)                                              ||
       ((disParams->maxBR > RFAL_BR_1695) && (disParams->maxBR != RFAL_BR_KEEP))                                                                      ||
@@ -155,6 +207,14 @@ ReturnCode RfalNfcClass::rfalNfcDiscover(const rfalNfcDiscoverParam *disParams)
   gNfcDev.isDeactivating  = false;
   gNfcDev.disc            = *disParams;
 
+  /* Wake-Up tracker starts from the given configuration, statistics are kept */
+  gNfcDev.wakeup.config = gNfcDev.disc.wakeupConfig;
+  ST_MEMSET(&gNfcDev.wakeup.indAmp, 0x00, sizeof(rfalNfcWakeUpChannel));
+  ST_MEMSET(&gNfcDev.wakeup.indPha, 0x00, sizeof(rfalNfcWakeUpChannel));
+  gNfcDev.wakeup.bias      = 0U;
+  gNfcDev.wakeup.woke      = false;
+  gNfcDev.wakeup.relaxTime = gNfcDev.wakeup.stats.wuTime;
+
 
   /* Calculate Listen Mask */
   gNfcDev.lmMask  = 0U;
@@ -188,7 +248,15 @@ ReturnCode RfalNfcClass::rfalNfcDeactivate(rfalNfcDeactivateType deactType)
     return ERR_PARAM;
   }
 
-  gNfcDev.deactType = deactType;
+  if (gNfcDev.state == RFAL_NFC_STATE_WAKEUP_MODE) {
+    gNfcDev.wakeup.stats.wuTime += (millis() - gNfcDev.wakeup.startTime);
+  }
+
+  rfalNfcPresenceComplete();                   /* Do not leave a probe pending on the device */
+
+  gNfcDev.deactType       = deactType;
+  gNfcDev.presence.dev    = NULL;              /* Stop monitoring the deactivated device */
+  gNfcDev.isTxBufAcquired = false;
   /* Check if Discovery is to continue afterwards or back to Select */
   if ((deactType == RFAL_NFC_DEACTIVATE_DISCOVERY) || (deactType == RFAL_NFC_DEACTIVATE_SLEEP)) {
     /* If so let the state machine continue*/
@@ -289,6 +357,16 @@ void RfalNfcClass::rfalNfcWorker(void)
       gNfcDev.techs2do    = gNfcDev.disc.techs2Find;
       gNfcDev.state       = RFAL_NFC_STATE_POLL_TECHDETECT;
       gNfcDev.isDeactivating = false;
+      gNfcDev.discStartTime  = millis();
+      gNfcDev.presence.dev   = NULL;
+      gNfcDev.presence.probing = false;
+      gNfcDev.isoDepMaxBR    = ((gNfcDev.disc.maxBR == RFAL_BR_KEEP) ? rfalGetMaxBrRW() : gNfcDev.disc.maxBR);
+      gNfcDev.isoDepStepDown = false;
+      gNfcDev.isoDepStepPending = false;
+
+      if (rfalNfcIsAdaptiveDisc()) {
+        rfalNfcAdaptiveDiscStart();                                             /* Poll likely technologies first */
+      }
 
       /* Start total duration timer */
       gNfcDev.discTmr = (uint32_t)timerCalculateTimer(gNfcDev.disc.totalDuration);
@@ -297,7 +375,7 @@ void RfalNfcClass::rfalNfcWorker(void)
       /* Check if Low power Wake-Up is to be performed */
       if (gNfcDev.disc.wakeupEnabled && (((gNfcDev.techDctCnt == 0U) && (gNfcDev.disc.wakeupPollBefore == false)) || (gNfcDev.techDctCnt >= gNfcDev.disc.wakeupNPolls))) {
         /* Initialize Low power Wake-up mode and wait */
-        err = rfalRfDev->rfalWakeUpModeStart((gNfcDev.disc.wakeupConfigDefault ? NULL : &gNfcDev.disc.wakeupConfig));
+        err = rfalNfcWakeUpStart();
         if (err == ERR_NONE) {
           gNfcDev.state = RFAL_NFC_STATE_WAKEUP_MODE;
           rfalNfcNfcNotify(gNfcDev.state);                                  /* Notify caller that WU was started */
@@ -318,11 +396,19 @@ void RfalNfcClass::rfalNfcWorker(void)
         rfalRfDev->rfalWakeUpModeStop();                                                 /* Disable Wake-up mode           */
         gNfcDev.state = RFAL_NFC_STATE_POLL_TECHDETECT;                       /* Go to Technology detection     */
 
+        gNfcDev.wakeup.woke      = true;                                      /* Classified by the next detection */
+        gNfcDev.wakeup.wokeTime  = millis();
+        gNfcDev.wakeup.stats.wakes++;
+        gNfcDev.wakeup.stats.wuTime += (gNfcDev.wakeup.wokeTime - gNfcDev.wakeup.startTime);
+
         gNfcDev.techDctCnt = 1;                                               /* Tech Detect counter (1 woke)   */
 
         /* (Re)Start total duration timer upon waking up */
         gNfcDev.discTmr = (uint32_t)timerCalculateTimer(gNfcDev.disc.totalDuration);
+        gNfcDev.discStartTime = millis();
         rfalNfcNfcNotify(gNfcDev.state);                                      /* Notify caller that WU has woke */
+      } else {
+        rfalNfcWakeUpTrack();                                                 /* Follow noise and reference drift */
       }
 #endif /* RFAL_FEATURE_WAKEUP_MODE */
 
@@ -334,11 +420,21 @@ void RfalNfcClass::rfalNfcWorker(void)
       /* Start total duration timer */
       //gNfcDev.discTmr = (uint32_t)timerCalculateTimer(gNfcDev.disc.totalDuration);
 
-      err = rfalNfcPollTechDetection();                                       /* Perform Technology Detection                         */
+      err = (rfalNfcIsAdaptiveDisc() ? rfalNfcAdaptiveTechDetection() : rfalNfcPollTechDetection());  /* Perform Technology Detection */
 
 
 
       if (err != ERR_BUSY) {                                                    /* Wait until all technologies are performed            */
+        gNfcDev.discStats.cycles++;
+        if ((err == ERR_NONE) && (gNfcDev.techsFound != RFAL_NFC_TECH_NONE)) {
+          gNfcDev.discStats.detections++;
+          gNfcDev.discStats.detectTimeSum += (millis() - gNfcDev.discStartTime);
+        }
+
+        if (gNfcDev.wakeup.woke) {
+          rfalNfcWakeUpDetected((err == ERR_NONE) && (gNfcDev.techsFound != RFAL_NFC_TECH_NONE));
+        }
+
         if ((err != ERR_NONE) || (gNfcDev.techsFound == RFAL_NFC_TECH_NONE)) { /* Check if any error occurred or no techs were found   */
 
           rfalRfDev->rfalFieldOff();
@@ -410,6 +506,21 @@ void RfalNfcClass::rfalNfcWorker(void)
 
       rfalNfcDataExchangeGetStatus();                                           /* Run the internal state machine */
 
+#if RFAL_FEATURE_T4T && RFAL_FEATURE_ISO_DEP_LISTEN
+      if ((gNfcDev.dataExErr == ERR_NONE) && rfalNfcT4tListenerIsActive()) {   /* C-APDU received while emulating a T4T */
+        gNfcDev.dataExErr = rfalNfcT4tListenerRespond();                      /* Answer it right away, no round trip via the caller */
+      }
+#endif /* RFAL_FEATURE_T4T && RFAL_FEATURE_ISO_DEP_LISTEN */
+#if RFAL_FEATURE_NFCF && RFAL_FEATURE_LISTEN_MODE
+      if ((gNfcDev.dataExErr == ERR_NONE) && rfalNfcT3tListenerIsActive()) {   /* T3T request received while emulating a T3T */
+        gNfcDev.dataExErr = rfalNfcT3tListenerRespond();                      /* Answer it right away, no round trip via the caller */
+      }
+#endif /* RFAL_FEATURE_NFCF && RFAL_FEATURE_LISTEN_MODE */
+
+      if (gNfcDev.dataExErr == ERR_NONE) {
+        gNfcDev.presence.lastSeen = millis();                                 /* Answer received, device still present */
+      }
+
       if (gNfcDev.dataExErr != ERR_BUSY) {                                      /* If Dataexchange has terminated */
         gNfcDev.state = RFAL_NFC_STATE_DATAEXCHANGE_DONE;                     /* Go to done state               */
         rfalNfcNfcNotify(gNfcDev.state);                                      /* And notify caller              */
@@ -426,7 +537,15 @@ void RfalNfcClass::rfalNfcWorker(void)
 
       err = rfalNfcDeactivation();                                              /* Deactivate current device */
       if (err != ERR_BUSY) {
-        if (gNfcDev.deactType == RFAL_NFC_DEACTIVATE_SLEEP) {
+        if (gNfcDev.isoDepStepDown) {
+          gNfcDev.isoDepStepDown = false;
+          if (rfalNfcIsDevSleeping(&gNfcDev.devList[gNfcDev.selDevIdx])) {    /* Deselected, re-activate with the lower bit rate */
+            gNfcDev.isTechInit = false;
+            gNfcDev.state      = RFAL_NFC_STATE_POLL_ACTIVATION;
+            break;
+          }
+          gNfcDev.state = RFAL_NFC_STATE_START_DISCOVERY;                     /* Deselect failed, restart the discovery loop */
+        } else if (gNfcDev.deactType == RFAL_NFC_DEACTIVATE_SLEEP) {
           gNfcDev.state = RFAL_NFC_STATE_POLL_SELECT;
         } else {
           gNfcDev.state = ((gNfcDev.deactType == RFAL_NFC_DEACTIVATE_DISCOVERY) ? RFAL_NFC_STATE_START_DISCOVERY : RFAL_NFC_STATE_IDLE);
@@ -455,7 +574,7 @@ void RfalNfcClass::rfalNfcWorker(void)
 #if RFAL_FEATURE_LISTEN_MODE
 
       if (gNfcDev.lmMask != 0U) {                                               /* Check if configured to perform Listen mode */
-        err = rfalRfDev->rfalListenStart(gNfcDev.lmMask, &gNfcDev.disc.lmConfigPA, NULL, &gNfcDev.disc.lmConfigPF, (uint8_t *)&gNfcDev.rxBuf.rfBuf, (uint16_t)rfalConvBytesToBits(sizeof(gNfcDev.rxBuf.rfBuf)), &gNfcDev.rxLen);
+        err = rfalRfDev->rfalListenStart(gNfcDev.lmMask, &gNfcDev.disc.lmConfigPA, NULL, &gNfcDev.disc.lmConfigPF, (uint8_t *)&rfalNfcRxBuf.rfBuf, (uint16_t)rfalConvBytesToBits(sizeof(rfalNfcRxBuf.rfBuf)), &gNfcDev.rxLen);
         if (err == ERR_NONE) {
           gNfcDev.state = RFAL_NFC_STATE_LISTEN_COLAVOIDANCE;               /* Wait for listen mode to be activated */
         }
@@ -504,8 +623,41 @@ void RfalNfcClass::rfalNfcWorker(void)
       break;
     /*******************************************************************************/
     case RFAL_NFC_STATE_ACTIVATED:
-    case RFAL_NFC_STATE_POLL_SELECT:
+
+#if RFAL_FEATURE_T4T && RFAL_FEATURE_ISO_DEP_LISTEN
+      if (rfalNfcT4tListenerIsActive()) {                                       /* T4T emulation serves the Poller on its own */
+        gT4tListener.isApplSelected = false;
+        gT4tListener.curFile        = RFAL_T4T_LISTENER_FILE_NONE;
+        rfalNfcDataExchangeGetStatus();                                         /* Move to data exchange and retrieve the first C-APDU */
+      }
+#endif /* RFAL_FEATURE_T4T && RFAL_FEATURE_ISO_DEP_LISTEN */
+
+#if RFAL_FEATURE_NFCF && RFAL_FEATURE_LISTEN_MODE
+      if (rfalNfcT3tListenerIsActive()) {                                       /* T3T emulation serves the Poller on its own */
+        rfalNfcDataExchangeGetStatus();                                         /* Move to data exchange, first request already received */
+      }
+#endif /* RFAL_FEATURE_NFCF && RFAL_FEATURE_LISTEN_MODE */
+
+      rfalNfcPresenceWorker();                                                  /* Probe the device if due */
+      break;
+
+    /*******************************************************************************/
     case RFAL_NFC_STATE_DATAEXCHANGE_DONE:
+
+#if RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL
+      if (gNfcDev.isoDepStepPending) {                                          /* Poor link quality seen on the last exchange */
+        gNfcDev.isoDepStepPending = false;
+        if (rfalNfcIsoDepStepDownBitRate() == ERR_NONE) {
+          break;                                                                /* Deselect and re-activation run from the worker */
+        }
+      }
+#endif /* RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL */
+
+      rfalNfcPresenceWorker();                                                  /* Probe the device if due */
+      break;
+
+    /*******************************************************************************/
+    case RFAL_NFC_STATE_POLL_SELECT:
     default:
       return;
   }
@@ -518,11 +670,15 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
   ReturnCode            err;
   rfalTransceiveContext ctx;
 
+  rfalNfcPresenceComplete();                                                    /* The probe shares the RF transceive */
+
   /*******************************************************************************/
   /* The Data Exchange is divided in two different moments, the trigger/Start of *
    *  the transfer followed by the check until its completion                    */
   if ((gNfcDev.state >= RFAL_NFC_STATE_ACTIVATED) && (gNfcDev.activeDev != NULL)) {
 
+    gNfcDev.isTxBufAcquired = false;
+
     /*******************************************************************************/
     /* In Listen mode is the Poller that initiates the communicatation             */
     /* Assign output parameters and rfalNfcDataExchangeGetStatus will return       */
@@ -533,8 +689,8 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
       }
 
       *rvdLen = (uint16_t *)&gNfcDev.rxLen;
-      *rxData = (uint8_t *)((gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_ISODEP) ? gNfcDev.rxBuf.isoDepBuf.apdu :
-                            ((gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_NFCDEP) ? gNfcDev.rxBuf.nfcDepBuf.pdu  : gNfcDev.rxBuf.rfBuf));
+      *rxData = (uint8_t *)((gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_ISODEP) ? rfalNfcRxBuf.isoDepBuf.apdu :
+                            ((gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_NFCDEP) ? rfalNfcRxBuf.nfcDepBuf.pdu  : rfalNfcRxBuf.rfBuf));
       return ERR_NONE;
     }
 
@@ -544,10 +700,10 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
       /*******************************************************************************/
       case RFAL_NFC_INTERFACE_RF:
 
-        rfalCreateByteFlagsTxRxContext(ctx, (uint8_t *)txData, txDataLen, gNfcDev.rxBuf.rfBuf, sizeof(gNfcDev.rxBuf.rfBuf), &gNfcDev.rxLen, RFAL_TXRX_FLAGS_DEFAULT, fwt);
+        rfalCreateByteFlagsTxRxContext(ctx, (uint8_t *)txData, txDataLen, rfalNfcRxBuf.rfBuf, sizeof(rfalNfcRxBuf.rfBuf), &gNfcDev.rxLen, RFAL_TXRX_FLAGS_DEFAULT, fwt);
         ctx.txBufLen = txDataLen;    /* RF interface uses number of bits */
 
-        *rxData = (uint8_t *)gNfcDev.rxBuf.rfBuf;
+        *rxData = (uint8_t *)rfalNfcRxBuf.rfBuf;
         *rvdLen = (uint16_t *)&gNfcDev.rxLen;
         err = rfalRfDev->rfalStartTransceive(&ctx);
         break;
@@ -557,12 +713,12 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
       case RFAL_NFC_INTERFACE_ISODEP: {
           rfalIsoDepApduTxRxParam isoDepTxRx;
 
-          if (txDataLen > sizeof(gNfcDev.txBuf.isoDepBuf.apdu)) {
+          if (txDataLen > sizeof(rfalNfcTxBuf.isoDepBuf.apdu)) {
             return ERR_NOMEM;
           }
 
-          if (txDataLen > 0U) {
-            ST_MEMCPY((uint8_t *)gNfcDev.txBuf.isoDepBuf.apdu, txData, txDataLen);
+          if ((txDataLen > 0U) && (txData != rfalNfcTxBuf.isoDepBuf.apdu)) {     /* Skip copy if already composed in place */
+            ST_MEMCPY((uint8_t *)rfalNfcTxBuf.isoDepBuf.apdu, txData, txDataLen);
           }
 
           isoDepTxRx.DID       = RFAL_ISODEP_NO_DID;
@@ -570,12 +726,12 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
           isoDepTxRx.FSx       = gNfcDev.activeDev->proto.isoDep.info.FSx;
           isoDepTxRx.dFWT      = gNfcDev.activeDev->proto.isoDep.info.dFWT;
           isoDepTxRx.FWT       = gNfcDev.activeDev->proto.isoDep.info.FWT;
-          isoDepTxRx.txBuf     = &gNfcDev.txBuf.isoDepBuf;
+          isoDepTxRx.txBuf     = &rfalNfcTxBuf.isoDepBuf;
           isoDepTxRx.txBufLen  = txDataLen;
-          isoDepTxRx.rxBuf     = &gNfcDev.rxBuf.isoDepBuf;
+          isoDepTxRx.rxBuf     = &rfalNfcRxBuf.isoDepBuf;
           isoDepTxRx.rxLen     = &gNfcDev.rxLen;
-          isoDepTxRx.tmpBuf    = &gNfcDev.tmpBuf.isoDepBuf;
-          *rxData              = (uint8_t *)gNfcDev.rxBuf.isoDepBuf.apdu;
+          isoDepTxRx.tmpBuf    = &rfalNfcTmpBuf.isoDepBuf;
+          *rxData              = (uint8_t *)rfalNfcRxBuf.isoDepBuf.apdu;
           *rvdLen              = (uint16_t *)&gNfcDev.rxLen;
 
           /*******************************************************************************/
@@ -590,11 +746,11 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
       case RFAL_NFC_INTERFACE_NFCDEP: {
           rfalNfcDepPduTxRxParam nfcDepTxRx;
 
-          if (txDataLen > sizeof(gNfcDev.txBuf.nfcDepBuf.pdu)) {
+          if (txDataLen > sizeof(rfalNfcTxBuf.nfcDepBuf.pdu)) {
             return ERR_NOMEM;
           }
-          if (txDataLen > 0U) {
-            ST_MEMCPY((uint8_t *)gNfcDev.txBuf.nfcDepBuf.pdu, txData, txDataLen);
+          if ((txDataLen > 0U) && (txData != rfalNfcTxBuf.nfcDepBuf.pdu)) {      /* Skip copy if already composed in place */
+            ST_MEMCPY((uint8_t *)rfalNfcTxBuf.nfcDepBuf.pdu, txData, txDataLen);
           }
 
           nfcDepTxRx.DID       = RFAL_NFCDEP_DID_KEEP;
@@ -603,12 +759,12 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
                                  rfalNfcDepLR2FS((uint8_t)rfalNfcDepPP2LR(gNfcDev.activeDev->proto.nfcDep.activation.Initiator.ATR_REQ.PPi));
           nfcDepTxRx.dFWT      = gNfcDev.activeDev->proto.nfcDep.info.dFWT;
           nfcDepTxRx.FWT       = gNfcDev.activeDev->proto.nfcDep.info.FWT;
-          nfcDepTxRx.txBuf     = &gNfcDev.txBuf.nfcDepBuf;
+          nfcDepTxRx.txBuf     = &rfalNfcTxBuf.nfcDepBuf;
           nfcDepTxRx.txBufLen  = txDataLen;
-          nfcDepTxRx.rxBuf     = &gNfcDev.rxBuf.nfcDepBuf;
+          nfcDepTxRx.rxBuf     = &rfalNfcRxBuf.nfcDepBuf;
           nfcDepTxRx.rxLen     = &gNfcDev.rxLen;
-          nfcDepTxRx.tmpBuf    = &gNfcDev.tmpBuf.nfcDepBuf;
-          *rxData                  = (uint8_t *)gNfcDev.rxBuf.nfcDepBuf.pdu;
+          nfcDepTxRx.tmpBuf    = &rfalNfcTmpBuf.nfcDepBuf;
+          *rxData                  = (uint8_t *)rfalNfcRxBuf.nfcDepBuf.pdu;
           *rvdLen                 = (uint16_t *)&gNfcDev.rxLen;
 
           /*******************************************************************************/
@@ -637,6 +793,65 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDa
 }
 
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcDataExchangeGetTxBuffer(uint8_t **txBuf, uint16_t *txBufLen)
+{
+  if ((txBuf == NULL) || (txBufLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if ((gNfcDev.state < RFAL_NFC_STATE_ACTIVATED) || (gNfcDev.activeDev == NULL)) {
+    return ERR_WRONG_STATE;
+  }
+
+  if (gNfcDev.state == RFAL_NFC_STATE_DATAEXCHANGE) {
+    return ERR_BUSY;                                                            /* Tx buffer still in use by the ongoing transceive */
+  }
+
+  /* Point past the protocol prologue so that the payload is not copied on commit */
+  switch (gNfcDev.activeDev->rfInterface) {
+#if RFAL_FEATURE_ISO_DEP
+    case RFAL_NFC_INTERFACE_ISODEP:
+      *txBuf    = (uint8_t *)rfalNfcTxBuf.isoDepBuf.apdu;
+      *txBufLen = (uint16_t)sizeof(rfalNfcTxBuf.isoDepBuf.apdu);
+      break;
+#endif /* RFAL_FEATURE_ISO_DEP */
+
+#if RFAL_FEATURE_NFC_DEP
+    case RFAL_NFC_INTERFACE_NFCDEP:
+      *txBuf    = (uint8_t *)rfalNfcTxBuf.nfcDepBuf.pdu;
+      *txBufLen = (uint16_t)sizeof(rfalNfcTxBuf.nfcDepBuf.pdu);
+      break;
+#endif /* RFAL_FEATURE_NFC_DEP */
+
+    case RFAL_NFC_INTERFACE_RF:
+      *txBuf    = (uint8_t *)rfalNfcTxBuf.rfBuf;
+      *txBufLen = (uint16_t)sizeof(rfalNfcTxBuf.rfBuf);
+      break;
+
+    default:
+      return ERR_WRONG_STATE;
+  }
+
+  gNfcDev.isTxBufAcquired = true;                                               /* Presence probes held off until commit */
+
+  return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcDataExchangeCommit(uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt)
+{
+  ReturnCode err;
+  uint8_t   *txBuf;
+  uint16_t   txBufLen;
+
+  EXIT_ON_ERR(err, rfalNfcDataExchangeGetTxBuffer(&txBuf, &txBufLen));
+
+  return rfalNfcDataExchangeStart(txBuf, txDataLen, rxData, rvdLen, fwt);
+}
+
+
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalNfcDataExchangeGetStatus(void)
 {
@@ -681,6 +896,13 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeGetStatus(void)
       /*******************************************************************************/
       case RFAL_NFC_INTERFACE_ISODEP:
         gNfcDev.dataExErr = rfalIsoDepGetApduTransceiveStatus();
+
+#if RFAL_FEATURE_ISO_DEP_POLL
+        /* Check whether the link quality requires a lower bit rate, the worker steps it down once the exchange is done */
+        if ((gNfcDev.dataExErr == ERR_NONE) && gNfcDev.disc.isoDepAdaptiveBR && rfalNfcIsRemDevListener(gNfcDev.activeDev->type)) {
+          rfalNfcIsoDepCheckLinkQuality();
+        }
+#endif /* RFAL_FEATURE_ISO_DEP_POLL */
         break;
 #endif /* RFAL_FEATURE_ISO_DEP */
         /*******************************************************************************/
@@ -699,7 +921,7 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeGetStatus(void)
     /*******************************************************************************/
     /* If a Sleep request has been received (Listen Mode) go to sleep immediately  */
     if (gNfcDev.dataExErr == ERR_SLEEP_REQ) {
-      EXIT_ON_ERR(gNfcDev.dataExErr, rfalRfDev->rfalListenSleepStart(RFAL_LM_STATE_SLEEP_A, gNfcDev.rxBuf.rfBuf, sizeof(gNfcDev.rxBuf.rfBuf), &gNfcDev.rxLen));
+      EXIT_ON_ERR(gNfcDev.dataExErr, rfalRfDev->rfalListenSleepStart(RFAL_LM_STATE_SLEEP_A, rfalNfcRxBuf.rfBuf, sizeof(rfalNfcRxBuf.rfBuf), &gNfcDev.rxLen));
 
       /* If set Sleep was successful keep restore the Sleep request signal */
       gNfcDev.dataExErr = ERR_SLEEP_REQ;
@@ -711,170 +933,1159 @@ ReturnCode RfalNfcClass::rfalNfcDataExchangeGetStatus(void)
   return gNfcDev.dataExErr;
 }
 
-/*!
- ******************************************************************************
- * \brief Poller Technology Detection
- *
- * This method implements the Technology Detection / Poll for different
- * device technologies.
- *
- * \return  ERR_NONE         : Operation completed with no error
- * \return  ERR_BUSY         : Operation ongoing
- * \return  ERR_XXXX         : Error occurred
- *
- ******************************************************************************
- */
-ReturnCode RfalNfcClass::rfalNfcPollTechDetection(void)
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcIsoDepStepDownBitRate(void)
 {
-  ReturnCode           err;
+#if RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL
+  rfalBitRate    curBR;
+  rfalNfcDevice *dev;
 
-  err = ERR_NONE;
+  dev = gNfcDev.activeDev;
 
-  /* Suppress warning when specific RFAL features have been disabled */
-  NO_WARNING(err);
+  /* Check for an activated ISO-DEP Listen device and no exchange ongoing */
+  if ((!rfalNfcIsDevActivated(gNfcDev.state)) || (dev == NULL) || (dev->rfInterface != RFAL_NFC_INTERFACE_ISODEP) || (!rfalNfcIsRemDevListener(dev->type))) {
+    return ERR_WRONG_STATE;
+  }
+  if ((gNfcDev.state == RFAL_NFC_STATE_DATAEXCHANGE) && ((gNfcDev.dataExErr == ERR_BUSY) || (gNfcDev.dataExErr == ERR_AGAIN))) {
+    return ERR_WRONG_STATE;
+  }
 
+  curBR = MAX(dev->proto.isoDep.info.DSI, dev->proto.isoDep.info.DRI);
+  if ((curBR == RFAL_BR_106) || (curBR > RFAL_BR_13560)) {
+    return ERR_NOTSUPP;
+  }
 
   /*******************************************************************************/
-  /* AP2P Technology Detection                                                   */
-  /*******************************************************************************/
-  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_AP2P) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_AP2P) != 0U)) {
-#if RFAL_FEATURE_NFC_DEP
-    if (!gNfcDev.isTechInit) {
-      EXIT_ON_ERR(err, rfalRfDev->rfalSetMode(RFAL_MODE_POLL_ACTIVE_P2P, gNfcDev.disc.ap2pBR, gNfcDev.disc.ap2pBR));
-      rfalRfDev->rfalSetErrorHandling(ERRORHANDLING_NONE);
-      rfalRfDev->rfalSetFDTListen(RFAL_FDT_LISTEN_AP2P_POLLER);
-      rfalRfDev->rfalSetFDTPoll(RFAL_FDT_POLL_AP2P_POLLER);
-      rfalRfDev->rfalSetGT(RFAL_GT_AP2P_ADJUSTED);
-      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                                       /* Turns the Field On and starts GT timer */
-      gNfcDev.isTechInit = true;
-    }
-
-    if (rfalRfDev->rfalIsGTExpired()) {                                                             /* Wait until Guard Time is fulfilled */
-      gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_AP2P;
+  /* PPS is only allowed after RATS, deselect (Sleep) and re-activate with a lower max bit rate.   */
+  /* VHBR are then set again by S(PARAMETERS) if the new max bit rate is still above 848 kbps      */
+  gNfcDev.isoDepMaxBR    = (rfalBitRate)((uint8_t)curBR - 1U); /* PRQA S 4342 # MISRA 10.5 - Layout of enum rfalBitRate and above check guarantee no invalid enum values to be created */
+  gNfcDev.isoDepStepDown = true;
+  gNfcDev.deactType      = RFAL_NFC_DEACTIVATE_SLEEP;
+  gNfcDev.state          = RFAL_NFC_STATE_DEACTIVATION;
 
-      err = rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_ACTIVE, NULL, 0);  /* Poll for NFC-A devices */
-      if (err == ERR_NONE) {
-        gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_AP2P;
+  return ERR_NONE;
+#else
+  return ERR_DISABLED;
+#endif /* RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL */
+}
 
-        gNfcDev.devList->type        = RFAL_NFC_LISTEN_TYPE_AP2P;
-        gNfcDev.devList->rfInterface = RFAL_NFC_INTERFACE_NFCDEP;
-        gNfcDev.devCnt++;
 
-        return ERR_NONE;
-      }
-      gNfcDev.isTechInit = false;
-      rfalRfDev->rfalFieldOff();
-    }
-    return ERR_BUSY;
-#endif /* RFAL_FEATURE_NFC_DEP */
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcGetDiscoveryStats(rfalNfcDiscStats *stats)
+{
+  if (stats == NULL) {
+    return ERR_PARAM;
   }
 
-  /*******************************************************************************/
-  /* Turn Field On if Passive Poll technologies are enabled                      */
-  /*******************************************************************************/
-  if ((!gNfcDev.isFieldOn) && ((gNfcDev.disc.techs2Find & (RFAL_NFC_POLL_TECH_A | RFAL_NFC_POLL_TECH_B | RFAL_NFC_POLL_TECH_F | RFAL_NFC_POLL_TECH_V | RFAL_NFC_POLL_TECH_ST25TB | RFAL_NFC_POLL_TECH_PROP)) != 0U)) {
-    EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                                /* Turns the Field On  */
-    gNfcDev.isFieldOn = true;
-    return ERR_BUSY;
-  }
+  gNfcDev.discStats.meanDetectTime = ((gNfcDev.discStats.detections == 0U) ? 0U : (gNfcDev.discStats.detectTimeSum / gNfcDev.discStats.detections));
+  *stats = gNfcDev.discStats;
 
-  /*******************************************************************************/
-  /* Passive NFC-A Technology Detection                                          */
-  /*******************************************************************************/
-  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_A) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_A) != 0U)) {
-#if RFAL_FEATURE_NFCA
-    if (!gNfcDev.isTechInit) {
-      EXIT_ON_ERR(err, rfalNfcaPollerInitialize());                         /* Initialize RFAL for NFC-A */
-      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                            /* As field is already On only starts GT timer */
-      gNfcDev.isTechInit    = true;
-      gNfcDev.isOperOngoing = false;                                             /* No operation currently ongoing  */
-    }
+  return ERR_NONE;
+}
 
-    if (rfalRfDev->rfalIsGTExpired()) {                                                       /* Wait until Guard Time is fulfilled */
-      if (!gNfcDev.isOperOngoing) {
-        rfalNfcaPollerStartTechnologyDetection(gNfcDev.disc.compMode, &gNfcDev.sensRes);  /* Poll for NFC-A devices */
 
-        gNfcDev.isOperOngoing = true;
-        return ERR_BUSY;
-      }
+/*******************************************************************************/
+void RfalNfcClass::rfalNfcClearDiscoveryStats(void)
+{
+  ST_MEMSET(&gNfcDev.discStats, 0x00, sizeof(rfalNfcDiscStats));
+}
 
-      err = rfalNfcaPollerGetTechnologyDetectionStatus();
-      if (err != ERR_BUSY) {
-        if (err == ERR_NONE) {
-          gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_A;
-        }
 
-        gNfcDev.isTechInit = false;
-        gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_A;
-      }
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcPresenceStart(uint16_t minInterval, uint16_t maxInterval, rfalNfcPresenceCallback removedCb)
+{
+  uint16_t minIntv;
+  uint16_t maxIntv;
 
-      /* Check if bail-out after NFC-A     Activity 2.1  9.2.3.21 */
-      if (((gNfcDev.disc.techs2Bail & RFAL_NFC_POLL_TECH_A) != 0U) && (gNfcDev.techsFound != 0U)) {
-        return ERR_NONE;
-      }
-    }
-    return ERR_BUSY;
-#endif /* RFAL_FEATURE_NFCA */
+  minIntv = ((minInterval == 0U) ? (uint16_t)RFAL_NFC_PRESENCE_INTERVAL_MIN : minInterval);
+  maxIntv = ((maxInterval == 0U) ? (uint16_t)RFAL_NFC_PRESENCE_INTERVAL_MAX : maxInterval);
 
+  if ((removedCb == NULL) || (minIntv > maxIntv)) {
+    return ERR_PARAM;
   }
 
+  rfalNfcPresenceComplete();
+  ST_MEMSET(&gNfcDev.presence, 0x00, sizeof(rfalNfcPresence));
+  gNfcDev.presence.minInterval = minIntv;
+  gNfcDev.presence.maxInterval = maxIntv;
+  gNfcDev.presence.removedCb   = removedCb;
+  gNfcDev.presence.enabled     = true;
 
-  /*******************************************************************************/
-  /* Passive NFC-B Technology Detection                                          */
-  /*******************************************************************************/
-  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_B) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_B) != 0U)) {
-#if RFAL_FEATURE_NFCB
-
-    if (!gNfcDev.isTechInit) {
-      EXIT_ON_ERR(err, rfalNfcbPollerInitialize());                        /* Initialize RFAL for NFC-B */
-      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                           /* As field is already On only starts GT timer */
-      gNfcDev.isTechInit    = true;
-      gNfcDev.isOperOngoing = false;                                            /* No operation currently ongoing  */
-    }
+  return ERR_NONE;
+}
 
-    if (rfalRfDev->rfalIsGTExpired()) {                                                      /* Wait until Guard Time is fulfilled */
 
-      if (!gNfcDev.isOperOngoing) {
-        rfalNfcbPollerStartTechnologyDetection(gNfcDev.disc.compMode, &gNfcDev.sensbRes, &gNfcDev.sensbResLen);  /* Poll for NFC-B devices */
+/*******************************************************************************/
+void RfalNfcClass::rfalNfcPresenceStop(void)
+{
+  rfalNfcPresenceComplete();
+  gNfcDev.presence.enabled = false;
+}
 
-        gNfcDev.isOperOngoing = true;
-        return ERR_BUSY;
-      }
 
-      err = rfalNfcbPollerGetTechnologyDetectionStatus();
-      if (err != ERR_BUSY) {
-        if (err == ERR_NONE) {
-          gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_B;
-        }
+/*******************************************************************************/
+void RfalNfcClass::rfalNfcPresenceComplete(void)
+{
+  ReturnCode ret;
 
-        gNfcDev.isTechInit = false;
-        gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_B;
-      }
+  if (!gNfcDev.presence.probing) {
+    return;
+  }
 
-      /* Check if bail-out after NFC-B     Activity 2.1  9.2.3.26 */
-      if (((gNfcDev.disc.techs2Bail & RFAL_NFC_POLL_TECH_B) != 0U) && (gNfcDev.techsFound != 0U)) {
-        return ERR_NONE;
-      }
-    }
+  rfalRunBlocking(ret, rfalNfcPresenceProbeGetStatus(gNfcDev.presence.dev));
+  rfalNfcPresenceProbeDone(ret);
+}
 
-    return ERR_BUSY;
 
-#endif /* RFAL_FEATURE_NFCB */
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcGetPresenceStats(rfalNfcPresenceStats *stats)
+{
+  if (stats == NULL) {
+    return ERR_PARAM;
   }
 
-  /*******************************************************************************/
-  /* Passive NFC-F Technology Detection                                          */
-  /*******************************************************************************/
-  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U)) {
-#if RFAL_FEATURE_NFCF
+  *stats = gNfcDev.presence.stats;
 
-    if (!gNfcDev.isTechInit) {
-      EXIT_ON_ERR(err, rfalNfcfPollerInitialize(gNfcDev.disc.nfcfBR));    /* Initialize RFAL for NFC-F */
-      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                          /* As field is already On only starts GT timer */
+  return ERR_NONE;
+}
 
-      gNfcDev.isTechInit    = true;
-      gNfcDev.isOperOngoing = false;                                           /* No operation currently ongoing  */
-    }
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcGetWakeUpStats(rfalNfcWakeUpStats *stats)
+{
+  if (stats == NULL) {
+    return ERR_PARAM;
+  }
+
+  *stats = gNfcDev.wakeup.stats;
+
+  if (gNfcDev.state == RFAL_NFC_STATE_WAKEUP_MODE) {
+    stats->wuTime += (millis() - gNfcDev.wakeup.startTime);                     /* Include the running period */
+  }
+
+  stats->meanDetectTime = (((stats->wakes - stats->falseWakes) == 0U) ? 0U : (stats->detectTimeSum / (stats->wakes - stats->falseWakes)));
+  stats->falseWakeRate  = ((stats->wuTime == 0U) ? 0U : (uint32_t)(((uint64_t)stats->falseWakes * 3600000U) / stats->wuTime));
+
+  return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void RfalNfcClass::rfalNfcClearWakeUpStats(void)
+{
+  ST_MEMSET(&gNfcDev.wakeup.stats, 0x00, sizeof(rfalNfcWakeUpStats));
+  gNfcDev.wakeup.relaxTime = 0U;
+  gNfcDev.wakeup.startTime = millis();
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcSetBufferRegion(uint8_t *region, uint32_t regionLen)
+{
+#if RFAL_FEATURE_NFC_SHARED_BUF
+  uint32_t txLen;
+
+  if ((gNfcDev.state != RFAL_NFC_STATE_NOTINIT) && (gNfcDev.state != RFAL_NFC_STATE_IDLE)) {
+    return ERR_WRONG_STATE;
+  }
+
+  if ((region == NULL) || ((((uintptr_t)region) & (sizeof(uint32_t) - 1U)) != 0U)) {
+    return ERR_PARAM;
+  }
+
+  if (regionLen < (uint32_t)RFAL_NFC_BUF_REGION_LEN) {
+    return ERR_NOMEM;
+  }
+
+  /* Collision Resolution lists are only used while polling and the Tx buffer once activated: both start the region */
+  txLen = (uint32_t)((sizeof(rfalNfcBuffer) > sizeof(rfalNfcColResBuffer)) ? sizeof(rfalNfcBuffer) : sizeof(rfalNfcColResBuffer));
+
+  gNfcDev.colResBuf = (rfalNfcColResBuffer *)region;  /*  PRQA S 0310 # MISRA 11.3 - Intentional cast, the region is word aligned */
+  gNfcDev.txBuf     = (rfalNfcBuffer *)region;        /*  PRQA S 0310 # MISRA 11.3 - Intentional cast, the region is word aligned */
+  gNfcDev.rxBuf     = (rfalNfcBuffer *)&region[txLen];
+#if RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP
+  gNfcDev.tmpBuf    = (rfalNfcTmpBuffer *)&region[txLen + sizeof(rfalNfcBuffer)];
+#endif /* RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP */
+
+  return ERR_NONE;
+#else
+  NO_WARNING(region);
+  NO_WARNING(regionLen);
+
+  return ERR_DISABLED;
+#endif /* RFAL_FEATURE_NFC_SHARED_BUF */
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcGetFootprint(rfalNfcFootprint *fp)
+{
+  if (fp == NULL) {
+    return ERR_PARAM;
+  }
+
+  ST_MEMSET(fp, 0x00, sizeof(rfalNfcFootprint));
+
+  fp->total        = (uint32_t)sizeof(RfalNfcClass);
+  fp->nfcDev       = (uint32_t)sizeof(rfalNfc);
+  fp->devList      = (uint32_t)sizeof(gNfcDev.devList);
+  fp->colResBuf    = (uint32_t)sizeof(rfalNfcColResBuffer);
+  fp->txBuf        = (uint32_t)sizeof(rfalNfcBuffer);
+  fp->rxBuf        = (uint32_t)sizeof(rfalNfcBuffer);
+  fp->tmpBuf       = (uint32_t)RFAL_NFC_TMP_BUF_LEN;
+#if RFAL_FEATURE_NFC_SHARED_BUF
+  fp->bufRegion    = (uint32_t)RFAL_NFC_BUF_REGION_LEN;
+#endif /* RFAL_FEATURE_NFC_SHARED_BUF */
+  fp->isoDep       = (uint32_t)sizeof(rfalIsoDep);
+  fp->nfcb         = (uint32_t)sizeof(rfalNfcb);
+  fp->st25tb       = (uint32_t)sizeof(rfalSt25tb);
+  fp->nfcDep       = (uint32_t)sizeof(rfalNfcDep);
+  fp->nfcfGreedyF  = (uint32_t)sizeof(rfalNfcfGreedyF);
+  fp->t4tListener  = (uint32_t)sizeof(rfalT4tListener);
+  fp->nfcfListener = (uint32_t)sizeof(rfalNfcfListener);
+
+  return ERR_NONE;
+}
+
+
+#if RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL
+/*!
+ ******************************************************************************
+ * \brief ISO-DEP Link Quality Check
+ *
+ * Evaluates the ISO-DEP link quality once RFAL_ISODEP_LQ_WINDOW I-Blocks
+ * have been transmitted and flags a bit rate step down if the number of
+ * transmission errors reached RFAL_ISODEP_LQ_ERR_THRESHOLD. The step down
+ * itself is started by the worker once the exchange is done
+ *
+ ******************************************************************************
+ */
+void RfalNfcClass::rfalNfcIsoDepCheckLinkQuality(void)
+{
+  rfalIsoDepLinkQuality lq;
+
+  rfalIsoDepGetLinkQuality(&lq);
+  if (lq.blocks < RFAL_ISODEP_LQ_WINDOW) {
+    return;
+  }
+
+  rfalIsoDepClearLinkQuality();                       /* Start a new window */
+  if (lq.errors >= RFAL_ISODEP_LQ_ERR_THRESHOLD) {
+    gNfcDev.isoDepStepPending = true;
+  }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief ISO-DEP Start VHBR
+ *
+ * With isoDepAdaptiveBR the activation PPS tops at 848 kbps. If both
+ * directions reached it and a higher bit rate is allowed, the highest
+ * common VHBR is activated by S(PARAMETERS). Listen devices not supporting
+ * S(PARAMETERS) are kept at 848 kbps
+ *
+ ******************************************************************************
+ */
+void RfalNfcClass::rfalNfcIsoDepStartVhbr(rfalIsoDepDevice *isoDepDev)
+{
+  ReturnCode ret;
+
+  if ((!gNfcDev.disc.isoDepAdaptiveBR) || (gNfcDev.isoDepMaxBR <= RFAL_BR_848) || (gNfcDev.isoDepMaxBR > RFAL_BR_13560) ||
+      (isoDepDev->info.DSI != RFAL_BR_848) || (isoDepDev->info.DRI != RFAL_BR_848)) {
+    return;
+  }
+
+  ret = rfalIsoDepPollHandleSParameters(isoDepDev, gNfcDev.isoDepMaxBR, gNfcDev.isoDepMaxBR);
+  NO_WARNING(ret);                                    /* Not supported, keep 848 kbps */
+}
+#endif /* RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL */
+
+#if RFAL_FEATURE_T4T && RFAL_FEATURE_ISO_DEP_LISTEN
+/*!
+ ******************************************************************************
+ * \brief T4T Listener Active
+ *
+ * Checks whether the T4T card emulation engine is enabled and the active
+ * device is a Poller reached over the ISO-DEP interface
+ *
+ * \return  true  : T4T card emulation shall handle the exchange
+ * \return  false : Exchange handled by the caller
+ *
+ ******************************************************************************
+ */
+bool RfalNfcClass::rfalNfcT4tListenerIsActive(void)
+{
+  return (gT4tListener.enabled && (gNfcDev.activeDev != NULL) && rfalNfcIsRemDevPoller(gNfcDev.activeDev->type) && (gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_ISODEP));
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief T4T Listener Respond
+ *
+ * Processes the C-APDU just received and sends back the R-APDU, composed
+ * in place on the ISO-DEP Tx buffer
+ *
+ * \return  ERR_BUSY         : R-APDU transmission ongoing
+ * \return  ERR_XXXX         : Error occurred
+ *
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcT4tListenerRespond(void)
+{
+  ReturnCode ret;
+  uint16_t   rApduLen;
+  uint8_t   *rxData;
+  uint16_t  *rcvLen;
+
+  EXIT_ON_ERR(ret, rfalT4TListenerProcessCApdu(rfalNfcRxBuf.isoDepBuf.apdu, gNfcDev.rxLen, rfalNfcTxBuf.isoDepBuf.apdu, (uint16_t)sizeof(rfalNfcTxBuf.isoDepBuf.apdu), &rApduLen));
+  EXIT_ON_ERR(ret, rfalNfcDataExchangeStart(rfalNfcTxBuf.isoDepBuf.apdu, rApduLen, &rxData, &rcvLen, RFAL_FWT_NONE));
+
+  return gNfcDev.dataExErr;
+}
+#endif /* RFAL_FEATURE_T4T && RFAL_FEATURE_ISO_DEP_LISTEN */
+
+#if RFAL_FEATURE_NFCF && RFAL_FEATURE_LISTEN_MODE
+/*!
+ ******************************************************************************
+ * \brief T3T Listener Active
+ *
+ * Checks whether the T3T card emulation engine is enabled and the active
+ * device is a NFC-F Poller reached over the RF interface
+ *
+ * \return  true  : T3T card emulation shall handle the exchange
+ * \return  false : Exchange handled by the caller
+ *
+ ******************************************************************************
+ */
+bool RfalNfcClass::rfalNfcT3tListenerIsActive(void)
+{
+  return (gNfcfListener.enabled && (gNfcDev.activeDev != NULL) && (gNfcDev.activeDev->type == RFAL_NFC_POLL_TYPE_NFCF) && (gNfcDev.activeDev->rfInterface == RFAL_NFC_INTERFACE_RF));
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief T3T Listener Respond
+ *
+ * Processes the T3T request just received and sends back the response,
+ * composed in place on the RF Tx buffer. If no response is due reception
+ * is simply re-armed
+ *
+ * \return  ERR_BUSY         : Response transmission ongoing
+ * \return  ERR_XXXX         : Error occurred
+ *
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcT3tListenerRespond(void)
+{
+  ReturnCode ret;
+  uint16_t   resLen;
+  uint8_t   *rxData;
+  uint16_t  *rcvLen;
+
+  EXIT_ON_ERR(ret, rfalNfcfListenerProcessT3TReq(rfalNfcRxBuf.rfBuf, rfalConvBitsToBytes(gNfcDev.rxLen), rfalNfcTxBuf.rfBuf, (uint16_t)sizeof(rfalNfcTxBuf.rfBuf), &resLen));
+  EXIT_ON_ERR(ret, rfalNfcDataExchangeStart(rfalNfcTxBuf.rfBuf, (uint16_t)rfalConvBytesToBits(resLen), &rxData, &rcvLen, RFAL_FWT_NONE));
+
+  return gNfcDev.dataExErr;
+}
+#endif /* RFAL_FEATURE_NFCF && RFAL_FEATURE_LISTEN_MODE */
+
+/*!
+ ******************************************************************************
+ * \brief Adaptive Discovery Start
+ *
+ * Computes the Poll technology order for the upcoming discovery cycle:
+ * technologies are sorted by observed hits (ties keep the default order)
+ * and rarely seen ones are only polled once every
+ * RFAL_NFC_ADAPTIVE_RARE_PERIOD cycles
+ *
+ ******************************************************************************
+ */
+void RfalNfcClass::rfalNfcAdaptiveDiscStart(void)
+{
+  static const uint16_t adaptiveTechs[RFAL_NFC_ADAPTIVE_TECHS] = {RFAL_NFC_POLL_TECH_A, RFAL_NFC_POLL_TECH_B, RFAL_NFC_POLL_TECH_F, RFAL_NFC_POLL_TECH_V, RFAL_NFC_POLL_TECH_ST25TB, RFAL_NFC_POLL_TECH_PROP};
+
+  rfalNfcTechStats *st;
+  uint32_t         totalHits;
+  uint16_t         allTechs;
+  uint8_t          i;
+  uint8_t          j;
+
+  totalHits = 0U;
+  allTechs  = RFAL_NFC_TECH_NONE;
+  for (i = 0U; i < RFAL_NFC_ADAPTIVE_TECHS; i++) {
+    gNfcDev.discStats.tech[i].tech = adaptiveTechs[i];
+    totalHits += gNfcDev.discStats.tech[i].hits;
+    allTechs  |= adaptiveTechs[i];
+  }
+
+  gNfcDev.discOrderLen = 0U;
+  gNfcDev.discOrderIdx = 0U;
+
+  for (i = 0U; i < RFAL_NFC_ADAPTIVE_TECHS; i++) {
+    st = &gNfcDev.discStats.tech[i];
+
+    if ((gNfcDev.disc.techs2Find & st->tech) == 0U) {
+      continue;
+    }
+
+    /* Back off rarely seen technologies, they are still polled once every period */
+    if ((totalHits >= RFAL_NFC_ADAPTIVE_RARE_MIN_HITS) && (((uint32_t)st->hits * RFAL_NFC_ADAPTIVE_RARE_RATIO) < totalHits) &&
+        ((gNfcDev.discStats.cycles % RFAL_NFC_ADAPTIVE_RARE_PERIOD) != 0U)) {
+      continue;
+    }
+
+    /* Insert by descending hits */
+    for (j = gNfcDev.discOrderLen; (j > 0U) && (gNfcDev.discStats.tech[gNfcDev.discOrder[j - 1U]].hits < st->hits); j--) {
+      gNfcDev.discOrder[j] = gNfcDev.discOrder[j - 1U];
+    }
+    gNfcDev.discOrder[j] = i;
+    gNfcDev.discOrderLen++;
+  }
+
+  /* Passive technologies are handed to the Technology Detection one at a time */
+  gNfcDev.techs2do &= ~allTechs;
+  if (gNfcDev.discOrderLen > 0U) {
+    gNfcDev.techs2do |= gNfcDev.discStats.tech[gNfcDev.discOrder[0]].tech;
+  }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Adaptive Technology Detection
+ *
+ * Runs the Technology Detection following the adaptive order computed by
+ * rfalNfcAdaptiveDiscStart() and updates the per technology statistics
+ *
+ * \return  ERR_NONE         : Operation completed with no error
+ * \return  ERR_BUSY         : Operation ongoing
+ * \return  ERR_XXXX         : Error occurred
+ *
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcAdaptiveTechDetection(void)
+{
+  ReturnCode       err;
+  rfalNfcTechStats *st;
+  uint32_t         totalHits;
+  uint8_t          i;
+
+  err = rfalNfcPollTechDetection();
+  if ((err != ERR_NONE) || (gNfcDev.discOrderIdx >= gNfcDev.discOrderLen)) {
+    return err;
+  }
+
+  st = &gNfcDev.discStats.tech[gNfcDev.discOrder[gNfcDev.discOrderIdx]];
+  if ((gNfcDev.techs2do & st->tech) != 0U) {
+    return ERR_NONE;                                                            /* Bailed out before reaching this technology */
+  }
+
+  st->polls++;
+  if ((gNfcDev.techsFound & st->tech) != 0U) {
+    st->hits++;
+
+    /* Halve the statistics once the window is reached, so that the order follows changes */
+    totalHits = 0U;
+    for (i = 0U; i < RFAL_NFC_ADAPTIVE_TECHS; i++) {
+      totalHits += gNfcDev.discStats.tech[i].hits;
+    }
+    if (totalHits >= RFAL_NFC_ADAPTIVE_WINDOW) {
+      for (i = 0U; i < RFAL_NFC_ADAPTIVE_TECHS; i++) {
+        gNfcDev.discStats.tech[i].hits  >>= 1U;
+        gNfcDev.discStats.tech[i].polls >>= 1U;
+      }
+    }
+
+    /* Check if bail-out after this technology */
+    if ((gNfcDev.disc.techs2Bail & st->tech) != 0U) {
+      return ERR_NONE;
+    }
+  }
+
+  /* Move on to the next technology in the adaptive order */
+  gNfcDev.discOrderIdx++;
+  if (gNfcDev.discOrderIdx < gNfcDev.discOrderLen) {
+    gNfcDev.techs2do |= gNfcDev.discStats.tech[gNfcDev.discOrder[gNfcDev.discOrderIdx]].tech;
+    return ERR_BUSY;
+  }
+
+  return ERR_NONE;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Presence Probe Start
+ *
+ * Starts the cheapest presence probe valid for the given activated device,
+ * one which leaves the device in its current state. The answer is checked
+ * by rfalNfcPresenceProbeGetStatus()
+ *
+ * \param[in]  dev : activated Poll device
+ *
+ * \return  ERR_NONE         : Probe started
+ * \return  ERR_NOTSUPP      : Device cannot be probed
+ * \return  ERR_XXXX         : Probe could not be started
+ *
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcPresenceProbeStart(const rfalNfcDevice *dev)
+{
+  ReturnCode ret;
+
+  ret = ERR_NOTSUPP;
+  gNfcDev.presence.step = RFAL_NFC_PRESENCE_STEP_PROBE;
+
+  if (dev->rfInterface == RFAL_NFC_INTERFACE_ISODEP) {
+#if RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL
+    ret = rfalIsoDepPollerStartCheckPresence();                                   /* R(NAK), 1 byte each way */
+#endif /* RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL */
+    return ret;
+  }
+
+  if (dev->rfInterface != RFAL_NFC_INTERFACE_RF) {
+    return ERR_NOTSUPP;                                                           /* NFC-DEP has its own ATN handling */
+  }
+
+  switch (dev->type) {
+#if RFAL_FEATURE_NFCA
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_NFCA:
+#if RFAL_FEATURE_T2T
+      if (dev->dev.nfca.type == RFAL_NFCA_T2T) {                                /* SENS_REQ would not be answered in ACTIVE state */
+        ret = rfalT2TPollerStartRead(0, gNfcDev.presence.rxBuf, RFAL_T2T_READ_DATA_LEN, &gNfcDev.presence.rxLen);
+        break;
+      }
+#endif /* RFAL_FEATURE_T2T */
+      if (dev->dev.nfca.type == RFAL_NFCA_T1T) {
+#if RFAL_FEATURE_T1T
+        ret = rfalT1TPollerStartRid((rfalT1TRidRes *)gNfcDev.presence.rxBuf);
+#endif /* RFAL_FEATURE_T1T */
+        break;                                                                  /* No anticollision: cannot be halted and selected again */
+      }
+
+      /* No command answered in ACTIVE state: halt the device, wake it up with ALL_REQ and select it again */
+      gNfcDev.presence.step = RFAL_NFC_PRESENCE_STEP_NFCA_HALT;
+      ret = rfalNfcaPollerStartSleep();
+      break;
+#endif /* RFAL_FEATURE_NFCA */
+
+#if RFAL_FEATURE_NFCF
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_NFCF:
+      ret = rfalRfDev->rfalStartFeliCaPoll(RFAL_FELICA_1_SLOT, RFAL_NFCF_SYSTEMCODE, RFAL_FELICA_POLL_RC_NO_REQUEST, (rfalFeliCaPollRes *)gNfcDev.presence.rxBuf, 1U, &gNfcDev.presence.devCnt, &gNfcDev.presence.collisions);
+      break;
+#endif /* RFAL_FEATURE_NFCF */
+
+#if RFAL_FEATURE_NFCV
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_NFCV:
+      /* Addressed so that no other device answers */
+      ret = rfalNfcvPollerStartReadSingleBlock((uint8_t)RFAL_NFCV_REQ_FLAG_DEFAULT, dev->dev.nfcv.InvRes.UID, 0, gNfcDev.presence.rxBuf, sizeof(gNfcDev.presence.rxBuf), &gNfcDev.presence.rxLen);
+      break;
+#endif /* RFAL_FEATURE_NFCV */
+
+#if RFAL_FEATURE_ST25TB
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_ST25TB:
+      ret = rfalSt25tbPollerStartGetUID((rfalSt25tbUID *)gNfcDev.presence.rxBuf);  /* INITIATE would not be answered in SELECTED state */
+      break;
+#endif /* RFAL_FEATURE_ST25TB */
+
+    /*******************************************************************************/
+    default:
+      break;
+  }
+
+  return ret;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Presence Probe Get Status
+ *
+ * Checks the answer of the probe started by rfalNfcPresenceProbeStart() and
+ * moves the NFC-A probe to its next step
+ *
+ * \param[in]  dev : activated Poll device
+ *
+ * \return  ERR_BUSY         : Probe in progress
+ * \return  ERR_NONE         : Device answered
+ * \return  ERR_XXXX         : No or invalid answer
+ *
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcPresenceProbeGetStatus(const rfalNfcDevice *dev)
+{
+  ReturnCode ret;
+
+  ret = ERR_NOTSUPP;
+
+  if (dev->rfInterface == RFAL_NFC_INTERFACE_ISODEP) {
+#if RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL
+    ret = rfalIsoDepPollerGetCheckPresenceStatus();
+#endif /* RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_POLL */
+    return ret;
+  }
+
+  switch (dev->type) {
+#if RFAL_FEATURE_NFCA
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_NFCA:
+      if (gNfcDev.presence.step == RFAL_NFC_PRESENCE_STEP_NFCA_HALT) {
+        EXIT_ON_BUSY(ret, rfalNfcaPollerGetSleepStatus());
+
+        /* Short frame, answered within FDT(Listen, min) */
+        EXIT_ON_ERR(ret, rfalNfcaPollerCheckPresence(RFAL_14443A_SHORTFRAME_CMD_WUPA, (rfalNfcaSensRes *)gNfcDev.presence.rxBuf));
+
+        /* Device present, select it again so that it is left ACTIVE */
+        EXIT_ON_ERR(ret, rfalNfcaPollerStartSelect(dev->dev.nfca.nfcId1, dev->dev.nfca.nfcId1Len, (rfalNfcaSelRes *)gNfcDev.presence.rxBuf));
+        gNfcDev.presence.step = RFAL_NFC_PRESENCE_STEP_NFCA_SELECT;
+        return ERR_BUSY;
+      }
+      if (gNfcDev.presence.step == RFAL_NFC_PRESENCE_STEP_NFCA_SELECT) {
+        ret = rfalNfcaPollerGetSelectStatus();
+        break;
+      }
+#if RFAL_FEATURE_T2T
+      if (dev->dev.nfca.type == RFAL_NFCA_T2T) {
+        ret = rfalT2TPollerGetReadStatus();
+      }
+#endif /* RFAL_FEATURE_T2T */
+#if RFAL_FEATURE_T1T
+      if (dev->dev.nfca.type == RFAL_NFCA_T1T) {
+        ret = rfalT1TPollerGetRidStatus();
+      }
+#endif /* RFAL_FEATURE_T1T */
+      break;
+#endif /* RFAL_FEATURE_NFCA */
+
+#if RFAL_FEATURE_NFCF
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_NFCF:
+      ret = rfalRfDev->rfalGetFeliCaPollStatus();
+      if ((ret == ERR_NONE) && (gNfcDev.presence.devCnt == 0U)) {
+        ret = ERR_TIMEOUT;
+      }
+      break;
+#endif /* RFAL_FEATURE_NFCF */
+
+#if RFAL_FEATURE_NFCV
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_NFCV:
+      ret = rfalNfcvPollerGetReadSingleBlockStatus();
+      if ((ret == ERR_REQUEST) || (ret == ERR_NOTSUPP) || (ret == ERR_WRITE)) {
+        ret = ERR_NONE;                                                         /* Error answer, e.g. read protected block: device present */
+      }
+      break;
+#endif /* RFAL_FEATURE_NFCV */
+
+#if RFAL_FEATURE_ST25TB
+    /*******************************************************************************/
+    case RFAL_NFC_LISTEN_TYPE_ST25TB:
+      ret = rfalSt25tbPollerGetUIDStatus();
+      break;
+#endif /* RFAL_FEATURE_ST25TB */
+
+    /*******************************************************************************/
+    default:
+      break;
+  }
+
+  return ret;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Presence Probe Done
+ *
+ * Accounts the result of a probe. The interval doubles after each answer up
+ * to maxInterval and drops back to minInterval after a miss, unanswered
+ * probes are retried at once. Reports the removal after
+ * RFAL_NFC_PRESENCE_RETRIES retries
+ *
+ ******************************************************************************
+ */
+void RfalNfcClass::rfalNfcPresenceProbeDone(ReturnCode ret)
+{
+  gNfcDev.presence.probing = false;
+  gNfcDev.presence.stats.probes++;
+  gNfcDev.presence.stats.rfTime += (micros() - gNfcDev.presence.probeStart);
+
+  if (ret == ERR_NONE) {
+    gNfcDev.presence.misses   = 0;
+    gNfcDev.presence.lastSeen = millis();
+    gNfcDev.presence.interval = (uint16_t)MIN(((uint32_t)gNfcDev.presence.interval * 2U), gNfcDev.presence.maxInterval);
+    return;
+  }
+
+  gNfcDev.presence.stats.misses++;
+  gNfcDev.presence.interval = gNfcDev.presence.minInterval;
+
+  if (gNfcDev.presence.misses++ < RFAL_NFC_PRESENCE_RETRIES) {
+    return;                                                                     /* Retry on next call */
+  }
+
+  gNfcDev.presence.removed = true;
+  gNfcDev.presence.stats.removals++;
+  gNfcDev.presence.stats.lastLatency = (millis() - gNfcDev.presence.lastSeen);
+  gNfcDev.presence.removedCb(gNfcDev.activeDev);
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Presence Worker
+ *
+ * Starts a probe of the activated Poll device once its interval has elapsed,
+ * and checks the answer of the probe in progress on the following calls
+ *
+ ******************************************************************************
+ */
+void RfalNfcClass::rfalNfcPresenceWorker(void)
+{
+  ReturnCode ret;
+  uint32_t   now;
+
+  if ((!gNfcDev.presence.enabled) || (gNfcDev.activeDev == NULL) || (!rfalNfcIsRemDevListener(gNfcDev.activeDev->type))) {
+    return;
+  }
+
+  now = millis();
+
+  if (gNfcDev.presence.dev != gNfcDev.activeDev) {                              /* Newly activated device */
+    gNfcDev.presence.dev          = gNfcDev.activeDev;
+    gNfcDev.presence.removed      = false;
+    gNfcDev.presence.notSupported = false;
+    gNfcDev.presence.probing      = false;
+    gNfcDev.presence.misses       = 0;
+    gNfcDev.presence.interval     = gNfcDev.presence.minInterval;
+    gNfcDev.presence.lastSeen     = now;
+    return;
+  }
+
+  if (gNfcDev.presence.removed || gNfcDev.presence.notSupported) {
+    return;
+  }
+
+  if (gNfcDev.presence.probing) {
+    ret = rfalNfcPresenceProbeGetStatus(gNfcDev.presence.dev);
+    if (ret != ERR_BUSY) {                                                      /* Otherwise checked again on next call */
+      rfalNfcPresenceProbeDone(ret);
+    }
+    return;
+  }
+
+  if (gNfcDev.isTxBufAcquired || gNfcDev.isRxChaining) {
+    return;                                                                     /* Application exchange outstanding */
+  }
+
+  if ((gNfcDev.presence.misses == 0U) && ((now - gNfcDev.presence.lastSeen) < gNfcDev.presence.interval)) {
+    return;                                                                     /* Not due yet */
+  }
+
+  gNfcDev.presence.probeStart = micros();
+  ret = rfalNfcPresenceProbeStart(gNfcDev.presence.dev);
+  if (ret == ERR_NOTSUPP) {
+    gNfcDev.presence.notSupported = true;                                       /* Device cannot be monitored, not removed */
+    return;
+  }
+
+  if (ret != ERR_NONE) {
+    rfalNfcPresenceProbeDone(ret);
+    return;
+  }
+
+  gNfcDev.presence.probing = true;                                              /* Answer checked on next calls */
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Wake-Up Start
+ *
+ * Starts the Wake-Up mode with the default configuration, the given one or,
+ * when wakeupAdaptive, the retuned one
+ *
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcWakeUpStart(void)
+{
+#if RFAL_FEATURE_WAKEUP_MODE
+  ReturnCode ret;
+
+  if (gNfcDev.disc.wakeupConfigDefault) {
+    ret = rfalRfDev->rfalWakeUpModeStart(NULL);
+  } else {
+    ret = rfalRfDev->rfalWakeUpModeStart((rfalNfcIsWakeUpAdaptive() ? &gNfcDev.wakeup.config : &gNfcDev.disc.wakeupConfig));
+  }
+
+  gNfcDev.wakeup.startTime      = millis();
+  gNfcDev.wakeup.sampleTime     = gNfcDev.wakeup.startTime;
+  gNfcDev.wakeup.indAmp.samples = 0U;                                           /* Reference may be measured again */
+  gNfcDev.wakeup.indAmp.drift   = 0;
+  gNfcDev.wakeup.indPha.samples = 0U;
+  gNfcDev.wakeup.indPha.drift   = 0;
+
+  return ret;
+#else
+  return ERR_DISABLED;
+#endif /* RFAL_FEATURE_WAKEUP_MODE */
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Wake-Up Track
+ *
+ * Reads the Wake-Up measurements every RFAL_NFC_WAKEUP_TRACK_INTERVAL,
+ * retunes the enabled channels and restarts the Wake-Up mode if the
+ * configuration has changed. If the restart fails the previous configuration
+ * is restored, and if the Wake-Up mode still cannot be started the discovery
+ * moves on to Technology Detection. The false wake-up bias is lowered after
+ * RFAL_NFC_WAKEUP_RELAX_TIME of Wake-Up mode without false wake-up
+ *
+ ******************************************************************************
+ */
+void RfalNfcClass::rfalNfcWakeUpTrack(void)
+{
+#if RFAL_FEATURE_WAKEUP_MODE
+  rfalWakeUpInfo   info;
+  rfalWakeUpConfig prevConfig;
+  uint32_t         now;
+  uint32_t         wuTime;
+  bool             changed;
+
+  if (!rfalNfcIsWakeUpAdaptive()) {
+    return;
+  }
+
+  now = millis();
+  if ((now - gNfcDev.wakeup.sampleTime) < RFAL_NFC_WAKEUP_TRACK_INTERVAL) {
+    return;                                                                     /* Not due yet */
+  }
+  gNfcDev.wakeup.sampleTime = now;
+
+  if ((!rfalRfDev->rfalWakeUpModeIsEnabled()) || (rfalRfDev->rfalWakeUpModeGetInfo(true, &info) != ERR_NONE)) {
+    return;                                                                     /* Still starting up */
+  }
+  gNfcDev.wakeup.stats.samples++;
+
+  wuTime = (gNfcDev.wakeup.stats.wuTime + (now - gNfcDev.wakeup.startTime));
+  if ((gNfcDev.wakeup.bias > 0U) && ((wuTime - gNfcDev.wakeup.relaxTime) >= RFAL_NFC_WAKEUP_RELAX_TIME)) {
+    gNfcDev.wakeup.bias--;
+    gNfcDev.wakeup.relaxTime = wuTime;
+  }
+
+  prevConfig = gNfcDev.wakeup.config;                                           /* Kept in case the retuned one is refused */
+
+  changed  = rfalNfcWakeUpTuneChannel(&gNfcDev.wakeup.config.indAmp, &gNfcDev.wakeup.indAmp, info.indAmp.lastMeas, info.indAmp.reference);
+  changed |= rfalNfcWakeUpTuneChannel(&gNfcDev.wakeup.config.indPha, &gNfcDev.wakeup.indPha, info.indPha.lastMeas, info.indPha.reference);
+
+  if (changed) {
+    rfalRfDev->rfalWakeUpModeStop();
+    gNfcDev.wakeup.stats.wuTime += (now - gNfcDev.wakeup.startTime);
+
+    if (rfalNfcWakeUpStart() == ERR_NONE) {
+      gNfcDev.wakeup.stats.retunes++;
+      return;
+    }
+
+    gNfcDev.wakeup.config = prevConfig;                                         /* Retuned config refused, restore the previous one */
+    if (rfalNfcWakeUpStart() == ERR_NONE) {
+      return;
+    }
+
+    /* Wake-Up mode cannot be restarted: poll rather than stay in Wake-Up mode with the RF chip idle */
+    gNfcDev.state         = RFAL_NFC_STATE_POLL_TECHDETECT;
+    gNfcDev.discTmr       = (uint32_t)timerCalculateTimer(gNfcDev.disc.totalDuration);
+    gNfcDev.discStartTime = millis();
+    rfalNfcNfcNotify(gNfcDev.state);
+  }
+#endif /* RFAL_FEATURE_WAKEUP_MODE */
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Wake-Up Tune Channel
+ *
+ * Updates the drift (mean offset of the measurement from the reference) and
+ * noise (mean deviation around the drift) of a channel, in 1/16 units with a
+ * 1/8 weight for the new sample. Once warmed up the delta is set to the noise
+ * margin plus the false wake-up bias. A drift reaching half the delta enables
+ * auto averaging or lowers its weight, a steady reference raises it back
+ *
+ * \return true if the channel configuration has changed
+ *
+ ******************************************************************************
+ */
+bool RfalNfcClass::rfalNfcWakeUpTuneChannel(rfalWumMeasChannel *ch, rfalNfcWakeUpChannel *trk, uint8_t lastMeas, uint8_t reference)
+{
+  int32_t  offset;
+  int32_t  dev;
+  uint32_t delta;
+  uint32_t drift;
+  bool     changed;
+
+  if (!ch->enabled) {
+    return false;
+  }
+
+  offset      = (((int32_t)lastMeas - (int32_t)reference) * 16);
+  trk->drift  = (int16_t)(trk->drift + ((offset - trk->drift) / 8));
+  dev         = ((offset > trk->drift) ? (offset - trk->drift) : (trk->drift - offset));
+  trk->noise  = (uint16_t)((int32_t)trk->noise + ((dev - (int32_t)trk->noise) / 8));
+  trk->samples = (uint8_t)MIN(((uint32_t)trk->samples + 1U), 0xFFU);
+
+  if (trk->samples < RFAL_NFC_WAKEUP_WARMUP_SAMPLES) {
+    return false;
+  }
+
+  changed = false;
+
+  /* Delta: noise margin plus false wake-up bias, with a hysteresis of 1 when lowering */
+  delta = ((((uint32_t)trk->noise * RFAL_NFC_WAKEUP_NOISE_MARGIN) + 15U) / 16U) + gNfcDev.wakeup.bias;
+  delta = MIN(MAX(delta, RFAL_NFC_WAKEUP_DELTA_MIN), RFAL_NFC_WAKEUP_DELTA_MAX);
+  if ((delta > ch->delta) || ((delta + 1U) < ch->delta)) {
+    ch->delta = (uint8_t)delta;
+    changed   = true;
+  }
+
+  /* Averaging: follow the reference faster while it drifts, filter more while it is steady */
+  drift = (uint32_t)((trk->drift < 0) ? -trk->drift : trk->drift);
+  if ((drift * 2U) >= ((uint32_t)ch->delta * 16U)) {
+    trk->stable = 0U;
+    if (!ch->autoAvg) {
+      ch->autoAvg  = true;
+      ch->aaWeight = RFAL_WUM_AA_WEIGHT_16;
+      changed      = true;
+    } else if (ch->aaWeight > RFAL_WUM_AA_WEIGHT_4) {
+      ch->aaWeight = (rfalWumAAWeight)((uint8_t)ch->aaWeight - 1U);
+      changed      = true;
+    } else {
+      /* MISRA 15.7 - Empty else */
+    }
+  } else if (drift < 16U) {
+    if ((++trk->stable >= RFAL_NFC_WAKEUP_STABLE_SAMPLES) && ch->autoAvg && (ch->aaWeight < RFAL_WUM_AA_WEIGHT_32)) {
+      ch->aaWeight = (rfalWumAAWeight)((uint8_t)ch->aaWeight + 1U);
+      trk->stable  = 0U;
+      changed      = true;
+    }
+  } else {
+    trk->stable = 0U;
+  }
+
+  return changed;
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Wake-Up Detected
+ *
+ * Classifies the last wake-up once the first technology detection after it
+ * has completed: a device found accounts the wake-up to detection time,
+ * nothing found is a false wake-up and raises the delta bias
+ *
+ ******************************************************************************
+ */
+void RfalNfcClass::rfalNfcWakeUpDetected(bool found)
+{
+  gNfcDev.wakeup.woke = false;
+
+  if (found) {
+    gNfcDev.wakeup.stats.detectTimeSum += (millis() - gNfcDev.wakeup.wokeTime);
+    return;
+  }
+
+  gNfcDev.wakeup.stats.falseWakes++;
+  gNfcDev.wakeup.relaxTime = gNfcDev.wakeup.stats.wuTime;
+
+  if (gNfcDev.wakeup.bias < RFAL_NFC_WAKEUP_BIAS_MAX) {
+    gNfcDev.wakeup.bias++;
+
+    /* Applied on the next Wake-Up mode start */
+    if (gNfcDev.wakeup.config.indAmp.enabled && (gNfcDev.wakeup.config.indAmp.delta < RFAL_NFC_WAKEUP_DELTA_MAX)) {
+      gNfcDev.wakeup.config.indAmp.delta++;
+    }
+    if (gNfcDev.wakeup.config.indPha.enabled && (gNfcDev.wakeup.config.indPha.delta < RFAL_NFC_WAKEUP_DELTA_MAX)) {
+      gNfcDev.wakeup.config.indPha.delta++;
+    }
+  }
+}
+
+
+/*!
+ ******************************************************************************
+ * \brief Poller Technology Detection
+ *
+ * This method implements the Technology Detection / Poll for different
+ * device technologies.
+ *
+ * \return  ERR_NONE         : Operation completed with no error
+ * \return  ERR_BUSY         : Operation ongoing
+ * \return  ERR_XXXX         : Error occurred
+ *
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcPollTechDetection(void)
+{
+  ReturnCode           err;
+
+  err = ERR_NONE;
+
+  /* Suppress warning when specific RFAL features have been disabled */
+  NO_WARNING(err);
+
+
+  /*******************************************************************************/
+  /* AP2P Technology Detection                                                   */
+  /*******************************************************************************/
+  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_AP2P) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_AP2P) != 0U)) {
+#if RFAL_FEATURE_NFC_DEP
+    if (!gNfcDev.isTechInit) {
+      EXIT_ON_ERR(err, rfalRfDev->rfalSetMode(RFAL_MODE_POLL_ACTIVE_P2P, gNfcDev.disc.ap2pBR, gNfcDev.disc.ap2pBR));
+      rfalRfDev->rfalSetErrorHandling(ERRORHANDLING_NONE);
+      rfalRfDev->rfalSetFDTListen(RFAL_FDT_LISTEN_AP2P_POLLER);
+      rfalRfDev->rfalSetFDTPoll(RFAL_FDT_POLL_AP2P_POLLER);
+      rfalRfDev->rfalSetGT(RFAL_GT_AP2P_ADJUSTED);
+      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                                       /* Turns the Field On and starts GT timer */
+      gNfcDev.isTechInit = true;
+    }
+
+    if (rfalRfDev->rfalIsGTExpired()) {                                                             /* Wait until Guard Time is fulfilled */
+      gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_AP2P;
+
+      err = rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_ACTIVE, NULL, 0);  /* Poll for NFC-A devices */
+      if (err == ERR_NONE) {
+        gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_AP2P;
+
+        gNfcDev.devList->type        = RFAL_NFC_LISTEN_TYPE_AP2P;
+        gNfcDev.devList->rfInterface = RFAL_NFC_INTERFACE_NFCDEP;
+        gNfcDev.devCnt++;
+
+        return ERR_NONE;
+      }
+      gNfcDev.isTechInit = false;
+      rfalRfDev->rfalFieldOff();
+    }
+    return ERR_BUSY;
+#endif /* RFAL_FEATURE_NFC_DEP */
+  }
+
+  /*******************************************************************************/
+  /* Turn Field On if Passive Poll technologies are enabled                      */
+  /*******************************************************************************/
+  if ((!gNfcDev.isFieldOn) && ((gNfcDev.disc.techs2Find & (RFAL_NFC_POLL_TECH_A | RFAL_NFC_POLL_TECH_B | RFAL_NFC_POLL_TECH_F | RFAL_NFC_POLL_TECH_V | RFAL_NFC_POLL_TECH_ST25TB | RFAL_NFC_POLL_TECH_PROP)) != 0U)) {
+    EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                                /* Turns the Field On  */
+    gNfcDev.isFieldOn = true;
+    return ERR_BUSY;
+  }
+
+  /*******************************************************************************/
+  /* Passive NFC-A Technology Detection                                          */
+  /*******************************************************************************/
+  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_A) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_A) != 0U)) {
+#if RFAL_FEATURE_NFCA
+    if (!gNfcDev.isTechInit) {
+      EXIT_ON_ERR(err, rfalNfcaPollerInitialize());                         /* Initialize RFAL for NFC-A */
+      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                            /* As field is already On only starts GT timer */
+      gNfcDev.isTechInit    = true;
+      gNfcDev.isOperOngoing = false;                                             /* No operation currently ongoing  */
+    }
+
+    if (rfalRfDev->rfalIsGTExpired()) {                                                       /* Wait until Guard Time is fulfilled */
+      if (!gNfcDev.isOperOngoing) {
+        rfalNfcaPollerStartTechnologyDetection(gNfcDev.disc.compMode, &gNfcDev.sensRes);  /* Poll for NFC-A devices */
+
+        gNfcDev.isOperOngoing = true;
+        return ERR_BUSY;
+      }
+
+      err = rfalNfcaPollerGetTechnologyDetectionStatus();
+      if (err != ERR_BUSY) {
+        if (err == ERR_NONE) {
+          gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_A;
+        }
+
+        gNfcDev.isTechInit = false;
+        gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_A;
+      }
+
+      /* Check if bail-out after NFC-A     Activity 2.1  9.2.3.21 */
+      if (((gNfcDev.disc.techs2Bail & RFAL_NFC_POLL_TECH_A) != 0U) && (gNfcDev.techsFound != 0U)) {
+        return ERR_NONE;
+      }
+    }
+    return ERR_BUSY;
+#endif /* RFAL_FEATURE_NFCA */
+
+  }
+
+
+  /*******************************************************************************/
+  /* Passive NFC-B Technology Detection                                          */
+  /*******************************************************************************/
+  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_B) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_B) != 0U)) {
+#if RFAL_FEATURE_NFCB
+
+    if (!gNfcDev.isTechInit) {
+      EXIT_ON_ERR(err, rfalNfcbPollerInitialize());                        /* Initialize RFAL for NFC-B */
+      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                           /* As field is already On only starts GT timer */
+      gNfcDev.isTechInit    = true;
+      gNfcDev.isOperOngoing = false;                                            /* No operation currently ongoing  */
+    }
+
+    if (rfalRfDev->rfalIsGTExpired()) {                                                      /* Wait until Guard Time is fulfilled */
+
+      if (!gNfcDev.isOperOngoing) {
+        rfalNfcbPollerStartTechnologyDetection(gNfcDev.disc.compMode, &gNfcDev.sensbRes, &gNfcDev.sensbResLen);  /* Poll for NFC-B devices */
+
+        gNfcDev.isOperOngoing = true;
+        return ERR_BUSY;
+      }
+
+      err = rfalNfcbPollerGetTechnologyDetectionStatus();
+      if (err != ERR_BUSY) {
+        if (err == ERR_NONE) {
+          gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_B;
+        }
+
+        gNfcDev.isTechInit = false;
+        gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_B;
+      }
+
+      /* Check if bail-out after NFC-B     Activity 2.1  9.2.3.26 */
+      if (((gNfcDev.disc.techs2Bail & RFAL_NFC_POLL_TECH_B) != 0U) && (gNfcDev.techsFound != 0U)) {
+        return ERR_NONE;
+      }
+    }
+
+    return ERR_BUSY;
+
+#endif /* RFAL_FEATURE_NFCB */
+  }
+
+  /*******************************************************************************/
+  /* Passive NFC-F Technology Detection                                          */
+  /*******************************************************************************/
+  if (((gNfcDev.disc.techs2Find & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U)) {
+#if RFAL_FEATURE_NFCF
+
+    if (!gNfcDev.isTechInit) {
+      EXIT_ON_ERR(err, rfalNfcfPollerInitialize(gNfcDev.disc.nfcfBR));    /* Initialize RFAL for NFC-F */
+      EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                          /* As field is already On only starts GT timer */
+
+      gNfcDev.isTechInit    = true;
+      gNfcDev.isOperOngoing = false;                                           /* No operation currently ongoing  */
+    }
 
     if (rfalRfDev->rfalIsGTExpired()) {                                                     /* Wait until Guard Time is fulfilled */
 
@@ -944,19 +2155,31 @@ ReturnCode RfalNfcClass::rfalNfcPollTechDetection(void)
 #if RFAL_FEATURE_ST25TB
 
     if (!gNfcDev.isTechInit) {
-      EXIT_ON_ERR(err, rfalSt25tbPollerInitialize());                      /* Initialize RFAL for NFC-V */
+      EXIT_ON_ERR(err, rfalSt25tbPollerInitialize());                      /* Initialize RFAL for ST25TB */
       EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                           /* As field is already On only starts GT timer */
-      gNfcDev.isTechInit = true;
+
+      gNfcDev.isTechInit    = true;
+      gNfcDev.isOperOngoing = false;                                           /* No operation currently ongoing  */
     }
 
     if (rfalRfDev->rfalIsGTExpired()) {                                                      /* Wait until Guard Time is fulfilled */
-      err = rfalSt25tbPollerCheckPresence(NULL);                                /* Poll for ST25TB devices */
-      if (err == ERR_NONE) {
-        gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_ST25TB;
+
+      if (!gNfcDev.isOperOngoing) {
+        EXIT_ON_ERR(err, rfalSt25tbPollerStartCheckPresence(NULL));
+
+        gNfcDev.isOperOngoing = true;
+        return ERR_BUSY;
       }
 
-      gNfcDev.isTechInit = false;
-      gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_ST25TB;
+      err = rfalSt25tbPollerGetCheckPresenceStatus();                          /* Poll for ST25TB devices */
+      if (err != ERR_BUSY) {
+        if (err == ERR_NONE) {
+          gNfcDev.techsFound |= RFAL_NFC_POLL_TECH_ST25TB;
+        }
+
+        gNfcDev.isTechInit = false;
+        gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_ST25TB;
+      }
     }
 
     return ERR_BUSY;
@@ -1027,8 +2250,6 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
   /*******************************************************************************/
 #if RFAL_FEATURE_NFCA
   if (((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_A) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_A) != 0U)) {  /* If a NFC-A device was found/detected, perform Collision Resolution */
-    static rfalNfcaListenDevice nfcaDevList[RFAL_NFC_MAX_DEVICES];
-
     if (!gNfcDev.isTechInit) {
       EXIT_ON_ERR(err, rfalNfcaPollerInitialize());                         /* Initialize RFAL for NFC-A */
       EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                            /* Turns the Field On and starts GT timer */
@@ -1042,7 +2263,7 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
     }
 
     if (!gNfcDev.isOperOngoing) {
-      EXIT_ON_ERR(err, rfalNfcaPollerStartFullCollisionResolution(gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcaDevList, &devCnt));
+      EXIT_ON_ERR(err, rfalNfcaPollerStartFullCollisionResolution(gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcColResBuf.nfcaDevList, &devCnt));
 
       gNfcDev.isOperOngoing = true;
       return ERR_BUSY;
@@ -1056,7 +2277,7 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
       if ((err == ERR_NONE) && (devCnt != 0U)) {
         for (i = 0; i < devCnt; i++) {                                            /* Copy devices found form local Nfca list into global device list */
           gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCA;
-          gNfcDev.devList[gNfcDev.devCnt].dev.nfca = nfcaDevList[i];
+          gNfcDev.devList[gNfcDev.devCnt].dev.nfca = rfalNfcColResBuf.nfcaDevList[i];
           gNfcDev.devCnt++;
         }
       }
@@ -1071,8 +2292,6 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
   /*******************************************************************************/
 #if RFAL_FEATURE_NFCB
   if (((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_B) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_B) != 0U)) {  /* If a NFC-B device was found/detected, perform Collision Resolution */
-    static rfalNfcbListenDevice nfcbDevList[RFAL_NFC_MAX_DEVICES];
-
     if (!gNfcDev.isTechInit) {
       EXIT_ON_ERR(err, rfalNfcbPollerInitialize());                         /* Initialize RFAL for NFC-B */
       EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                            /* Ensure GT again as other technologies have also been polled */
@@ -1086,7 +2305,7 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
     }
 
     if (!gNfcDev.isOperOngoing) {
-      EXIT_ON_ERR(err, rfalNfcbPollerStartCollisionResolution(gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcbDevList, &devCnt));
+      EXIT_ON_ERR(err, rfalNfcbPollerStartCollisionResolution(gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcColResBuf.nfcbDevList, &devCnt));
 
       gNfcDev.isOperOngoing = true;
       return ERR_BUSY;
@@ -1101,7 +2320,7 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
       if ((err == ERR_NONE) && (devCnt != 0U)) {
         for (i = 0; i < devCnt; i++) {                                            /* Copy devices found form local Nfcb list into global device list */
           gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCB;
-          gNfcDev.devList[gNfcDev.devCnt].dev.nfcb = nfcbDevList[i];
+          gNfcDev.devList[gNfcDev.devCnt].dev.nfcb = rfalNfcColResBuf.nfcbDevList[i];
           gNfcDev.devCnt++;
         }
       }
@@ -1116,8 +2335,6 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
   /*******************************************************************************/
 #if RFAL_FEATURE_NFCF
   if (((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_F) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_F) != 0U)) { /* If a NFC-F device was found/detected, perform Collision Resolution */
-    static rfalNfcfListenDevice nfcfDevList[RFAL_NFC_MAX_DEVICES];
-
     if (!gNfcDev.isTechInit) {
       EXIT_ON_ERR(err, rfalNfcfPollerInitialize(gNfcDev.disc.nfcfBR));      /* Initialize RFAL for NFC-F */
       EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                            /* Ensure GT again as other technologies have also been polled */
@@ -1131,7 +2348,7 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
     }
 
     if (!gNfcDev.isOperOngoing) {
-      EXIT_ON_ERR(err, rfalNfcfPollerStartCollisionResolution(gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcfDevList, &devCnt));
+      EXIT_ON_ERR(err, rfalNfcfPollerStartCollisionResolution(gNfcDev.disc.compMode, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcColResBuf.nfcfDevList, &devCnt));
 
       gNfcDev.isOperOngoing = true;
       return ERR_BUSY;
@@ -1145,7 +2362,7 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
       if ((err == ERR_NONE) && (devCnt != 0U)) {
         for (i = 0; i < devCnt; i++) {                                         /* Copy devices found form local Nfcf list into global device list */
           gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCF;
-          gNfcDev.devList[gNfcDev.devCnt].dev.nfcf = nfcfDevList[i];
+          gNfcDev.devList[gNfcDev.devCnt].dev.nfcf = rfalNfcColResBuf.nfcfDevList[i];
           gNfcDev.devCnt++;
         }
       }
@@ -1160,8 +2377,6 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
   /*******************************************************************************/
 #if RFAL_FEATURE_NFCV
   if (((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_V) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_V) != 0U)) { /* If a NFC-V device was found/detected, perform Collision Resolution */
-    rfalNfcvListenDevice nfcvDevList[RFAL_NFC_MAX_DEVICES];
-
     if (!gNfcDev.isTechInit) {
       EXIT_ON_ERR(err, rfalNfcvPollerInitialize());                        /* Initialize RFAL for NFC-V */
       EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                           /* Ensure GT again as other technologies have also been polled */
@@ -1176,11 +2391,11 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
     gNfcDev.isTechInit = false;
     gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_V;
 
-    err = rfalNfcvPollerCollisionResolution(RFAL_COMPLIANCE_MODE_NFC, (gNfcDev.disc.devLimit - gNfcDev.devCnt), nfcvDevList, &devCnt);
+    err = rfalNfcvPollerCollisionResolution(RFAL_COMPLIANCE_MODE_NFC, (gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcColResBuf.nfcvDevList, &devCnt);
     if ((err == ERR_NONE) && (devCnt != 0U)) {
       for (i = 0; i < devCnt; i++) {                                            /* Copy devices found form local Nfcf list into global device list */
         gNfcDev.devList[gNfcDev.devCnt].type     = RFAL_NFC_LISTEN_TYPE_NFCV;
-        gNfcDev.devList[gNfcDev.devCnt].dev.nfcv = nfcvDevList[i];
+        gNfcDev.devList[gNfcDev.devCnt].dev.nfcv = rfalNfcColResBuf.nfcvDevList[i];
         gNfcDev.devCnt++;
       }
     }
@@ -1194,28 +2409,36 @@ ReturnCode RfalNfcClass::rfalNfcPollCollResolution(void)
   /*******************************************************************************/
 #if RFAL_FEATURE_ST25TB
   if (((gNfcDev.techsFound & RFAL_NFC_POLL_TECH_ST25TB) != 0U) && ((gNfcDev.techs2do & RFAL_NFC_POLL_TECH_ST25TB) != 0U)) { /* If a ST25TB device was found/detected, perform Collision Resolution */
-    rfalSt25tbListenDevice st25tbDevList[RFAL_NFC_MAX_DEVICES];
-
     if (!gNfcDev.isTechInit) {
       EXIT_ON_ERR(err, rfalSt25tbPollerInitialize());                      /* Initialize RFAL for ST25TB */
       EXIT_ON_ERR(err, rfalRfDev->rfalFieldOnAndStartGT());                           /* Ensure GT again as other technologies have also been polled */
-      gNfcDev.isTechInit = true;
+
+      gNfcDev.isTechInit    = true;
+      gNfcDev.isOperOngoing = false;                                             /* No operation currently ongoing  */
     }
 
     if (!(rfalRfDev->rfalIsGTExpired())) {
       return ERR_BUSY;
     }
 
-    devCnt             = 0;
-    gNfcDev.isTechInit = false;
-    gNfcDev.techs2do &= ~RFAL_NFC_POLL_TECH_ST25TB;
+    if (!gNfcDev.isOperOngoing) {
+      EXIT_ON_ERR(err, rfalSt25tbPollerStartCollisionResolution((gNfcDev.disc.devLimit - gNfcDev.devCnt), rfalNfcColResBuf.st25tbDevList, &devCnt));
 
-    err = rfalSt25tbPollerCollisionResolution((gNfcDev.disc.devLimit - gNfcDev.devCnt), st25tbDevList, &devCnt);
-    if ((err == ERR_NONE) && (devCnt != 0U)) {
-      for (i = 0; i < devCnt; i++) {                                            /* Copy devices found form local Nfcf list into global device list */
-        gNfcDev.devList[gNfcDev.devCnt].type       = RFAL_NFC_LISTEN_TYPE_ST25TB;
-        gNfcDev.devList[gNfcDev.devCnt].dev.st25tb = st25tbDevList[i];
-        gNfcDev.devCnt++;
+      gNfcDev.isOperOngoing = true;
+      return ERR_BUSY;
+    }
+
+    err = rfalSt25tbPollerGetCollisionResolutionStatus();
+    if (err != ERR_BUSY) {
+      gNfcDev.isTechInit = false;
+      gNfcDev.techs2do  &= ~RFAL_NFC_POLL_TECH_ST25TB;
+
+      if ((err == ERR_NONE) && (devCnt != 0U)) {
+        for (i = 0; i < devCnt; i++) {                                          /* Copy devices found form local ST25TB list into global device list */
+          gNfcDev.devList[gNfcDev.devCnt].type       = RFAL_NFC_LISTEN_TYPE_ST25TB;
+          gNfcDev.devList[gNfcDev.devCnt].dev.st25tb = rfalNfcColResBuf.st25tbDevList[i];
+          gNfcDev.devCnt++;
+        }
       }
     }
 
@@ -1391,7 +2614,7 @@ ReturnCode RfalNfcClass::rfalNfcPollActivation(uint8_t devIt)
           if (!gNfcDev.isOperOngoing) {
             /* Perform ISO-DEP (ISO14443-4) activation: RATS and PPS if supported */
             rfalIsoDepInitializeWithParams(gNfcDev.disc.compMode, RFAL_ISODEP_MAX_R_RETRYS, RFAL_ISODEP_MAX_WTX_NACK_RETRYS, RFAL_ISODEP_MAX_WTX_RETRYS, RFAL_ISODEP_MAX_DSL_RETRYS, RFAL_ISODEP_MAX_I_RETRYS, RFAL_ISODEP_RATS_RETRIES);
-            EXIT_ON_ERR(err, rfalIsoDepPollAStartActivation(gNfcDev.disc.isoDepFS, RFAL_ISODEP_NO_DID, gNfcDev.disc.maxBR, &gNfcDev.devList[devIt].proto.isoDep));
+            EXIT_ON_ERR(err, rfalIsoDepPollAStartActivation(gNfcDev.disc.isoDepFS, RFAL_ISODEP_NO_DID, rfalNfcIsoDepActBR(), &gNfcDev.devList[devIt].proto.isoDep));
 
             gNfcDev.isOperOngoing = true;
             return ERR_BUSY;
@@ -1401,6 +2624,7 @@ ReturnCode RfalNfcClass::rfalNfcPollActivation(uint8_t devIt)
           if (err != ERR_NONE) {
             return err;
           }
+          rfalNfcIsoDepStartVhbr(&gNfcDev.devList[devIt].proto.isoDep);
 
           gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_ISODEP; /* NFC-A T4T device activated */
 #else
@@ -1468,7 +2692,7 @@ ReturnCode RfalNfcClass::rfalNfcPollActivation(uint8_t devIt)
         if (!gNfcDev.isOperOngoing) {
           rfalIsoDepInitializeWithParams(gNfcDev.disc.compMode, RFAL_ISODEP_MAX_R_RETRYS, RFAL_ISODEP_MAX_WTX_NACK_RETRYS, RFAL_ISODEP_MAX_WTX_RETRYS, RFAL_ISODEP_MAX_DSL_RETRYS, RFAL_ISODEP_MAX_I_RETRYS, RFAL_ISODEP_RATS_RETRIES);
           /* Perform ISO-DEP (ISO14443-4) activation: ATTRIB    */
-          EXIT_ON_ERR(err, rfalIsoDepPollBStartActivation(gNfcDev.disc.isoDepFS, RFAL_ISODEP_NO_DID, gNfcDev.disc.maxBR, 0x00, &gNfcDev.devList[devIt].dev.nfcb, NULL, 0, &gNfcDev.devList[devIt].proto.isoDep));
+          EXIT_ON_ERR(err, rfalIsoDepPollBStartActivation(gNfcDev.disc.isoDepFS, RFAL_ISODEP_NO_DID, rfalNfcIsoDepActBR(), 0x00, &gNfcDev.devList[devIt].dev.nfcb, NULL, 0, &gNfcDev.devList[devIt].proto.isoDep));
 
           gNfcDev.isOperOngoing = true;
           return ERR_BUSY;
@@ -1478,6 +2702,7 @@ ReturnCode RfalNfcClass::rfalNfcPollActivation(uint8_t devIt)
         if (err != ERR_NONE) {
           return err;
         }
+        rfalNfcIsoDepStartVhbr(&gNfcDev.devList[devIt].proto.isoDep);
 
         gNfcDev.devList[devIt].rfInterface = RFAL_NFC_INTERFACE_ISODEP; /* NFC-B T4T device activated */
         break;
@@ -1635,14 +2860,14 @@ ReturnCode RfalNfcClass::rfalNfcListenActivation(void)
 
       if (isDataRcvd) { /* Check if Reader/Initiator has sent some data */
         /* Check if received data is a Sleep request */
-        if (rfalNfcaListenerIsSleepReq(gNfcDev.rxBuf.rfBuf, rfalConvBitsToBytes(gNfcDev.rxLen))) { /* Check if received data is a SLP_REQ */
+        if (rfalNfcaListenerIsSleepReq(rfalNfcRxBuf.rfBuf, rfalConvBitsToBytes(gNfcDev.rxLen))) { /* Check if received data is a SLP_REQ */
           /* Set the Listen Mode in Sleep state */
-          EXIT_ON_ERR(ret, rfalRfDev->rfalListenSleepStart(RFAL_LM_STATE_SLEEP_A, gNfcDev.rxBuf.rfBuf, sizeof(gNfcDev.rxBuf.rfBuf), &gNfcDev.rxLen));
+          EXIT_ON_ERR(ret, rfalRfDev->rfalListenSleepStart(RFAL_LM_STATE_SLEEP_A, rfalNfcRxBuf.rfBuf, sizeof(rfalNfcRxBuf.rfBuf), &gNfcDev.rxLen));
         }
 
 #if RFAL_FEATURE_ISO_DEP && RFAL_FEATURE_ISO_DEP_LISTEN
         /* Check if received data is a valid RATS */
-        else if (rfalIsoDepIsRats(gNfcDev.rxBuf.rfBuf, (uint8_t)rfalConvBitsToBytes(gNfcDev.rxLen))) {
+        else if (rfalIsoDepIsRats(rfalNfcRxBuf.rfBuf, (uint8_t)rfalConvBitsToBytes(gNfcDev.rxLen))) {
           rfalIsoDepAtsParam atsParam;
           rfalIsoDepListenActvParam rxParam;
 
@@ -1656,7 +2881,7 @@ ReturnCode RfalNfcClass::rfalNfcListenActivation(void)
           atsParam.hbLen = 0;
 
           /* Set Rx parameters */
-          rxParam.rxBuf = (rfalIsoDepBufFormat *)&gNfcDev.rxBuf.isoDepBuf; /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
+          rxParam.rxBuf = (rfalIsoDepBufFormat *)&rfalNfcRxBuf.isoDepBuf; /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
           rxParam.rxLen = &gNfcDev.rxLen;
           rxParam.isoDepDev = &gNfcDev.devList->proto.isoDep;
           rxParam.isRxChaining = &gNfcDev.isRxChaining;
@@ -1665,16 +2890,16 @@ ReturnCode RfalNfcClass::rfalNfcListenActivation(void)
           rfalIsoDepInitialize();                       /* Initialize ISO-DEP layer to handle ISO14443-a activation / RATS */
 
           /* Set ISO-DEP layer to digest RATS and handle activation */
-          EXIT_ON_ERR(ret, rfalIsoDepListenStartActivation(&atsParam, NULL, gNfcDev.rxBuf.rfBuf, gNfcDev.rxLen, rxParam));
+          EXIT_ON_ERR(ret, rfalIsoDepListenStartActivation(&atsParam, NULL, rfalNfcRxBuf.rfBuf, gNfcDev.rxLen, rxParam));
         }
 #endif /* RFAL_FEATURE_ISO_DEP_LISTEN */
 
 #if RFAL_FEATURE_NFC_DEP
 
         /* Check if received data is a valid ATR_REQ */
-        else if (rfalNfcDepIsAtrReq(&gNfcDev.rxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen), gNfcDev.devList->nfcid)) {
+        else if (rfalNfcDepIsAtrReq(&rfalNfcRxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen), gNfcDev.devList->nfcid)) {
           gNfcDev.devList->type = RFAL_NFC_POLL_TYPE_NFCA;
-          EXIT_ON_ERR(ret, rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_PASSIVE, &gNfcDev.rxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen)));
+          EXIT_ON_ERR(ret, rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_PASSIVE, &rfalNfcRxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen)));
         }
 #endif /* RFAL_FEATURE_NFC_DEP */
 
@@ -1709,9 +2934,9 @@ ReturnCode RfalNfcClass::rfalNfcListenActivation(void)
         /* Set the header length in NFC-F */
         hdrLen = RFAL_NFCDEP_LEN_LEN;
 
-        if (rfalNfcDepIsAtrReq(&gNfcDev.rxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen), gNfcDev.devList->nfcid)) {
+        if (rfalNfcDepIsAtrReq(&rfalNfcRxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen), gNfcDev.devList->nfcid)) {
           gNfcDev.devList->type = RFAL_NFC_POLL_TYPE_NFCF;
-          EXIT_ON_ERR(ret, rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_PASSIVE, &gNfcDev.rxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen)));
+          EXIT_ON_ERR(ret, rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_PASSIVE, &rfalNfcRxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen)));
         } else
 #endif /* RFAL_FEATURE_NFC_DEP */
         {
@@ -1753,11 +2978,11 @@ ReturnCode RfalNfcClass::rfalNfcListenActivation(void)
           /* Calculate the header length in NFC-A or NFC-F mode*/
           hdrLen = ((bitRate == RFAL_BR_106) ? (RFAL_NFCDEP_SB_LEN + RFAL_NFCDEP_LEN_LEN) : RFAL_NFCDEP_LEN_LEN);
 
-          if (rfalNfcDepIsAtrReq(&gNfcDev.rxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen), NULL)) {
+          if (rfalNfcDepIsAtrReq(&rfalNfcRxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen), NULL)) {
             gNfcDev.devList->type = RFAL_NFC_POLL_TYPE_AP2P;
             rfalRfDev->rfalSetMode((RFAL_MODE_LISTEN_ACTIVE_P2P), bitRate, bitRate);
             rfalRfDev->rfalSetFDTListen(RFAL_FDT_LISTEN_AP2P_LISTENER);
-            EXIT_ON_ERR(ret, rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_ACTIVE, &gNfcDev.rxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen)));
+            EXIT_ON_ERR(ret, rfalNfcNfcDepActivate(gNfcDev.devList, RFAL_NFCDEP_COMM_ACTIVE, &rfalNfcRxBuf.rfBuf[hdrLen], (rfalConvBitsToBytes(gNfcDev.rxLen) - hdrLen)));
           } else
 #endif /* RFAL_FEATURE_NFC_DEP */
           {
@@ -1828,11 +3053,12 @@ ReturnCode RfalNfcClass::rfalNfcNfcDepActivate(rfalNfcDevice *device, rfalNfcDep
     initParam.BR        = RFAL_NFCDEP_Bx_NO_HIGH_BR;
     initParam.DID       = RFAL_NFCDEP_DID_NO;
     initParam.NAD       = RFAL_NFCDEP_NAD_NO;
-    initParam.LR        = gNfcDev.disc.nfcDepLR;
+    initParam.LR        = (gNfcDev.disc.nfcDepThroughput ? RFAL_NFCDEP_LR_MAX : gNfcDev.disc.nfcDepLR);
     initParam.GB        = gNfcDev.disc.GB;
     initParam.GBLen     = gNfcDev.disc.GBLen;
     initParam.commMode  = commMode;
-    initParam.operParam = (RFAL_NFCDEP_OPER_FULL_MI_EN | RFAL_NFCDEP_OPER_EMPTY_DEP_DIS | RFAL_NFCDEP_OPER_ATN_EN | RFAL_NFCDEP_OPER_RTOX_REQ_EN);
+    initParam.operParam = (RFAL_NFCDEP_OPER_FULL_MI_EN | RFAL_NFCDEP_OPER_EMPTY_DEP_DIS | RFAL_NFCDEP_OPER_ATN_EN | RFAL_NFCDEP_OPER_RTOX_REQ_EN |
+                           (gNfcDev.disc.nfcDepThroughput ? RFAL_NFCDEP_OPER_PSL_MAX_EN : RFAL_NFCDEP_OPER_PSL_MAX_DIS));
 
     rfalNfcDepInitialize();
     /* Perform NFC-DEP (P2P) activation: ATR and PSL if supported */
@@ -1848,7 +3074,7 @@ ReturnCode RfalNfcClass::rfalNfcNfcDepActivate(rfalNfcDevice *device, rfalNfcDep
     targetParam.bst       = RFAL_NFCDEP_Bx_NO_HIGH_BR;
     targetParam.brt       = RFAL_NFCDEP_Bx_NO_HIGH_BR;
     targetParam.to        = RFAL_NFCDEP_WT_TRG_MAX_L13; /* [LLCP] 1.3 6.2.1 */
-    targetParam.ppt       = rfalNfcDepLR2PP(gNfcDev.disc.nfcDepLR);
+    targetParam.ppt       = rfalNfcDepLR2PP((gNfcDev.disc.nfcDepThroughput ? RFAL_NFCDEP_LR_MAX : gNfcDev.disc.nfcDepLR));
     if (gNfcDev.disc.GBLen >= RFAL_NFCDEP_GB_MAX_LEN) {
       return ERR_PARAM;
     }
@@ -1861,7 +3087,7 @@ ReturnCode RfalNfcClass::rfalNfcNfcDepActivate(rfalNfcDevice *device, rfalNfcDep
 
 
     /* Set activation buffer (including header) for NFC-DEP */
-    actvParams.rxBuf        = (rfalNfcDepBufFormat *) &gNfcDev.rxBuf.nfcDepBuf;  /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
+    actvParams.rxBuf        = (rfalNfcDepBufFormat *) &rfalNfcRxBuf.nfcDepBuf;  /*  PRQA S 0310 # MISRA 11.3 - Intentional safe cast to avoiding large buffer duplication */
     actvParams.rxLen        = &gNfcDev.rxLen;
     actvParams.isRxChaining = &gNfcDev.isRxChaining;
     actvParams.nfcDepDev    = &gNfcDev.devList->proto.nfcDep;
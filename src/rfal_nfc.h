@@ -71,13 +71,25 @@
 #include "rfal_rf.h"
 #include "rfal_isoDep.h"
 #include "rfal_nfca.h"
+#include "rfal_t2t.h"
 #include "rfal_nfcb.h"
 #include "rfal_nfcf.h"
 #include "rfal_nfcv.h"
 #include "rfal_st25tb.h"
+#include "rfal_st25xv.h"
 #include "rfal_nfcDep.h"
 #include "rfal_t4t.h"
 
+/*
+******************************************************************************
+* ENABLE SWITCH
+******************************************************************************
+*/
+
+#ifndef RFAL_FEATURE_NFC_SHARED_BUF
+  #define RFAL_FEATURE_NFC_SHARED_BUF   false    /* Shared buffer region configuration missing. Disabled by default */
+#endif
+
 /*
 ******************************************************************************
 * GLOBAL DEFINES
@@ -98,6 +110,26 @@
 #define RFAL_NFC_LISTEN_TECH_F           0x4000U  /*!< Listen NFC-F technology Flag      */
 #define RFAL_NFC_LISTEN_TECH_AP2P        0x8000U  /*!< Listen AP2P technology Flag       */
 
+#define RFAL_NFC_ADAPTIVE_TECHS          6U       /*!< Passive Poll technologies handled by adaptive discovery (A, B, F, V, ST25TB, Prop) */
+#define RFAL_NFC_ADAPTIVE_WINDOW         64U      /*!< Total hits after which adaptive discovery statistics are halved    */
+#define RFAL_NFC_ADAPTIVE_RARE_MIN_HITS  8U       /*!< Total hits required before any technology is backed off            */
+#define RFAL_NFC_ADAPTIVE_RARE_RATIO     16U      /*!< Technology is rare if it got less than 1/ratio of the total hits  */
+#define RFAL_NFC_ADAPTIVE_RARE_PERIOD    4U       /*!< Rare technologies are polled once every period discovery cycles    */
+
+#define RFAL_NFC_PRESENCE_INTERVAL_MIN   50U      /*!< Default shortest interval between presence probes (ms)             */
+#define RFAL_NFC_PRESENCE_INTERVAL_MAX   400U     /*!< Default longest interval between presence probes (ms)              */
+#define RFAL_NFC_PRESENCE_RETRIES        2U       /*!< Probes retried back to back before the device is declared removed */
+#define RFAL_NFC_PRESENCE_BUF_LEN        (RFAL_NFCV_MAX_BLOCK_LEN + 4U) /*!< Probe answer buffer, largest is a NFC-V READ_SINGLE_BLOCK answer */
+
+#define RFAL_NFC_WAKEUP_TRACK_INTERVAL   1000U    /*!< Interval between Wake-Up measurement samples (ms)                  */
+#define RFAL_NFC_WAKEUP_WARMUP_SAMPLES   8U       /*!< Samples taken before the delta is retuned to the measured noise    */
+#define RFAL_NFC_WAKEUP_NOISE_MARGIN     3U       /*!< Delta kept above the mean measurement noise, in noise units        */
+#define RFAL_NFC_WAKEUP_DELTA_MIN        1U       /*!< Lowest delta set by the Wake-Up tracker                            */
+#define RFAL_NFC_WAKEUP_DELTA_MAX        32U      /*!< Highest delta set by the Wake-Up tracker                           */
+#define RFAL_NFC_WAKEUP_BIAS_MAX         8U       /*!< Delta added at most after false wake-ups                           */
+#define RFAL_NFC_WAKEUP_RELAX_TIME       60000U   /*!< Wake-Up mode time without false wake-up to lower the bias (ms)     */
+#define RFAL_NFC_WAKEUP_STABLE_SAMPLES   16U      /*!< Samples without drift before the auto averaging weight is raised   */
+
 
 
 /*
@@ -132,10 +164,13 @@
     ((dp))->nfcDepLR = RFAL_NFCDEP_LR_254;                 \
     ((dp))->GBLen = 0U;                                    \
     ((dp))->p2pNfcaPrio = false;                           \
+    ((dp))->isoDepAdaptiveBR = false;                      \
+    ((dp))->adaptiveDisc = false;                          \
     ((dp))->wakeupEnabled = false;                         \
     ((dp))->wakeupConfigDefault = true;                    \
     ((dp))->wakeupPollBefore = false;                      \
     ((dp))->wakeupNPolls = 1U;                             \
+    ((dp))->wakeupAdaptive = false;                        \
     ((dp))->totalDuration = 1000U;                         \
     ((dp))->techs2Find = RFAL_NFC_TECH_NONE;               \
     ((dp))->techs2Bail = RFAL_NFC_TECH_NONE;               \
@@ -240,6 +275,97 @@ typedef struct {
   rfalNfcPropCallback    rfalNfcpGetActivationStatus;                 /*!< Prorietary NFC Get Activation status callback           */
 } rfalNfcPropCallbacks;
 
+/*! Adaptive discovery statistics of one Poll technology                                        */
+typedef struct {
+  uint16_t                tech;               /*!< Technology flag RFAL_NFC_POLL_TECH_XX           */
+  uint16_t                polls;              /*!< Technology detections performed                 */
+  uint16_t                hits;               /*!< Technology detections with a device found       */
+} rfalNfcTechStats;
+
+/*! Discovery statistics                                                                             */
+typedef struct {
+  rfalNfcTechStats        tech[RFAL_NFC_ADAPTIVE_TECHS]; /*!< Per technology, in default poll order */
+  uint32_t                cycles;             /*!< Poll technology detection cycles performed      */
+  uint32_t                detections;         /*!< Cycles where a device has been detected         */
+  uint32_t                detectTimeSum;      /*!< Accumulated time-to-detect in ms                */
+  uint32_t                meanDetectTime;     /*!< Mean time-to-detect in ms                       */
+} rfalNfcDiscStats;
+
+/*! Presence check statistics                                                                      */
+typedef struct {
+  uint32_t                probes;             /*!< Presence probes sent                            */
+  uint32_t                misses;             /*!< Probes without a valid answer                   */
+  uint32_t                removals;           /*!< Removals reported                               */
+  uint32_t                rfTime;             /*!< Accumulated probe duration in us                */
+  uint32_t                lastLatency;        /*!< Last presence seen to removal report in ms      */
+} rfalNfcPresenceStats;
+
+/*! Callback to report the removal of the active device                                            */
+typedef void (*rfalNfcPresenceCallback)(rfalNfcDevice *dev);
+
+/*! Presence probe steps                                                                          */
+typedef enum {
+  RFAL_NFC_PRESENCE_STEP_PROBE   = 0,         /*!< Probe sent, answer pending                      */
+  RFAL_NFC_PRESENCE_STEP_NFCA_HALT,           /*!< NFC-A: SLP_REQ sent                             */
+  RFAL_NFC_PRESENCE_STEP_NFCA_SELECT,         /*!< NFC-A: ALL_REQ answered, SEL_REQ in progress    */
+} rfalNfcPresenceStep;
+
+/*! Presence check monitor                                                                          */
+typedef struct {
+  bool                    enabled;            /*!< Monitor started                                 */
+  rfalNfcPresenceCallback removedCb;          /*!< Removal callback                                */
+  const rfalNfcDevice     *dev;               /*!< Device being monitored, NULL once removed       */
+  bool                    removed;            /*!< Removal of dev already reported                 */
+  bool                    notSupported;       /*!< dev cannot be probed, not monitored             */
+  uint16_t                minInterval;        /*!< Shortest interval between probes (ms)           */
+  uint16_t                maxInterval;        /*!< Longest interval between probes (ms)            */
+  uint16_t                interval;           /*!< Current interval between probes (ms)            */
+  uint8_t                 misses;             /*!< Consecutive probes without a valid answer       */
+  uint32_t                lastSeen;           /*!< Time the device was last seen present (ms)      */
+  bool                    probing;            /*!< Probe transaction in progress                   */
+  rfalNfcPresenceStep     step;               /*!< Step of the probe transaction                   */
+  uint32_t                probeStart;         /*!< Probe transaction start time (us)               */
+  uint8_t                 devCnt;             /*!< NFC-F devices answering the probe               */
+  uint8_t                 collisions;         /*!< NFC-F collisions on the probe                   */
+  uint16_t                rxLen;              /*!< Probe answer length                             */
+  uint8_t                 rxBuf[RFAL_NFC_PRESENCE_BUF_LEN]; /*!< Probe answer                     */
+  rfalNfcPresenceStats    stats;              /*!< Presence check statistics                       */
+} rfalNfcPresence;
+
+/*! Wake-Up mode statistics                                                                      */
+typedef struct {
+  uint32_t                wakes;              /*!< Wake-ups reported by the RF chip                */
+  uint32_t                falseWakes;         /*!< Wake-ups after which no device was detected     */
+  uint32_t                wuTime;             /*!< Accumulated time in Wake-Up mode in ms          */
+  uint32_t                falseWakeRate;      /*!< False wake-ups per hour of Wake-Up mode         */
+  uint32_t                detectTimeSum;      /*!< Accumulated wake-up to detection time in ms     */
+  uint32_t                meanDetectTime;     /*!< Mean wake-up to detection time in ms            */
+  uint32_t                samples;            /*!< Measurements read while in Wake-Up mode         */
+  uint32_t                retunes;            /*!< Wake-Up mode restarts with a retuned config     */
+} rfalNfcWakeUpStats;
+
+/*! Wake-Up tracking of one measurement channel                                                   */
+typedef struct {
+  int16_t                 drift;              /*!< Mean measurement to reference offset, 1/16 unit */
+  uint16_t                noise;              /*!< Mean deviation around the drift, 1/16 unit      */
+  uint8_t                 samples;            /*!< Samples since the Wake-Up mode (re)start        */
+  uint8_t                 stable;             /*!< Consecutive samples without drift               */
+} rfalNfcWakeUpChannel;
+
+/*! Wake-Up mode tracker                                                                           */
+typedef struct {
+  rfalWakeUpConfig        config;             /*!< Configuration in use, retuned if wakeupAdaptive */
+  rfalNfcWakeUpChannel    indAmp;             /*!< Inductive Amplitude tracking                    */
+  rfalNfcWakeUpChannel    indPha;             /*!< Inductive Phase tracking                        */
+  uint8_t                 bias;               /*!< Delta added after false wake-ups                */
+  bool                    woke;               /*!< Woke, first technology detection pending        */
+  uint32_t                startTime;          /*!< Wake-Up mode (re)start time in ms               */
+  uint32_t                sampleTime;         /*!< Last measurement sample time in ms              */
+  uint32_t                wokeTime;           /*!< Last wake-up time in ms                         */
+  uint32_t                relaxTime;          /*!< Wake-Up mode time of the last bias change in ms */
+  rfalNfcWakeUpStats      stats;              /*!< Wake-Up mode statistics                         */
+} rfalNfcWakeUp;
+
 /*! Discovery parameters                                                                                           */
 typedef struct {
   rfalComplianceMode compMode;                        /*!< Compliance mode to be used                            */
@@ -255,11 +381,14 @@ typedef struct {
   uint8_t                GBLen;                            /*!< Length of the General Bytes                    NCI 2.1  Table 29   */
   rfalBitRate            ap2pBR;                           /*!< Bit rate to poll for AP2P                      NCI 2.1  Table 31   */
   bool                   p2pNfcaPrio;                      /*!< NFC-A P2P (true) or ISO14443-4/T4T (false) priority                */
+  bool                   adaptiveDisc;                     /*!< Poll technologies ordered and backed off by observed hit rate      */
   rfalNfcPropCallbacks   propNfc;                          /*!< Proprietary Technology callbacks                                    */
 
 
   rfalIsoDepFSxI         isoDepFS;                         /*!< ISO-DEP Poller announced maximum frame size   Digital 2.2 Table 60 */
+  bool                   isoDepAdaptiveBR;                 /*!< ISO-DEP Poller steps bit rate down upon poor link quality          */
   uint8_t                nfcDepLR;                         /*!< NFC-DEP Poller & Listener maximum frame size  Digital 2.2 Table 90 */
+  bool                   nfcDepThroughput;                 /*!< NFC-DEP uses the max LR, Poller negotiates max LR and bit rate (PSL) */
 
   rfalLmConfPA           lmConfigPA;                       /*!< Configuration for Passive Listen mode NFC-A                        */
   rfalLmConfPF           lmConfigPF;                       /*!< Configuration for Passive Listen mode NFC-A                        */
@@ -271,6 +400,7 @@ typedef struct {
   rfalWakeUpConfig       wakeupConfig;                     /*!< Wake-Up mode configuration                                         */
   bool                   wakeupPollBefore;                 /*!< Flag to Poll wakeupNPolls times before entering Wake-up            */
   uint16_t               wakeupNPolls;                     /*!< Number of polling cycles before|after entering Wake-up             */
+  bool                   wakeupAdaptive;                   /*!< Retune Wake-up delta and averaging to measured noise and drift     */
 } rfalNfcDiscoverParam;
 
 
@@ -288,6 +418,58 @@ typedef union { /*PRQA S 0750 # MISRA 19.2 - Members of the union will not be us
 } rfalNfcTmpBuffer;
 
 
+/*! Collision Resolution buffer union, only one technology is resolved at a time                                */
+typedef union { /*  PRQA S 0750 # MISRA 19.2 - Members of the union will not be used concurrently, only one technology at a time */
+#if RFAL_FEATURE_NFCA
+  rfalNfcaListenDevice     nfcaDevList[RFAL_NFC_MAX_DEVICES];     /*!< NFC-A devices found during Collision Resolution  */
+#endif /* RFAL_FEATURE_NFCA */
+#if RFAL_FEATURE_NFCB
+  rfalNfcbListenDevice     nfcbDevList[RFAL_NFC_MAX_DEVICES];     /*!< NFC-B devices found during Collision Resolution  */
+#endif /* RFAL_FEATURE_NFCB */
+#if RFAL_FEATURE_NFCF
+  rfalNfcfListenDevice     nfcfDevList[RFAL_NFC_MAX_DEVICES];     /*!< NFC-F devices found during Collision Resolution  */
+#endif /* RFAL_FEATURE_NFCF */
+#if RFAL_FEATURE_NFCV
+  rfalNfcvListenDevice     nfcvDevList[RFAL_NFC_MAX_DEVICES];     /*!< NFC-V devices found during Collision Resolution  */
+#endif /* RFAL_FEATURE_NFCV */
+#if RFAL_FEATURE_ST25TB
+  rfalSt25tbListenDevice   st25tbDevList[RFAL_NFC_MAX_DEVICES];   /*!< ST25TB devices found during Collision Resolution */
+#endif /* RFAL_FEATURE_ST25TB */
+  uint8_t                  rfu;                                   /*!< Keeps the union non empty                        */
+} rfalNfcColResBuffer;
+
+
+#if RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP
+  #define RFAL_NFC_TMP_BUF_LEN        sizeof(rfalNfcTmpBuffer)  /*!< Tmp buffer length within the shared buffer region */
+#else
+  #define RFAL_NFC_TMP_BUF_LEN        0U                        /*!< Tmp buffer length within the shared buffer region */
+#endif /* RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP */
+
+/*! Length of the region given to rfalNfcSetBufferRegion(): Tx buffer (overlapped by the Collision Resolution buffer), Rx buffer and Tmp buffer */
+#define RFAL_NFC_BUF_REGION_LEN       (((sizeof(rfalNfcBuffer) > sizeof(rfalNfcColResBuffer)) ? sizeof(rfalNfcBuffer) : sizeof(rfalNfcColResBuffer)) + \
+                                       sizeof(rfalNfcBuffer) + RFAL_NFC_TMP_BUF_LEN)
+
+
+/*! RFAL NFC memory footprint, in bytes                                                              */
+typedef struct {
+  uint32_t                total;              /*!< Whole RFAL NFC instance                         */
+  uint32_t                nfcDev;             /*!< NFC layer instance, buffers included            */
+  uint32_t                devList;            /*!< Device list                                     */
+  uint32_t                colResBuf;          /*!< Collision Resolution buffer                     */
+  uint32_t                txBuf;              /*!< Tx buffer for Data Exchange                     */
+  uint32_t                rxBuf;              /*!< Rx buffer for Data Exchange                     */
+  uint32_t                tmpBuf;             /*!< Tmp buffer for Data Exchange                    */
+  uint32_t                bufRegion;          /*!< Caller-provided region, 0 if buffers are internal */
+  uint32_t                isoDep;             /*!< ISO-DEP instance                                */
+  uint32_t                nfcb;               /*!< NFC-B instance                                  */
+  uint32_t                st25tb;             /*!< ST25TB instance                                 */
+  uint32_t                nfcDep;             /*!< NFC-DEP instance                                */
+  uint32_t                nfcfGreedyF;        /*!< NFC-F greedy collection                         */
+  uint32_t                t4tListener;        /*!< T4T card emulation instance                     */
+  uint32_t                nfcfListener;       /*!< T3T card emulation instance                     */
+} rfalNfcFootprint;
+
+
 /*! RFAL NFC instance                                                                                */
 typedef struct {
   rfalNfcState            state;              /*!< Main state                                      */
@@ -310,17 +492,42 @@ typedef struct {
   bool                    isTechInit;         /*!< Flag indicating technology has been set         */
   bool                    isOperOngoing;      /*!< Flag indicating operation is ongoing            */
   bool                    isDeactivating;     /*!< Flag indicating deactivation is ongoing         */
+  bool                    isTxBufAcquired;    /*!< Flag indicating the Tx buffer is held by app    */
 
   rfalNfcaSensRes         sensRes;            /*!< SENS_RES during card detection and activation   */
   rfalNfcbSensbRes        sensbRes;           /*!< SENSB_RES during card detection and activation  */
   uint8_t                 sensbResLen;        /*!< SENSB_RES length                                */
 
+#if RFAL_FEATURE_NFC_SHARED_BUF
+  rfalNfcColResBuffer     *colResBuf;         /*!< Collision Resolution buffer, overlaps txBuf     */
+  rfalNfcBuffer           *txBuf;             /*!< Tx buffer for Data Exchange                     */
+  rfalNfcBuffer           *rxBuf;             /*!< Rx buffer for Data Exchange                     */
+#else
+  rfalNfcColResBuffer     colResBuf;          /*!< Collision Resolution buffer                     */
   rfalNfcBuffer           txBuf;              /*!< Tx buffer for Data Exchange                     */
   rfalNfcBuffer           rxBuf;              /*!< Rx buffer for Data Exchange                     */
+#endif /* RFAL_FEATURE_NFC_SHARED_BUF */
   uint16_t                rxLen;              /*!< Length of received data on Data Exchange        */
 
+  rfalNfcDiscStats        discStats;          /*!< Discovery statistics                            */
+  uint8_t                 discOrder[RFAL_NFC_ADAPTIVE_TECHS]; /*!< Adaptive discovery order (stats index) */
+  uint8_t                 discOrderLen;       /*!< Technologies in the adaptive discovery order    */
+  uint8_t                 discOrderIdx;       /*!< Technology currently being detected             */
+  uint32_t                discStartTime;      /*!< Discovery cycle start time                      */
+
+  rfalNfcPresence         presence;           /*!< Presence check monitor                          */
+  rfalNfcWakeUp           wakeup;             /*!< Wake-Up mode tracker                            */
+
+  rfalBitRate             isoDepMaxBR;        /*!< ISO-DEP max bit rate with isoDepAdaptiveBR      */
+  bool                    isoDepStepPending;  /*!< Poor link quality, step down once exchange done */
+  bool                    isoDepStepDown;     /*!< Deactivation to re-activate at a lower bit rate */
+
 #if RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP
+#if RFAL_FEATURE_NFC_SHARED_BUF
+  rfalNfcTmpBuffer        *tmpBuf;            /*!< Tmp buffer for Data Exchange                    */
+#else
   rfalNfcTmpBuffer        tmpBuf;             /*!< Tmp buffer for Data Exchange                    */
+#endif /* RFAL_FEATURE_NFC_SHARED_BUF */
 #endif /* RFAL_FEATURE_NFC_DEP || RFAL_FEATURE_ISO_DEP */
 
 } rfalNfc;
@@ -485,6 +692,50 @@ class RfalNfcClass {
      */
     ReturnCode rfalNfcDataExchangeStart(uint8_t *txData, uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt);
 
+    /*!
+     *****************************************************************************
+     * \brief  RFAL NFC Get Data Exchange Tx Buffer
+     *
+     * Gives the location of the internal Tx buffer of the active interface,
+     * already offset past the ISO-DEP/NFC-DEP prologue, so that the caller can
+     * compose the data in place and send it with rfalNfcDataExchangeCommit()
+     * without any copy.
+     *
+     * \param[out] txBuf        : location where the data shall be composed
+     * \param[out] txBufLen     : size of txBuf (in bytes)
+     *
+     * \warning The buffer is only valid until the next exchange is started.
+     *
+     * \return ERR_WRONG_STATE  : Incorrect state for this operation
+     * \return ERR_BUSY         : A data exchange is ongoing, buffer still in use
+     * \return ERR_PARAM        : Invalid parameters
+     * \return ERR_NONE         : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalNfcDataExchangeGetTxBuffer(uint8_t **txBuf, uint16_t *txBufLen);
+
+    /*!
+     *****************************************************************************
+     * \brief  RFAL NFC Commit Data Exchange
+     *
+     * Starts a data exchange with the data composed in place in the buffer
+     * given by rfalNfcDataExchangeGetTxBuffer(). Behaves as
+     * rfalNfcDataExchangeStart() otherwise.
+     *
+     * \param[in]  txDataLen    : size of the data composed (in bits or bytes - see rfalNfcDataExchangeStart())
+     * \param[out] rxData       : location of the received data after operation is completed
+     * \param[out] rvdLen       : location of the length of the received data
+     * \param[in]  fwt          : FWT to be used in case of RF interface.
+     *                            If ISO-DEP or NFC-DEP interface is used, this will be ignored
+     *
+     * \return ERR_WRONG_STATE  : Incorrect state for this operation
+     * \return ERR_BUSY         : A data exchange is ongoing
+     * \return ERR_NOMEM        : txDataLen exceeds the Tx buffer
+     * \return ERR_NONE         : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalNfcDataExchangeCommit(uint16_t txDataLen, uint8_t **rxData, uint16_t **rvdLen, uint32_t fwt);
+
     /*!
      *****************************************************************************
      * \brief  RFAL NFC Get Data Exchange Status
@@ -529,6 +780,234 @@ class RfalNfcClass {
     */
     ReturnCode rfalNfcDeactivate(rfalNfcDeactivateType deactType);
 
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC ISO-DEP Step Down Bit Rate
+    *
+    * It requests the bit rate of the active ISO-DEP Listen device to be
+    * lowered by one step, e.g. from 848 to 424 kbps.
+    * Bit rates up to 848 kbps can only be set by PPS right after RATS
+    * (ISO14443-4), therefore rfalNfcWorker() deselects the device and
+    * re-activates it with a lower maximum bit rate; VHBR (above 848 kbps)
+    * are then activated again by S(PARAMETERS).
+    *
+    * When the discovery parameter isoDepAdaptiveBR is set the activation
+    * starts at the highest bit rate common to both devices: by PPS up to
+    * 848 kbps and by S(PARAMETERS) above, within maxBR (or the highest
+    * supported by the RF chip with RFAL_BR_KEEP). The step down is then
+    * requested automatically once an exchange is done and
+    * RFAL_ISODEP_LQ_ERR_THRESHOLD transmission errors have been seen within
+    * RFAL_ISODEP_LQ_WINDOW I-Blocks
+    *
+    * \warning A re-activation resets the application context of the Listen
+    *  device (e.g. selected application). Once re-activated the notifyCb is
+    *  called with RFAL_NFC_STATE_ACTIVATED; if it fails the discovery
+    *  continues as upon a failed activation.
+    *
+    * \return ERR_WRONG_STATE  : Incorrect state for this operation
+    *                            No ISO-DEP device activated or exchange ongoing
+    * \return ERR_NOTSUPP      : Already at the lowest bit rate
+    * \return ERR_NONE         : No error, step down started
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcIsoDepStepDownBitRate(void);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Get Discovery Statistics
+    *
+    * Retrieves the discovery statistics: per Poll technology detections and
+    * hits as well as the mean time-to-detect, measured from the start of
+    * the discovery cycle (or wake-up) until a device has been detected.
+    *
+    * When the discovery parameter adaptiveDisc is set these statistics drive
+    * the Poll technology order: the most often seen technologies are polled
+    * first, rarely seen ones are polled only once every
+    * RFAL_NFC_ADAPTIVE_RARE_PERIOD cycles. Adaptive discovery is not applied
+    * in EMVCo compliance mode, and without adaptiveDisc the fixed NFC Forum
+    * order is kept.
+    *
+    * \param[out]  stats : location to place the discovery statistics
+    *
+    * \return ERR_PARAM        : Invalid parameter
+    * \return ERR_NONE         : No error
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcGetDiscoveryStats(rfalNfcDiscStats *stats);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Clear Discovery Statistics
+    *
+    * Clears the discovery statistics, adaptive discovery restarts from the
+    * default Poll technology order
+    *****************************************************************************
+    */
+    void rfalNfcClearDiscoveryStats(void);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Presence Check Start
+    *
+    * Starts monitoring the presence of the activated Poll device. While the
+    * device is activated and no data exchange is ongoing, rfalNfcWorker()
+    * sends the cheapest probe valid for the device:
+    *   - ISO-DEP (NFC-A or NFC-B): R(NAK), answered by an R(ACK)
+    *   - T2T: READ of block 0
+    *   - T1T: RID
+    *   - other NFC-A devices: SLP_REQ then ALL_REQ, answered from HALT state,
+    *     and SEL_REQ with the device NFCID1 to bring it back to ACTIVE state.
+    *     Any proprietary authentication (e.g. MIFARE Classic) is lost
+    *   - NFC-F: SENSF_REQ
+    *   - NFC-V: addressed READ_SINGLE_BLOCK of block 0, an error answer
+    *     counting as present
+    *   - ST25TB: GET_UID
+    *
+    * Probes are Start/GetStatus transactions: rfalNfcWorker() starts the
+    * probe and checks its answer on the following calls, it never waits for
+    * the device. rfalNfcDataExchangeStart() completes a probe in progress
+    * first. Applications driving the activated device through the
+    * technology APIs directly (e.g. the NDEF poller) shall call
+    * rfalNfcPresenceComplete() beforehand.
+    *
+    * The interval starts at minInterval and doubles after each answered probe
+    * up to maxInterval. Successful data exchanges count as probes. A probe
+    * left unanswered is retried at once up to RFAL_NFC_PRESENCE_RETRIES times
+    * before removedCb is called, so a removal is reported at most maxInterval
+    * plus RFAL_NFC_PRESENCE_RETRIES + 1 probe durations after it happened.
+    * The device is not deactivated, this is left to the caller.
+    *
+    * NFC-DEP devices and devices activated in Listen mode are not probed.
+    * No probe is sent while an application exchange is outstanding: Tx
+    * buffer acquired with rfalNfcDataExchangeGetTxBuffer() and not yet
+    * committed, or the remote device chaining its answer.
+    *
+    * \param[in]  minInterval : shortest interval in ms, 0 for RFAL_NFC_PRESENCE_INTERVAL_MIN
+    * \param[in]  maxInterval : longest interval in ms, 0 for RFAL_NFC_PRESENCE_INTERVAL_MAX
+    * \param[in]  removedCb   : callback called once the device has been removed
+    *
+    * \return ERR_PARAM        : Invalid parameter
+    * \return ERR_NONE         : No error
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcPresenceStart(uint16_t minInterval, uint16_t maxInterval, rfalNfcPresenceCallback removedCb);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Presence Check Stop
+    *
+    * Stops the presence check monitor
+    *****************************************************************************
+    */
+    void rfalNfcPresenceStop(void);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Presence Check Complete
+    *
+    * Waits for the answer of the presence probe in progress, if any, and
+    * accounts it. Once this returns the RF is free for the application
+    *****************************************************************************
+    */
+    void rfalNfcPresenceComplete(void);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Get Presence Check Statistics
+    *
+    * Retrieves the number of probes, misses and removals, the overall time
+    * spent on probes and the delay between the last time the device was
+    * seen present and the last removal report
+    *
+    * \param[out]  stats : location to place the presence check statistics
+    *
+    * \return ERR_PARAM        : Invalid parameter
+    * \return ERR_NONE         : No error
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcGetPresenceStats(rfalNfcPresenceStats *stats);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Get Wake-Up Statistics
+    *
+    * Retrieves the Wake-Up mode statistics: wake-ups, false wake-ups (no
+    * device detected by the first technology detection after waking) and
+    * their rate per hour spent in Wake-Up mode, and the mean time from the
+    * wake-up to the detection of a device.
+    *
+    * When the discovery parameter wakeupAdaptive is set along with a
+    * wakeupConfig (wakeupConfigDefault false), rfalNfcWorker() reads the
+    * measurements every RFAL_NFC_WAKEUP_TRACK_INTERVAL while in Wake-Up mode
+    * and tracks, for the enabled inductive amplitude and phase channels, the
+    * drift of the measurements from the reference and the noise around it:
+    *   - the delta follows RFAL_NFC_WAKEUP_NOISE_MARGIN times the noise, plus
+    *     a bias raised on each false wake-up and lowered after
+    *     RFAL_NFC_WAKEUP_RELAX_TIME without one
+    *   - a drift reaching half the delta enables auto averaging or lowers
+    *     its weight so that the reference follows faster, a steady reference
+    *     raises the weight back to filter out noise
+    * A retuned configuration restarts the Wake-Up mode.
+    *
+    * \param[out]  stats : location to place the Wake-Up statistics
+    *
+    * \return ERR_PARAM        : Invalid parameter
+    * \return ERR_NONE         : No error
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcGetWakeUpStats(rfalNfcWakeUpStats *stats);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Clear Wake-Up Statistics
+    *
+    * Clears the Wake-Up mode statistics
+    *****************************************************************************
+    */
+    void rfalNfcClearWakeUpStats(void);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Set Buffer Region
+    *
+    * Places the large RFAL NFC buffers in a caller-provided region of
+    * RFAL_NFC_BUF_REGION_LEN bytes: Tx buffer, Rx buffer and Tmp buffer.
+    * The Collision Resolution device lists are only used while polling
+    * and the Tx buffer only once a device is activated, so both share the
+    * start of the region.
+    *
+    * Only available with RFAL_FEATURE_NFC_SHARED_BUF. Must be called before
+    * rfalNfcDiscover(), the region must stay valid while the RFAL NFC is in
+    * use and may be reused by the caller only in RFAL_NFC_STATE_IDLE.
+    *
+    * \param[in]  region    : word aligned region
+    * \param[in]  regionLen : region length
+    *
+    * \return ERR_DISABLED     : RFAL_FEATURE_NFC_SHARED_BUF disabled
+    * \return ERR_WRONG_STATE  : Incorrect state for this operation
+    * \return ERR_PARAM        : Invalid or misaligned region
+    * \return ERR_NOMEM        : Region shorter than RFAL_NFC_BUF_REGION_LEN
+    * \return ERR_NONE         : No error
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcSetBufferRegion(uint8_t *region, uint32_t regionLen);
+
+    /*!
+    *****************************************************************************
+    * \brief  RFAL NFC Get Footprint
+    *
+    * Retrieves the RAM used by the RFAL NFC instance, broken down per
+    * component. With RFAL_FEATURE_NFC_SHARED_BUF the buffers are not part of
+    * the instance and bufRegion gives the region length they require.
+    *
+    * \param[out]  fp : location to place the footprint
+    *
+    * \return ERR_PARAM        : Invalid parameter
+    * \return ERR_NONE         : No error
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcGetFootprint(rfalNfcFootprint *fp);
+
 
     /*
     ******************************************************************************
@@ -564,6 +1043,31 @@ class RfalNfcClass {
     void rfalIsoDepInitializeWithParams(rfalComplianceMode compMode, uint8_t maxRetriesR, uint8_t maxRetriesSnWTX, uint8_t maxRetriesSWTX, uint8_t maxRetriesSDSL, uint8_t maxRetriesI, uint8_t maxRetriesRATS);
 
 
+    /*!
+     ******************************************************************************
+     * \brief Get ISO-DEP link quality
+     *
+     * Retrieves the number of I-Blocks transmitted and the number of
+     * transmission errors (timeout, CRC, parity, framing) and retransmissions
+     * seen by the Poller since the last activation or clear
+     *
+     *  \param[out] linkQuality : location to place the link quality counters
+     *
+     ******************************************************************************
+     */
+    void rfalIsoDepGetLinkQuality(rfalIsoDepLinkQuality *linkQuality);
+
+
+    /*!
+     ******************************************************************************
+     * \brief Clear ISO-DEP link quality
+     *
+     * Resets the ISO-DEP link quality counters
+     ******************************************************************************
+     */
+    void rfalIsoDepClearLinkQuality(void);
+
+
     /*!
      *****************************************************************************
      *  \brief  FSxI to FSx
@@ -900,6 +1404,52 @@ class RfalNfcClass {
     ReturnCode rfalIsoDepDeselect(void);
 
 
+    /*!
+     *****************************************************************************
+     *  \brief  ISO-DEP Poller Check Presence
+     *
+     *  This function sends an R(NAK) with the current block number and waits
+     *  for the PICC to answer with an R-Block in a blocking way. The block
+     *  number is left untouched so the exchange may continue afterwards
+     *  ISO14443-4  7.5.6.2
+     *
+     *  \return ERR_NONE   : R-Block received, PICC present
+     *  \return ERR_PROTO  : Unexpected answer
+     *  \return ERR_TIMEOUT: No response rcvd from PICC
+     *
+     *****************************************************************************
+     */
+    ReturnCode rfalIsoDepPollerCheckPresence(void);
+
+
+    /*!
+     *****************************************************************************
+     *  \brief  ISO-DEP Poller Start Check Presence
+     *
+     *  This function sends an R(NAK) with the current block number. The answer
+     *  is checked with rfalIsoDepPollerGetCheckPresenceStatus()
+     *
+     *  \return ERR_NONE   : R(NAK) sent
+     *
+     *****************************************************************************
+     */
+    ReturnCode rfalIsoDepPollerStartCheckPresence(void);
+
+
+    /*!
+     *****************************************************************************
+     *  \brief  ISO-DEP Poller Get Check Presence Status
+     *
+     *  \return ERR_BUSY   : Operation ongoing
+     *  \return ERR_NONE   : R-Block received, PICC present
+     *  \return ERR_PROTO  : Unexpected answer
+     *  \return ERR_TIMEOUT: No response rcvd from PICC
+     *
+     *****************************************************************************
+     */
+    ReturnCode rfalIsoDepPollerGetCheckPresenceStatus(void);
+
+
     /*!
      *****************************************************************************
      *  \brief  ISO-DEP Poller Handle NFC-A Activation
@@ -1181,6 +1731,37 @@ class RfalNfcClass {
     ReturnCode rfalNfcaPollerFullCollisionResolution(rfalComplianceMode compMode, uint8_t devLimit, rfalNfcaListenDevice *nfcaDevList, uint8_t *devCnt);
 
 
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A Poller Bulk Collision Resolution
+     *
+     * Inventories a stack of ISO14443A cards, e.g. for counting. Each card is
+     * resolved, selected and put to sleep (SLP_REQ), then a new SENS_REQ is
+     * sent. The first round uses ALL_REQ (WUPA).
+     *
+     * Unlike rfalNfcaPollerSleepFullCollisionResolution() the partial UID tree
+     * is kept across rounds: each collision not followed is remembered, and the
+     * next round resumes the SDD at that bit (re-selecting the previous cascade
+     * levels if needed) instead of restarting from the first UID bit. Up to
+     * RFAL_NFCA_BULK_TREE_DEPTH collisions are remembered; once the tree is
+     * exhausted the resolution restarts from the root until no card answers.
+     *
+     * T1T, which does not support anticollision, are not inventoried.
+     *
+     * \param[out] nfcaDevList : NFC-A listener device info
+     * \param[in]  devListLen  : size of nfcaDevList, not limited by RFAL_NFC_MAX_DEVICES
+     * \param[out] devCnt      : Devices found counter
+     * \param[out] stats       : rounds, SDD frames, duration and cards/s (NULL if not required)
+     *
+     * \return ERR_PARAM        : Invalid parameters
+     * \return ERR_TIMEOUT      : No card detected
+     * \return ERR_NONE         : No error, no more card answers or nfcaDevList is full
+     * \return a transmission error after RFAL_NFCA_BULK_RETRIES failed rounds in a row
+     *****************************************************************************
+     */
+    ReturnCode rfalNfcaPollerBulkCollisionResolution(rfalNfcaListenDevice *nfcaDevList, uint16_t devListLen, uint16_t *devCnt, rfalNfcaBulkStats *stats);
+
+
     /*!
      *****************************************************************************
      * \brief NFC-A Listener is SLP_REQ
@@ -1727,6 +2308,74 @@ class RfalNfcClass {
     */
     ReturnCode rfalNfcDepGetPduTransceiveStatus(void);
 
+
+    /*!
+    *****************************************************************************
+    * \brief Start Stream Transceive
+    *
+    * This method triggers a NFC-DEP Transceive of a PDU of any length without
+    * PDU buffers: the outgoing PDU is transmitted as chained Blocks, each one
+    * composed by param.producer directly in param.txBuf, and the incoming PDU
+    * is handed Block by Block to param.consumer straight from param.rxBuf.
+    * As Target, the outgoing PDU answers the last one received.
+    *
+    * The producer shall fill the whole Block whenever more data follows.
+    * Best throughput is obtained with nfcDepThroughput set on discovery, so
+    * that the largest LR and bit rate of both devices are used.
+    *
+    * \param[in] param: reference parameters to be used for the Transceive
+    *
+    * \return ERR_PARAM       : Bad request
+    * \return ERR_WRONG_STATE : The module is not in a proper state
+    * \return ERR_NONE        : The Transceive request has been started
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcDepStartStream(const rfalNfcDepStreamParam *param);
+
+
+    /*!
+    *****************************************************************************
+    * \brief Return the Stream Transceive status
+    *
+    * Runs the NFC-DEP Stream Transceive, calling the producer for every
+    * acknowledged Block and the consumer for every received Block.
+    * An error returned by either callback aborts the Stream.
+    *
+    * \return ERR_NONE      : Transceive has been completed successfully
+    * \return ERR_BUSY      : Transceive is ongoing
+    * \return ERR_PROTO     : Protocol error occurred
+    * \return ERR_TIMEOUT   : Timeout error occurred
+    * \return ERR_SLEEP_REQ : Deselect has been received and responded
+    * \return ERR_LINK_LOSS : Communication is lost because Reader/Writer
+    *                            has turned off its field
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcDepGetStreamStatus(void);
+
+
+    /*!
+    *****************************************************************************
+    * \brief Get Stream statistics
+    *
+    * Retrieves the payload bytes and Blocks transferred by the completed
+    * Streams, their overall duration and the sustained throughput in kbit/s
+    *
+    * \param[out] stats : location to place the Stream statistics
+    *
+    * \return ERR_PARAM     : Invalid parameter
+    * \return ERR_NONE      : No error
+    *****************************************************************************
+    */
+    ReturnCode rfalNfcDepGetStreamStats(rfalNfcDepStreamStats *stats);
+
+
+    /*!
+    *****************************************************************************
+    * \brief Clear Stream statistics
+    *****************************************************************************
+    */
+    void rfalNfcDepClearStreamStats(void);
+
     /*
     ******************************************************************************
     * RFAL NFC-F FUNCTION PROTOTYPES
@@ -1871,27 +2520,87 @@ class RfalNfcClass {
      * \return ERR_NONE         : No error
      *****************************************************************************
      */
-    ReturnCode rfalNfcfPollerUpdate(const uint8_t *nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *txBuf, uint16_t txBufLen, const uint8_t *blockData, uint8_t *rxBuf, uint16_t rxBufLen);
+    ReturnCode rfalNfcfPollerUpdate(const uint8_t *nfcid2, const rfalNfcfServBlockListParam *servBlock, uint8_t *txBuf, uint16_t txBufLen, const uint8_t *blockData, uint8_t *rxBuf, uint16_t rxBufLen);
+
+    /*!
+     *****************************************************************************
+     * \brief NFC-F Listener is T3T Request
+     *
+     * This method checks if the given data is a valid T3T command (Read or Write)
+     * and in case a valid request has been received it may output the request's NFCID2
+     *
+     * \param[in]   buf : buffer holding Initiator's received command
+     * \param[in]   bufLen : length of received command in bytes
+     * \param[out]  nfcid2 : pointer to where the NFCID2 may be outputted,
+     *                       nfcid2 has NFCF_SENSF_NFCID2_LEN as length
+     *                       Pass NULL if output parameter not desired
+     *
+     * \return true  : Valid T3T command (Read or Write) received
+     * \return false : Invalid protocol request
+     *
+     *****************************************************************************
+     */
+    bool rfalNfcfListenerIsT3TReq(const uint8_t *buf, uint16_t bufLen, uint8_t *nfcid2);
+
+    /*!
+     *****************************************************************************
+     * \brief NFC-F Listener Initialize
+     *
+     * Enables the T3T card emulation engine. Once activated as NFC-F T3T
+     * the engine answers CHECK and UPDATE requests on its own from
+     * rfalNfcWorker(), decoding the Service and Block lists in place from
+     * the received frame and composing the response directly on the Tx buffer.
+     *
+     * The block store is not copied, it shall remain valid until
+     * rfalNfcfListenerDeinitialize() is called. Block 0 holds the Attribute
+     * Information Block, its RWFlag decides whether UPDATE is accepted.
+     *
+     * While the engine is enabled the caller shall not drive the data
+     * exchange of a T3T Poller with rfalNfcDataExchangeStart()
+     *
+     * \param[in]   param : NFCID2 and block store to be served
+     *
+     * \return ERR_PARAM : Invalid parameter
+     * \return ERR_NONE  : No error
+     *
+     *****************************************************************************
+     */
+    ReturnCode rfalNfcfListenerInitialize(const rfalNfcfListenerParam *param);
+
+    /*!
+     *****************************************************************************
+     * \brief NFC-F Listener Deinitialize
+     *
+     * Disables the T3T card emulation engine, T3T exchanges are handed back
+     * to the caller
+     *
+     *****************************************************************************
+     */
+    void rfalNfcfListenerDeinitialize(void);
 
     /*!
      *****************************************************************************
-     * \brief NFC-F Listener is T3T Request
+     * \brief NFC-F Listener Process T3T Request
      *
-     * This method checks if the given data is a valid T3T command (Read or Write)
-     * and in case a valid request has been received it may output the request's NFCID2
+     * Processes a CHECK or UPDATE request (LEN byte included) and composes
+     * the response (LEN byte included) according to NFC Forum T3T.
+     * Multiple Services and Blocks are served within a single frame.
+     * Requests not addressed to the configured NFCID2 or other commands
+     * produce no response (resLen set to 0)
      *
-     * \param[in]   buf : buffer holding Initiator's received command
-     * \param[in]   bufLen : length of received command in bytes
-     * \param[out]  nfcid2 : pointer to where the NFCID2 may be outputted,
-     *                       nfcid2 has NFCF_SENSF_NFCID2_LEN as length
-     *                       Pass NULL if output parameter not desired
+     * \param[in]   req       : received request
+     * \param[in]   reqLen    : request length in bytes
+     * \param[out]  res       : buffer where the response will be placed
+     * \param[in]   resBufLen : response buffer length
+     * \param[out]  resLen    : composed response length in bytes
      *
-     * \return true  : Valid T3T command (Read or Write) received
-     * \return false : Invalid protocol request
+     * \return ERR_WRONG_STATE : T3T Listener not initialized
+     * \return ERR_PARAM       : Invalid parameter
+     * \return ERR_NONE        : No error
      *
      *****************************************************************************
      */
-    bool rfalNfcfListenerIsT3TReq(const uint8_t *buf, uint16_t bufLen, uint8_t *nfcid2);
+    ReturnCode rfalNfcfListenerProcessT3TReq(const uint8_t *req, uint16_t reqLen, uint8_t *res, uint16_t resBufLen, uint16_t *resLen);
 
 
     /*
@@ -2073,6 +2782,42 @@ class RfalNfcClass {
      */
     ReturnCode rfalNfcvPollerReadSingleBlock(uint8_t flags, const uint8_t *uid, uint8_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
 
+    /*!
+     *****************************************************************************
+     * \brief  NFC-V Poller Start Read Single Block
+     *
+     * This method starts reading a block of a NFC-V device. The result is
+     * retrieved with rfalNfcvPollerGetReadSingleBlockStatus()
+     *
+     * \param[in]  flags        : Flags to be used: Sub-carrier; Data_rate; Option
+     *                            for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+     * \param[in]  uid          : UID of the device to be read
+     *                             if not provided Select mode will be used
+     * \param[in]  blockNum     : Number of the block to read
+     * \param[out] rxBuf        : buffer to store response (also with RES_FLAGS), kept until completion
+     * \param[in]  rxBufLen     : length of rxBuf
+     * \param[out] rcvLen       : number of bytes received, kept until completion
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+     * \return ERR_PARAM        : Invalid parameters
+     * \return ERR_NONE         : No error, Read Single Block sent
+     *****************************************************************************
+     */
+    ReturnCode rfalNfcvPollerStartReadSingleBlock(uint8_t flags, const uint8_t *uid, uint8_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
+
+    /*!
+     *****************************************************************************
+     * \brief  NFC-V Poller Get Read Single Block Status
+     *
+     * \return ERR_BUSY         : Operation ongoing
+     * \return ERR_PROTO        : Protocol error detected
+     * \return ERR_REQUEST      : Error response from the device
+     * \return ERR_TIMEOUT      : Timeout error
+     * \return ERR_NONE         : No error, rxBuf and rcvLen updated
+     *****************************************************************************
+     */
+    ReturnCode rfalNfcvPollerGetReadSingleBlockStatus(void);
+
     /*!
      *****************************************************************************
      * \brief  NFC-V Poller Write Single Block
@@ -2622,6 +3367,121 @@ class RfalNfcClass {
     ReturnCode rfalSt25tbPollerWriteBlock(uint8_t blockAddress, const rfalSt25tbBlock *blockData);
 
 
+    /*!
+     *****************************************************************************
+     * \brief  ST25TB Poller Start Read Block
+     *
+     * This method starts reading a block of the ST25TB. The result is
+     * retrieved with rfalSt25tbPollerGetReadBlockStatus()
+     *
+     * \param[in]   blockAddress : address of the block to be read
+     * \param[out]  blockData    : location to place the data read from block
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+     * \return ERR_NONE         : No error, Read Block sent
+     *****************************************************************************
+     */
+    ReturnCode rfalSt25tbPollerStartReadBlock(uint8_t blockAddress, rfalSt25tbBlock *blockData);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  ST25TB Poller Get Read Block Status
+     *
+     * \return ERR_BUSY         : Operation ongoing
+     * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+     * \return ERR_PROTO        : Protocol error detected
+     * \return ERR_NONE         : No error, blockData updated
+     *****************************************************************************
+     */
+    ReturnCode rfalSt25tbPollerGetReadBlockStatus(void);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  ST25TB Poller Start Write Block
+     *
+     * This method starts writing a block of the ST25TB. The programming time
+     * and the read back verification are handled by
+     * rfalSt25tbPollerGetWriteBlockStatus()
+     *
+     * \param[in]  blockAddress : address of the block to be written
+     * \param[in]  blockData    : data to be written on the block
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or incorrect mode
+     * \return ERR_PARAM        : Invalid parameters
+     * \return ERR_NONE         : No error, Write Block sent
+     *****************************************************************************
+     */
+    ReturnCode rfalSt25tbPollerStartWriteBlock(uint8_t blockAddress, const rfalSt25tbBlock *blockData);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  ST25TB Poller Get Write Block Status
+     *
+     * \return ERR_BUSY         : Operation ongoing
+     * \return ERR_TIMEOUT      : Timeout error on the read back
+     * \return ERR_PROTO        : Unexpected answer or data read back differs
+     * \return ERR_NONE         : No error, block written and verified
+     *****************************************************************************
+     */
+    ReturnCode rfalSt25tbPollerGetWriteBlockStatus(void);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  ST25TB Poller Read Blocks
+     *
+     * Convenience wrapper reading consecutive blocks of the ST25TB, e.g. the
+     * whole user memory with firstBlock 0 and 16 (ST25TB512) or 128 (ST25TB04K)
+     * blocks. It runs one blocking Read Block per block, the ST25TB has no
+     * multiple block command and answers one command at a time, so it takes
+     * as long as the single block reads. Each response is placed directly in
+     * buf. A block is read again up to RFAL_ST25TB_BATCH_RETRIES times on
+     * transmission errors.
+     *
+     * \param[in]  firstBlock : address of the first block
+     * \param[in]  numBlocks  : number of blocks to be read
+     * \param[out] buf        : location to place the memory image
+     * \param[in]  bufLen     : length of buf, at least numBlocks * RFAL_ST25TB_BLOCK_LEN
+     * \param[out] stats      : blocks read, retries and end-to-end time (NULL if not required)
+     *
+     * \return ERR_PARAM        : Invalid parameters
+     * \return ERR_TIMEOUT      : Timeout error, no listener device detected
+     * \return ERR_PROTO        : Protocol error detected
+     * \return ERR_NONE         : No error, all blocks read
+     *****************************************************************************
+     */
+    ReturnCode rfalSt25tbPollerReadBlocks(uint8_t firstBlock, uint16_t numBlocks, uint8_t *buf, uint16_t bufLen, rfalSt25tbBatchStats *stats);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  ST25TB Poller Write Blocks
+     *
+     * Convenience wrapper writing consecutive blocks of the ST25TB with one
+     * blocking Write Block per block. Each Write Block only waits the
+     * programming time tW before the next one is sent. Unless a transmission
+     * error occurred on a block, the read back is done once all blocks are
+     * written, if requested, with one blocking Read Block per block.
+     *
+     * \param[in]  firstBlock : address of the first block
+     * \param[in]  numBlocks  : number of blocks to be written
+     * \param[in]  data       : data to be written
+     * \param[in]  dataLen    : length of data, at least numBlocks * RFAL_ST25TB_BLOCK_LEN
+     * \param[in]  verify     : read back and compare all blocks once written
+     * \param[out] stats      : blocks written, retries and end-to-end time (NULL if not required)
+     *
+     * \return ERR_PARAM        : Invalid parameters
+     * \return ERR_TIMEOUT      : Timeout error on a read back
+     * \return ERR_PROTO        : Unexpected answer or data read back differs
+     * \return ERR_NONE         : No error, all blocks written
+     *****************************************************************************
+     */
+    ReturnCode rfalSt25tbPollerWriteBlocks(uint8_t firstBlock, uint16_t numBlocks, const uint8_t *data, uint16_t dataLen, bool verify, rfalSt25tbBatchStats *stats);
+
+
     /*!
      *****************************************************************************
      * \brief  ST25TB Poller Completion
@@ -3309,6 +4169,77 @@ class RfalNfcClass {
      */
     ReturnCode rfalST25xVPollerFastWriteMessage(uint8_t flags, const uint8_t *uid, uint8_t msgLen, const uint8_t *msgData, uint8_t *txBuf, uint16_t txBufLen);
 
+    /*!
+     *****************************************************************************
+     * \brief  NFC-V Poller ST25DV Mailbox Stream Write
+     *
+     * Streams a buffer to the host of an ST25DV through the Fast Transfer Mode
+     * Mailbox. The data is split in messages of up to RFAL_ST25DV_MB_LEN bytes,
+     * the first one starting with a RFAL_ST25DV_MB_STREAM_HDR_LEN bytes header
+     * holding the total data length (Big Endian).
+     * Before each message MB_CTRL_Dyn is polled (Fast Read Dynamic Configuration)
+     * and the next message is written (Fast Write Message) as soon as the host
+     * has read the previous one.
+     * The Mailbox must have been enabled (MB_MODE and MB_EN_Dyn).
+     *
+     * \param[in]  flags          : Flags to be used: Sub-carrier; Data_rate; Option
+     *                              for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+     * \param[in]  uid            : UID of the device to be put to be read
+     *                               if not provided Select mode will be used
+     * \param[in]  data           : data to be streamed
+     * \param[in]  dataLen        : length of data
+     * \param[in]  timeout        : max time (ms) to wait for the host to read a message
+     *                              e.g. RFAL_ST25DV_MB_STREAM_TIMEOUT
+     * \param[out] stats          : transfer statistics (NULL if not required)
+     *
+     * \return ERR_PARAM          : Invalid parameters
+     * \return ERR_DISABLED       : Mailbox not enabled
+     * \return ERR_TIMEOUT        : Host did not read a message in time or no response
+     * \return ERR_CRC            : CRC error detected
+     * \return ERR_FRAMING        : Framing error detected
+     * \return ERR_PROTO          : Protocol error detected
+     * \return ERR_NONE           : No error, all data written
+     *****************************************************************************
+     */
+    ReturnCode rfalST25xVPollerMbStreamWrite(uint8_t flags, const uint8_t *uid, const uint8_t *data, uint32_t dataLen, uint16_t timeout, rfalST25xVMbStreamStats *stats);
+
+    /*!
+     *****************************************************************************
+     * \brief  NFC-V Poller ST25DV Mailbox Stream Read
+     *
+     * Receives a stream put by the host of an ST25DV through the Fast Transfer
+     * Mode Mailbox. MB_CTRL_Dyn is polled (Fast Read Dynamic Configuration)
+     * until a message is available which is then read at once (Fast Read Message).
+     * The first message starts with a RFAL_ST25DV_MB_STREAM_HDR_LEN bytes header
+     * holding the total data length (Big Endian) and reception ends once that
+     * length has been received. A host not knowing the length in advance sets
+     * it to RFAL_ST25DV_MB_STREAM_LEN_UNKNOWN, reception then ends on a message
+     * shorter than RFAL_ST25DV_MB_LEN or when no message follows a full one
+     * within timeout.
+     *
+     * \param[in]  flags          : Flags to be used: Sub-carrier; Data_rate; Option
+     *                              for NFC-Forum use: RFAL_NFCV_REQ_FLAG_DEFAULT
+     * \param[in]  uid            : UID of the device to be put to be read
+     *                               if not provided Select mode will be used
+     * \param[out] buf            : buffer to place the received data
+     * \param[in]  bufLen         : length of buf
+     * \param[out] rcvdLen        : number of bytes received
+     * \param[in]  timeout        : max time (ms) to wait for the host to put a message
+     *                              e.g. RFAL_ST25DV_MB_STREAM_TIMEOUT
+     * \param[out] stats          : transfer statistics (NULL if not required)
+     *
+     * \return ERR_PARAM          : Invalid parameters
+     * \return ERR_DISABLED       : Mailbox not enabled
+     * \return ERR_NOMEM          : Message did not fit, data truncated to bufLen
+     * \return ERR_TIMEOUT        : Host did not put a message in time or no response
+     * \return ERR_CRC            : CRC error detected
+     * \return ERR_FRAMING        : Framing error detected
+     * \return ERR_PROTO          : Protocol error detected, no stream header
+     * \return ERR_NONE           : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalST25xVPollerMbStreamRead(uint8_t flags, const uint8_t *uid, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen, uint16_t timeout, rfalST25xVMbStreamStats *stats);
+
 
     /*
     ******************************************************************************
@@ -3348,6 +4279,35 @@ class RfalNfcClass {
     ReturnCode rfalT1TPollerRid(rfalT1TRidRes *ridRes);
 
 
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T1T Poller Start RID
+     *
+     * This method starts reading the UID of a NFC-A T1T Listener device. The
+     * result is retrieved with rfalT1TPollerGetRidStatus()
+     *
+     * \param[out]  ridRes : location to place the RID_RES
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+     * \return ERR_PARAM        : Invalid parameter
+     * \return ERR_NONE         : No error, RID sent
+     *****************************************************************************
+     */
+    ReturnCode rfalT1TPollerStartRid(rfalT1TRidRes *ridRes);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T1T Poller Get RID Status
+     *
+     * \return ERR_BUSY         : Operation ongoing
+     * \return ERR_PROTO        : Protocol error
+     * \return ERR_NONE         : No error, ridRes updated
+     *****************************************************************************
+     */
+    ReturnCode rfalT1TPollerGetRidStatus(void);
+
+
     /*!
      *****************************************************************************
      * \brief  NFC-A T1T Poller RALL
@@ -3387,6 +4347,93 @@ class RfalNfcClass {
     ReturnCode rfalT1TPollerWrite(const uint8_t *uid, uint8_t address, uint8_t data);
 
 
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T1T Poller RSEG
+     *
+     * This method reads a whole segment (16 blocks, 128 bytes) of a dynamic
+     * memory NFC-A T1T Listener device in one frame.
+     * The response is ADDS followed by the segment data.
+     *
+     *
+     * \param[in]   uid       : the UID of the device to read data
+     * \param[in]   segment   : segment number (0 - 15)
+     * \param[out]  rxBuf     : pointer to place the read data
+     * \param[in]   rxBufLen  : size of rxBuf
+     * \param[out]  rxRcvdLen : actual received data
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+     * \return ERR_PARAM        : Invalid parameter
+     * \return ERR_NONE         : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalT1TPollerRseg(const uint8_t *uid, uint8_t segment, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rxRcvdLen);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T1T Poller READ8
+     *
+     * This method reads one block (8 bytes) of a dynamic memory NFC-A T1T
+     * Listener device
+     *
+     *
+     * \param[in]   uid       : the UID of the device to read data
+     * \param[in]   block     : block number
+     * \param[out]  data      : pointer to place the RFAL_T1T_BLOCK_LEN bytes read
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+     * \return ERR_PARAM        : Invalid parameter
+     * \return ERR_PROTO        : Unexpected response
+     * \return ERR_NONE         : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalT1TPollerRead8(const uint8_t *uid, uint8_t block, uint8_t *data);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T1T Poller WRITE-E8
+     *
+     * This method erases and writes one block (8 bytes) of a dynamic memory
+     * NFC-A T1T Listener device
+     *
+     *
+     * \param[in]   uid       : the UID of the device to write data
+     * \param[in]   block     : block number
+     * \param[in]   data      : the RFAL_T1T_BLOCK_LEN bytes to be written
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+     * \return ERR_PARAM        : Invalid parameter
+     * \return ERR_PROTO        : Unexpected response
+     * \return ERR_NONE         : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalT1TPollerWriteE8(const uint8_t *uid, uint8_t block, const uint8_t *data);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T1T Poller WRITE-NE8
+     *
+     * This method writes one block (8 bytes) of a dynamic memory NFC-A T1T
+     * Listener device without erasing it: bits already set remain set (e.g.
+     * lock bits). Faster than WRITE-E8.
+     *
+     *
+     * \param[in]   uid       : the UID of the device to write data
+     * \param[in]   block     : block number
+     * \param[in]   data      : the RFAL_T1T_BLOCK_LEN bytes to be written
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+     * \return ERR_PARAM        : Invalid parameter
+     * \return ERR_PROTO        : Unexpected response
+     * \return ERR_NONE         : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalT1TPollerWriteNE8(const uint8_t *uid, uint8_t block, const uint8_t *data);
+
+
     /*
     ******************************************************************************
     * RFAL T2T FUNCTION PROTOTYPES
@@ -3415,6 +4462,38 @@ class RfalNfcClass {
     ReturnCode rfalT2TPollerRead(uint8_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
 
 
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T2T Poller Start Read
+     *
+     * This method starts a Read command to a NFC-A T2T Listener device. The
+     * result is retrieved with rfalT2TPollerGetReadStatus()
+     *
+     * \param[in]   blockNum    : Number of the block to read
+     * \param[out]  rxBuf       : location to place the read data, kept until completion
+     * \param[in]   rxBufLen    : size of rxBuf (RFAL_T2T_READ_DATA_LEN)
+     * \param[out]  rcvLen      : actual received data, kept until completion
+     *
+     * \return ERR_WRONG_STATE  : RFAL not initialized or mode not set
+     * \return ERR_PARAM        : Invalid parameter
+     * \return ERR_NONE         : No error, Read sent
+     *****************************************************************************
+     */
+    ReturnCode rfalT2TPollerStartRead(uint8_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
+
+
+    /*!
+     *****************************************************************************
+     * \brief  NFC-A T2T Poller Get Read Status
+     *
+     * \return ERR_BUSY         : Operation ongoing
+     * \return ERR_PROTO        : Protocol error, NACK received
+     * \return ERR_NONE         : No error, rxBuf and rcvLen updated
+     *****************************************************************************
+     */
+    ReturnCode rfalT2TPollerGetReadStatus(void);
+
+
     /*!
      *****************************************************************************
      * \brief  NFC-A T2T Poller Write
@@ -3671,6 +4750,62 @@ class RfalNfcClass {
      */
     ReturnCode rfalT4TPollerComposeWriteDataODO(rfalIsoDepApduBufFormat *cApduBuf, uint32_t offset, const uint8_t *data, uint8_t dataLen, uint16_t *cApduLen);
 
+    /*!
+     *****************************************************************************
+     * \brief  T4T Listener Initialize
+     *
+     * Enables the T4T card emulation engine. Once an ISO-DEP Listen activation
+     * takes place the engine answers the NDEF Tag Application Select, the
+     * CC and NDEF file Select, ReadBinary and UpdateBinary commands on its own
+     * from rfalNfcWorker(), within the FWT and without any caller involvement.
+     *
+     * The files are served directly from the given buffers, which are not
+     * copied and may reside in flash. They shall remain valid until
+     * rfalT4TListenerDeinitialize() is called.
+     * UpdateBinary is only accepted if ndefFileWr is provided and the
+     * CC NDEF File Control TLV grants write access.
+     *
+     * While the engine is enabled the caller shall not drive the data
+     * exchange of an ISO-DEP Poller with rfalNfcDataExchangeStart()
+     *
+     * \param[in]      param    : CC and NDEF files to be served
+     *
+     * \return ERR_PARAM        : Invalid parameter or malformed CC
+     * \return ERR_NONE         : No error
+     *****************************************************************************
+     */
+    ReturnCode rfalT4TListenerInitialize(const rfalT4tListenerParam *param);
+
+    /*!
+     *****************************************************************************
+     * \brief  T4T Listener Deinitialize
+     *
+     * Disables the T4T card emulation engine, ISO-DEP exchanges are handed
+     * back to the caller
+     *****************************************************************************
+     */
+    void rfalT4TListenerDeinitialize(void);
+
+    /*!
+     *****************************************************************************
+     * \brief  T4T Listener Process C-APDU
+     *
+     * Processes a C-APDU addressed to the emulated T4T and composes the
+     * R-APDU (response data followed by SW1 SW2) according to NFC Forum T4T
+     *
+     * \param[in]      cApdu       : received C-APDU
+     * \param[in]      cApduLen    : C-APDU length
+     * \param[out]     rApdu       : buffer where the R-APDU will be placed
+     * \param[in]      rApduBufLen : R-APDU buffer length
+     * \param[out]     rApduLen    : composed R-APDU length
+     *
+     * \return ERR_WRONG_STATE  : T4T Listener not initialized
+     * \return ERR_PARAM        : Invalid parameter
+     * \return ERR_NONE         : No error, R-APDU composed
+     *****************************************************************************
+     */
+    ReturnCode rfalT4TListenerProcessCApdu(const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu, uint16_t rApduBufLen, uint16_t *rApduLen);
+
     /*!
     *****************************************************************************
     * \brief  NFC-V Poller Write Password
@@ -3799,10 +4934,26 @@ class RfalNfcClass {
     ReturnCode rfalNfcfPollerStartCheckPresence(void);
     ReturnCode rfalNfcfPollerGetCheckPresenceStatus(void);
     ReturnCode rfalNfcPollTechDetection(void);
+    void rfalNfcAdaptiveDiscStart(void);
+    ReturnCode rfalNfcAdaptiveTechDetection(void);
+    ReturnCode rfalNfcPresenceProbeStart(const rfalNfcDevice *dev);
+    ReturnCode rfalNfcPresenceProbeGetStatus(const rfalNfcDevice *dev);
+    void rfalNfcPresenceProbeDone(ReturnCode ret);
+    void rfalNfcPresenceWorker(void);
+    ReturnCode rfalNfcWakeUpStart(void);
+    void rfalNfcWakeUpTrack(void);
+    bool rfalNfcWakeUpTuneChannel(rfalWumMeasChannel *ch, rfalNfcWakeUpChannel *trk, uint8_t lastMeas, uint8_t reference);
+    void rfalNfcWakeUpDetected(bool found);
     ReturnCode rfalNfcPollCollResolution(void);
     ReturnCode rfalNfcPollActivation(uint8_t devIt);
     ReturnCode rfalNfcDeactivation(void);
     ReturnCode rfalNfcNfcDepActivate(rfalNfcDevice *device, rfalNfcDepCommMode commMode, const uint8_t *atrReq, uint16_t atrReqLen);
+    void rfalNfcIsoDepCheckLinkQuality(void);
+    void rfalNfcIsoDepStartVhbr(rfalIsoDepDevice *isoDepDev);
+    bool rfalNfcT4tListenerIsActive(void);
+    ReturnCode rfalNfcT4tListenerRespond(void);
+    bool rfalNfcT3tListenerIsActive(void);
+    ReturnCode rfalNfcT3tListenerRespond(void);
     void isoDepClearCounters(void);
     ReturnCode isoDepTx(uint8_t pcb, const uint8_t *txBuf, uint8_t *infBuf, uint16_t infLen, uint32_t fwt);
     ReturnCode isoDepHandleControlMsg(rfalIsoDepControlMsg controlMsg, uint8_t param);
@@ -3844,6 +4995,7 @@ class RfalNfcClass {
     ReturnCode rfalNfcbPollerStartSlottedCollisionResolution(rfalComplianceMode compMode, uint8_t devLimit, rfalNfcbSlots initSlots, rfalNfcbSlots endSlots, rfalNfcbListenDevice *nfcbDevList, uint8_t *devCnt, bool *colPending);
     ReturnCode rfalNfcaPollerGetSleepStatus(void);
     ReturnCode rfalNfcaPollerSleepFullCollisionResolution(uint8_t devLimit, rfalNfcaListenDevice *nfcaDevList, uint8_t *devCnt);
+    ReturnCode rfalNfcaPollerBulkResolveCard(rfalNfcaListenDevice *nfcaDev, rfalNfcaBulkStats *stats);
     bool nfcipDxIsSupported(uint8_t Dx, uint8_t BRx, uint8_t BSx);
     ReturnCode nfcipTxRx(rfalNfcDepCmd cmd, uint8_t *txBuf, uint32_t fwt, uint8_t *paylBuf, uint8_t paylBufLen, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rxActLen);
     ReturnCode nfcipTx(rfalNfcDepCmd cmd, uint8_t *txBuf, uint8_t *paylBuf, uint16_t paylLen, uint8_t pfbData, uint32_t fwt);
@@ -3859,24 +5011,57 @@ class RfalNfcClass {
     ReturnCode nfcipDataRx(bool blocking);
     void rfalNfcfComputeValidSENF(rfalNfcfListenDevice *outDevInfo, uint8_t *curDevIdx, uint8_t devLimit, bool overwrite, bool *nfcDepFound);
     ReturnCode rfalNfcvParseError(uint8_t err);
-    bool rfalSt25tbPollerDoCollisionResolution(uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt);
+    ReturnCode rfalT1TPollerWriteBlock(const uint8_t *uid, uint8_t block, const uint8_t *data, bool erase);
+    ReturnCode rfalSt25tbPollerStartTxRx(const uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxData, uint16_t rxDataLen, uint32_t fwt);
+    ReturnCode rfalSt25tbPollerGetTxRxStatus(void);
+    void rfalSt25tbPollerNextSlot(void);
+    void rfalSt25tbPollerBatchStats(rfalSt25tbBatchStats *stats, uint32_t startTime);
+    ReturnCode rfalSt25tbPollerBatchReadBlock(uint8_t blockAddress, uint8_t *blockData, rfalSt25tbBatchStats *stats);
+    ReturnCode rfalSt25tbPollerBatchWriteBlock(uint8_t blockAddress, const uint8_t *blockData, rfalSt25tbBatchStats *stats);
+    ReturnCode rfalSt25tbPollerStartCheckPresence(uint8_t *chipId);
+    ReturnCode rfalSt25tbPollerGetCheckPresenceStatus(void);
+    ReturnCode rfalSt25tbPollerStartInitiate(uint8_t *chipId);
+    ReturnCode rfalSt25tbPollerGetInitiateStatus(void);
+    ReturnCode rfalSt25tbPollerStartPcall(uint8_t *chipId);
+    ReturnCode rfalSt25tbPollerGetPcallStatus(void);
+    ReturnCode rfalSt25tbPollerStartSlotMarker(uint8_t slotNum, uint8_t *chipIdRes);
+    ReturnCode rfalSt25tbPollerGetSlotMarkerStatus(void);
+    ReturnCode rfalSt25tbPollerStartSelect(uint8_t chipId);
+    ReturnCode rfalSt25tbPollerGetSelectStatus(void);
+    ReturnCode rfalSt25tbPollerStartGetUID(rfalSt25tbUID *UID);
+    ReturnCode rfalSt25tbPollerGetUIDStatus(void);
+    ReturnCode rfalSt25tbPollerStartCollisionResolution(uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt);
+    ReturnCode rfalSt25tbPollerGetCollisionResolutionStatus(void);
+    ReturnCode rfalSt25tbPollerStartCompletion(void);
+    ReturnCode rfalSt25tbPollerGetCompletionStatus(void);
+    ReturnCode rfalSt25tbPollerStartResetToInventory(void);
+    ReturnCode rfalSt25tbPollerGetResetToInventoryStatus(void);
     ReturnCode rfalST25xVPollerGenericReadConfiguration(uint8_t cmd, uint8_t flags, const uint8_t *uid, uint8_t pointer, uint8_t *regValue);
     ReturnCode rfalST25xVPollerGenericWriteConfiguration(uint8_t cmd, uint8_t flags, const uint8_t *uid, uint8_t pointer, uint8_t regValue);
     ReturnCode rfalST25xVPollerGenericReadMessageLength(uint8_t cmd, uint8_t flags, const uint8_t *uid, uint8_t *msgLen);
     ReturnCode rfalST25xVPollerGenericReadMessage(uint8_t cmd, uint8_t flags, const uint8_t *uid, uint8_t mbPointer, uint8_t numBytes, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen);
     ReturnCode rfalST25xVPollerGenericWriteMessage(uint8_t cmd, uint8_t flags, const uint8_t *uid, uint8_t msgLen, const uint8_t *msgData, uint8_t *txBuf, uint16_t txBufLen);
+    ReturnCode rfalST25xVPollerMbWaitStatus(uint8_t flags, const uint8_t *uid, uint8_t mask, uint8_t value, uint16_t timeout, uint16_t *polls);
+    void rfalST25xVPollerMbStreamStats(rfalST25xVMbStreamStats *stats, uint32_t startTime);
     uint32_t timerCalculateTimer(uint16_t time);
     bool timerIsExpired(uint32_t timer);
     ReturnCode rfalNfcListenActivation(void);
     void rfalNfcDepPdu2BLockParam(rfalNfcDepPduTxRxParam pduParam, rfalNfcDepTxRxParam *blockParam, uint16_t txPos, uint16_t rxPos);
+    ReturnCode rfalNfcDepStreamNextBlock(void);
 
     RfalRfClass *rfalRfDev;
 
     rfalNfc gNfcDev;
     rfalIsoDep gIsoDep;    /*!< ISO-DEP Module instance               */
     rfalNfcb gRfalNfcb; /*!< RFAL NFC-B Instance */
+    rfalSt25tb gRfalSt25tb; /*!< RFAL ST25TB Instance */
+    rfalT1T gRfalT1T;       /*!< RFAL T1T Instance */
+    rfalT2T gRfalT2T;       /*!< RFAL T2T Instance */
+    rfalNfcv gRfalNfcv;     /*!< RFAL NFC-V Instance */
     rfalNfcDep gNfcip;                    /*!< NFCIP module instance                         */
     rfalNfcfGreedyF gRfalNfcfGreedyF;   /*!< Activity's NFCF Greedy collection */
+    rfalT4tListener gT4tListener;       /*!< T4T card emulation instance */
+    rfalNfcfListener gNfcfListener;     /*!< T3T card emulation instance */
 
 };
 
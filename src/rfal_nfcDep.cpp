@@ -1870,6 +1870,7 @@ ReturnCode RfalNfcClass::rfalNfcDepInitiatorHandleActivation(rfalNfcDepAtrParam
   uint8_t    PSL_BRS;
   uint8_t    PSL_FSL;
   bool       sendPSL;
+  rfalBitRate PSL_BR;
 
   if ((param == NULL) || (nfcDepDev == NULL)) {
     return ERR_PARAM;
@@ -1915,6 +1916,7 @@ ReturnCode RfalNfcClass::rfalNfcDepInitiatorHandleActivation(rfalNfcDepAtrParam
   /* Check if a PSL needs to be sent                                                */
   /*******************************************************************************/
   sendPSL = false;
+  PSL_BR  = nfcDepDev->info.DSI;                      /* Keep current bit rate                            */
   PSL_BRS = rfalNfcDepDx2BRS(nfcDepDev->info.DSI);    /* Set current bit rate divisor on both directions  */
   PSL_FSL = nfcDepDev->info.LR;                       /* Set current Frame Size                           */
 
@@ -1946,6 +1948,32 @@ ReturnCode RfalNfcClass::rfalNfcDepInitiatorHandleActivation(rfalNfcDepAtrParam
 #endif
 
 
+  /*******************************************************************************/
+  /* Throughput mode: largest Frame Size and bit rate supported by both devices  */
+  /*******************************************************************************/
+  if ((param->operParam & RFAL_NFCDEP_OPER_PSL_MAX_EN) != 0U) {
+    if (gNfcip.cfg.lr != nfcDepDev->info.LR) {     /* Align both directions on the smallest LR */
+      sendPSL = true;
+
+      nfcDepDev->info.LR = MIN(nfcDepDev->info.LR, gNfcip.cfg.lr);
+      nfcDepDev->info.FS = rfalNfcDepLR2FS(nfcDepDev->info.LR);
+
+      gNfcip.cfg.lr = nfcDepDev->info.LR;
+      gNfcip.fsc    = nfcDepDev->info.FS;
+
+      PSL_FSL       = gNfcip.cfg.lr;
+
+      nfcipLogI(" NFCIP(I) Frame Size differ, PSL new fsc: %d \r\n", gNfcip.fsc);
+    }
+
+    if (desiredBR != RFAL_BR_KEEP) {               /* Step down to the highest bit rate supported by the Target */
+      while ((desiredBR > nfcDepDev->info.DSI) && (!nfcipDxIsSupported((uint8_t)desiredBR, nfcDepDev->activation.Target.ATR_RES.BRt, nfcDepDev->activation.Target.ATR_RES.BSt))) {
+        desiredBR = (rfalBitRate)((uint8_t)desiredBR - 1U);
+      }
+    }
+  }
+
+
   /*******************************************************************************/
   /* Check Baud rates                                                            */
   /*******************************************************************************/
@@ -1954,6 +1982,7 @@ ReturnCode RfalNfcClass::rfalNfcDepInitiatorHandleActivation(rfalNfcDepAtrParam
       /* if desired BR is supported     */
       /* MISRA 13.5 */
       sendPSL = true;
+      PSL_BR  = desiredBR;
       PSL_BRS = rfalNfcDepDx2BRS(desiredBR);
 
       nfcipLogI(" NFCIP(I) BR differ, PSL BR: 0x%02X \r\n", PSL_BRS);
@@ -1972,19 +2001,19 @@ ReturnCode RfalNfcClass::rfalNfcDepInitiatorHandleActivation(rfalNfcDepAtrParam
     EXIT_ON_ERR(ret, rfalNfcDepPSL(PSL_BRS, PSL_FSL));
 
     /* Check if bit rate has been changed */
-    if (nfcDepDev->info.DSI != desiredBR) {
+    if (nfcDepDev->info.DSI != PSL_BR) {
       /* Check if device was in Passive NFC-A and went to higher bit rates, use NFC-F */
       if ((nfcDepDev->info.DSI == RFAL_BR_106) && (gNfcip.cfg.commMode == RFAL_NFCDEP_COMM_PASSIVE)) {
 #if RFAL_FEATURE_NFCF
         /* If Passive initialize NFC-F module */
-        rfalNfcfPollerInitialize(desiredBR);
+        rfalNfcfPollerInitialize(PSL_BR);
 #else /* RFAL_FEATURE_NFCF */
         return ERR_NOTSUPP;
 #endif /* RFAL_FEATURE_NFCF */
       }
 
-      nfcDepDev->info.DRI  = desiredBR;  /* DSI Bit Rate coding from Initiator  to Target  */
-      nfcDepDev->info.DSI  = desiredBR;  /* DRI Bit Rate coding from Target to Initiator   */
+      nfcDepDev->info.DRI  = PSL_BR;     /* DSI Bit Rate coding from Initiator  to Target  */
+      nfcDepDev->info.DSI  = PSL_BR;     /* DRI Bit Rate coding from Target to Initiator   */
 
       rfalRfDev->rfalSetBitRate(nfcDepDev->info.DSI, nfcDepDev->info.DRI);
     }
@@ -2357,4 +2386,136 @@ ReturnCode RfalNfcClass::rfalNfcDepGetPduTransceiveStatus(void)
   return ret;
 }
 
+
+/*!
+ ******************************************************************************
+ * \brief NFC-DEP Stream Next Block
+ *
+ * Gets the next Block of the outgoing PDU from the producer, directly in
+ * the Tx buffer, and starts its Transceive
+ *
+ * \return ERR_PARAM : Producer returned more data than the Block can hold
+ * \return ERR_NONE  : Transceive started
+ ******************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcDepStreamNextBlock(void)
+{
+  ReturnCode          ret;
+  rfalNfcDepTxRxParam txRxParam;
+  uint16_t            maxInfLen;
+  uint16_t            len;
+  bool                more;
+
+  /* Calculate max INF/Payload to be sent to other device */
+  maxInfLen  = (gNfcip.streamParam.FSx - (RFAL_NFCDEP_HEADER + RFAL_NFCDEP_DEP_PFB_LEN));
+  maxInfLen -= ((gNfcip.streamParam.DID != RFAL_NFCDEP_DID_NO) ? RFAL_NFCDEP_DID_LEN : 0U);
+  maxInfLen  = MIN(maxInfLen, (uint16_t)RFAL_FEATURE_NFC_DEP_BLOCK_MAX_LEN);
+
+  len  = 0;
+  more = false;
+  EXIT_ON_ERR(ret, gNfcip.streamParam.producer(gNfcip.streamParam.txBuf->inf, maxInfLen, &len, &more));
+
+  if (len > maxInfLen) {
+    return ERR_PARAM;
+  }
+
+  txRxParam.txBuf        = gNfcip.streamParam.txBuf;
+  txRxParam.txBufLen     = len;
+  txRxParam.isTxChaining = more;
+  txRxParam.rxBuf        = gNfcip.streamParam.rxBuf;
+  txRxParam.rxLen        = &gNfcip.streamRxLen;
+  txRxParam.isRxChaining = &gNfcip.isPDURxChaining;
+  txRxParam.FWT          = gNfcip.streamParam.FWT;
+  txRxParam.dFWT         = gNfcip.streamParam.dFWT;
+  txRxParam.FSx          = gNfcip.streamParam.FSx;
+  txRxParam.DID          = gNfcip.streamParam.DID;
+
+  gNfcip.streamStats.txBytes += len;
+  gNfcip.streamStats.blocks++;
+
+  return rfalNfcDepStartTransceive(&txRxParam);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcDepStartStream(const rfalNfcDepStreamParam *param)
+{
+  if ((param == NULL) || (param->producer == NULL) || (param->consumer == NULL) || (param->txBuf == NULL) || (param->rxBuf == NULL)) {
+    return ERR_PARAM;
+  }
+
+  gNfcip.streamParam = *param;
+  gNfcip.streamRxLen = 0;
+  gNfcip.streamStart = millis();
+
+  return rfalNfcDepStreamNextBlock();
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcDepGetStreamStatus(void)
+{
+  ReturnCode ret;
+  ReturnCode err;
+
+  ret = rfalNfcDepGetTransceiveStatus();
+  switch (ret) {
+    /*******************************************************************************/
+    case ERR_NONE:
+
+      /* Block acknowledged while chaining on Tx, produce the next one */
+      if (gNfcip.isTxChaining) {
+        EXIT_ON_ERR(err, rfalNfcDepStreamNextBlock());
+        return ERR_BUSY;
+      }
+
+    /* PDU Tx is done, last Block received */
+    /* fall through */
+
+    /*******************************************************************************/
+    case ERR_AGAIN:       /*  PRQA S 2003 # MISRA 16.3 - Intentional fall through */
+
+      /* Hand the received Block over straight from the Rx buffer */
+      gNfcip.streamStats.rxBytes += gNfcip.streamRxLen;
+      gNfcip.streamStats.blocks++;
+      EXIT_ON_ERR(err, gNfcip.streamParam.consumer(gNfcip.streamParam.rxBuf->inf, gNfcip.streamRxLen, (ret == ERR_AGAIN)));
+
+      if (ret == ERR_AGAIN) {
+        return ERR_BUSY;
+      }
+
+      gNfcip.streamStats.duration += (millis() - gNfcip.streamStart);
+      gNfcip.streamStats.kbps      = ((gNfcip.streamStats.duration != 0U) ?
+                                      (uint32_t)((((uint64_t)gNfcip.streamStats.txBytes + gNfcip.streamStats.rxBytes) * 8U) / gNfcip.streamStats.duration) : 0U);
+      return ERR_NONE;
+
+    /*******************************************************************************/
+    default:
+      /* MISRA 16.4: no empty default statement (a comment being enough) */
+      break;
+  }
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcDepGetStreamStats(rfalNfcDepStreamStats *stats)
+{
+  if (stats == NULL) {
+    return ERR_PARAM;
+  }
+
+  *stats = gNfcip.streamStats;
+
+  return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void RfalNfcClass::rfalNfcDepClearStreamStats(void)
+{
+  ST_MEMSET(&gNfcip.streamStats, 0x00, sizeof(rfalNfcDepStreamStats));
+}
+
 #endif /* RFAL_FEATURE_NFC_DEP */
\ No newline at end of file
@@ -113,6 +113,9 @@
 #define RFAL_NFCDEP_OPER_FULL_MI_DIS     0x00U           /*!< Operation config: full chaining DEPs disable                   */
 #define RFAL_NFCDEP_OPER_FULL_MI_EN      0x08U           /*!< Operation config: full chaining DEPs enable                    */
 
+#define RFAL_NFCDEP_OPER_PSL_MAX_DIS     0x00U           /*!< Operation config: PSL to max LR and bit rate disable (Initiator) */
+#define RFAL_NFCDEP_OPER_PSL_MAX_EN      0x10U           /*!< Operation config: PSL to max LR and bit rate enable  (Initiator) */
+
 
 #define RFAL_NFCDEP_BRS_MAINTAIN         0xC0U           /*!< Value signalling that BR is to be maintained (no PSL)          */
 #define RFAL_NFCDEP_BRS_Dx_MASK          0x07U           /*!< Value signalling that BR is to be maintained (no PSL)          */
@@ -216,6 +219,8 @@ enum {
   RFAL_NFCDEP_LR_254 = 0x03               /*!< Maximum payload size is 254 bytes    */
 };
 
+#define RFAL_NFCDEP_LR_MAX               (uint8_t)(((RFAL_FEATURE_NFC_DEP_BLOCK_MAX_LEN + 2U) / RFAL_NFCDEP_FS_VAL_MIN) - 1U) /*!< Largest LR fitting RFAL_FEATURE_NFC_DEP_BLOCK_MAX_LEN */
+
 /*
  ******************************************************************************
  * GLOBAL DATA TYPES
@@ -225,6 +230,12 @@ enum {
 /*! NFC-DEP callback to check if upper layer has deactivation pending   */
 typedef bool (* rfalNfcDepDeactCallback)(void);
 
+/*! NFC-DEP stream producer: place up to bufLen bytes of the outgoing PDU in buf, set len and whether more blocks follow */
+typedef ReturnCode(* rfalNfcDepStreamProducer)(uint8_t *buf, uint16_t bufLen, uint16_t *len, bool *more);
+
+/*! NFC-DEP stream consumer: take one received block of the incoming PDU, more signals that further blocks follow      */
+typedef ReturnCode(* rfalNfcDepStreamConsumer)(const uint8_t *buf, uint16_t len, bool more);
+
 
 /*! Enumeration of the nfcip communication modes */
 typedef enum {
@@ -486,6 +497,27 @@ typedef struct {
   uint8_t                  DID;       /*!< Device ID (RFAL_ISODEP_NO_DID if no DID) */
 } rfalNfcDepPduTxRxParam;
 
+/*! Structure of parameters used on NFC DEP Stream Transceive */
+typedef struct {
+  rfalNfcDepStreamProducer producer;  /*!< Provides the outgoing PDU, block by block */
+  rfalNfcDepStreamConsumer consumer;  /*!< Takes the incoming PDU, block by block    */
+  rfalNfcDepBufFormat      *txBuf;    /*!< Single Block Transmit Buffer              */
+  rfalNfcDepBufFormat      *rxBuf;    /*!< Single Block Receive Buffer               */
+  uint32_t                 FWT;       /*!< FWT to be used (ignored in Listen Mode)   */
+  uint32_t                 dFWT;      /*!< Delta FWT to be used                      */
+  uint16_t                 FSx;       /*!< Other device Frame Size (FSD or FSC)      */
+  uint8_t                  DID;       /*!< Device ID (RFAL_ISODEP_NO_DID if no DID)  */
+} rfalNfcDepStreamParam;
+
+/*! NFC-DEP stream statistics                                                             */
+typedef struct {
+  uint32_t                txBytes;         /*!< Payload bytes transmitted                     */
+  uint32_t                rxBytes;         /*!< Payload bytes received                        */
+  uint32_t                blocks;          /*!< Blocks transmitted and received               */
+  uint32_t                duration;        /*!< Overall stream duration (ms)                  */
+  uint32_t                kbps;            /*!< Sustained throughput (kbit/s)                 */
+} rfalNfcDepStreamStats;
+
 /*! Struct that holds all NFCIP data */
 typedef struct {
   rfalNfcDepConfigs       cfg;               /*!< Holds the current configuration to be used    */
@@ -529,6 +561,11 @@ typedef struct {
   uint16_t                PDUTxPos;          /*!< PDU Tx position                               */
   uint16_t                PDURxPos;          /*!< PDU Rx position                               */
   bool                    isPDURxChaining;   /*!< PDU Transceive chaining flag                  */
+
+  rfalNfcDepStreamParam   streamParam;       /*!< Stream TxRx params                            */
+  uint16_t                streamRxLen;       /*!< Stream received Block length                  */
+  uint32_t                streamStart;       /*!< Start time of the ongoing stream (ms)         */
+  rfalNfcDepStreamStats   streamStats;       /*!< Stream statistics                             */
 } rfalNfcDep;
 
 
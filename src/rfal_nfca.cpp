@@ -119,6 +119,22 @@ enum {
         } while( ((rts--) != 0U) && ((r)==ERR_TIMEOUT) );  \
       }
 
+/*! Sets (b true) or clears the collision bit of a bulk inventory node and moves past it */
+#define rfalNfcaBulkSetCollBit( n, b )                                                      \
+      {                                                                                     \
+        uint8_t *sdd = (uint8_t *)&(n)->selReq;                                             \
+        if (b) {                                                                            \
+          sdd[(n)->bytesTxRx] = (uint8_t)(sdd[(n)->bytesTxRx] | (1U << (n)->bitsTxRx));     \
+        } else {                                                                            \
+          sdd[(n)->bytesTxRx] = (uint8_t)(sdd[(n)->bytesTxRx] & ~(1U << (n)->bitsTxRx));    \
+        }                                                                                   \
+        (n)->bitsTxRx++;                                                                    \
+        if ((n)->bitsTxRx == RFAL_BITS_IN_BYTE) {                                           \
+          (n)->bitsTxRx = 0;                                                                \
+          (n)->bytesTxRx++;                                                                 \
+        }                                                                                   \
+      }
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -189,6 +205,23 @@ typedef struct {
   bool                  isRx;             /*!< Selection is in reception state                         */
 } rfalNfcaSelParams;
 
+/*! Bulk inventory node: SDD_REQ prefix under which at least one card remains */
+typedef struct {
+  rfalNfcaSelReq        selReq;           /*!< SDD_REQ holding the UID CLn bits known so far           */
+  uint8_t               bytesTxRx;        /*!< Bytes of selReq to be sent                              */
+  uint8_t               bitsTxRx;         /*!< Bits of the last byte to be sent                        */
+  uint8_t               cascadeLv;        /*!< Cascade Level of the SDD_REQ                            */
+  uint8_t               clUid[RFAL_NFCA_SEL_CASCADE_L3][RFAL_NFCA_CASCADE_1_UID_LEN]; /*!< UID CLn of the previous Cascade Levels */
+} rfalNfcaBulkNode;
+
+
+/*! Bulk inventory context */
+typedef struct {
+  rfalNfcaBulkNode      cur;                              /*!< Node being resolved                        */
+  rfalNfcaBulkNode      tree[RFAL_NFCA_BULK_TREE_DEPTH];  /*!< Remembered collisions, branch not followed */
+  uint8_t               treeCnt;                          /*!< Number of remembered collisions            */
+} rfalNfcaBulkParams;
+
 /*! SLP_REQ (HLTA) format   Digital 1.1  6.9.1 & Table 20 */
 typedef struct {
   uint8_t      frame[RFAL_NFCA_SLP_REQ_LEN];  /*!< SLP:  0x50 0x00  */
@@ -199,6 +232,7 @@ typedef struct {
   rfalNfcaTechDetParams DT;               /*!< Technology Detection context                            */
   rfalNfcaColResParams  CR;               /*!< Collision Resolution context                            */
   rfalNfcaSelParams     SEL;              /*!< Selection|Activation context                            */
+  rfalNfcaBulkParams    BULK;             /*!< Bulk inventory context                                  */
 
   rfalNfcaSlpReq        slpReq;           /*!< SLP_REx buffer                                          */
 } rfalNfca;
@@ -806,6 +840,210 @@ ReturnCode RfalNfcClass::rfalNfcaPollerSleepFullCollisionResolution(uint8_t devL
   return ((*devCnt > 0U) ? ERR_NONE : ret);
 }
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcaPollerBulkCollisionResolution(rfalNfcaListenDevice *nfcaDevList, uint16_t devListLen, uint16_t *devCnt, rfalNfcaBulkStats *stats)
+{
+  ReturnCode            ret;
+  rfalNfcaBulkStats     localStats;
+  rfalNfcaSensRes       sensRes;
+  rfalNfcaListenDevice *dev;
+  uint32_t              startTime;
+  uint8_t               failures;
+  bool                  resumed;
+
+  if ((nfcaDevList == NULL) || (devListLen == 0U) || (devCnt == NULL)) {
+    return ERR_PARAM;
+  }
+
+  if (stats == NULL) {
+    stats = &localStats;
+  }
+  ST_MEMSET(stats, 0x00, sizeof(rfalNfcaBulkStats));
+
+  *devCnt            = 0;
+  gNfca.BULK.treeCnt = 0;
+  failures           = 0;
+  ret                = ERR_NONE;
+  startTime          = micros();
+
+  while (*devCnt < devListLen) {
+    dev = &nfcaDevList[*devCnt];
+    ST_MEMSET(dev, 0x00, sizeof(rfalNfcaListenDevice));
+
+    /* Bring the cards not resolved yet back to READY, ALL_REQ (WUPA) only on the first round */
+    ret = rfalNfcaPollerCheckPresence(((stats->rounds == 0U) ? RFAL_14443A_SHORTFRAME_CMD_WUPA : RFAL_14443A_SHORTFRAME_CMD_REQA), &sensRes);
+    stats->rounds++;
+    if (ret == ERR_TIMEOUT) {
+      /* No card left */
+      ret = ERR_NONE;
+      break;
+    }
+
+    if (ret == ERR_NONE) {
+      /* Resume the SDD at the last remembered collision, or start from the root */
+      resumed = (gNfca.BULK.treeCnt > 0U);
+      if (resumed) {
+        gNfca.BULK.treeCnt--;
+        gNfca.BULK.cur = gNfca.BULK.tree[gNfca.BULK.treeCnt];
+        stats->resumed++;
+      } else {
+        ST_MEMSET(&gNfca.BULK.cur, 0x00, sizeof(rfalNfcaBulkNode));
+        gNfca.BULK.cur.bytesTxRx = RFAL_NFCA_SDD_REQ_LEN;
+      }
+
+      ret = rfalNfcaPollerBulkResolveCard(dev, stats);
+      if (ret == ERR_TIMEOUT) {
+        if (resumed) {
+          /* The cards of this branch have left the field */
+          continue;
+        }
+        /* Only devices without anticollision (T1T) answer */
+        ret = ERR_NONE;
+        break;
+      }
+    }
+
+    if (ret != ERR_NONE) {
+      stats->errors++;
+      failures++;
+      if (failures > RFAL_NFCA_BULK_RETRIES) {
+        break;
+      }
+      continue;
+    }
+    failures = 0;
+
+    /* PRQA S 4342 1 # MISRA 10.5 - Guaranteed that no invalid enum values are created: see guard_eq_RFAL_NFCA_T2T, .... */
+    dev->type    = (rfalNfcaListenDeviceType)(dev->selRes.sak & RFAL_NFCA_SEL_RES_CONF_MASK);
+    dev->sensRes = sensRes;
+
+    /* Put the card to sleep so that it no longer answers the following rounds */
+    rfalNfcaPollerSleep();
+    dev->isSleep = true;
+
+    (*devCnt)++;
+    stats->cards++;
+  }
+
+  stats->duration    = (micros() - startTime);
+  stats->cardsPerSec = ((stats->duration != 0U) ? (uint32_t)(((uint64_t)stats->cards * 1000000U) / stats->duration) : 0U);
+
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  return ((*devCnt > 0U) ? ERR_NONE : ERR_TIMEOUT);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief  NFC-A Poller Bulk Resolve Card
+ *
+ * This method resolves and selects one card starting from the node held in
+ * the bulk inventory context. On each collision the branch with the bit at
+ * One is followed and the one with the bit at Zero is remembered.
+ *****************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalNfcaPollerBulkResolveCard(rfalNfcaListenDevice *nfcaDev, rfalNfcaBulkStats *stats)
+{
+  ReturnCode        ret;
+  rfalNfcaSelReq    selReq;
+  rfalNfcaBulkNode *cur = &gNfca.BULK.cur;
+  rfalNfcaBulkNode *node;
+  uint16_t          rxLen;
+  uint8_t           cl;
+
+  nfcaDev->nfcId1Len = 0;
+
+  /*******************************************************************************/
+  /* Select again the Cascade Levels above the remembered collision */
+  for (cl = 0; cl < cur->cascadeLv; cl++) {
+    selReq.selCmd = rfalNfcaCLn2SELCMD(cl);
+    selReq.selPar = RFAL_NFCA_SEL_SELPAR;
+    ST_MEMCPY(selReq.nfcid1, cur->clUid[cl], RFAL_NFCA_CASCADE_1_UID_LEN);
+    selReq.bcc    = rfalNfcaCalculateBcc(selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN);
+
+    EXIT_ON_ERR(ret, rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&selReq, sizeof(rfalNfcaSelReq), (uint8_t *)&nfcaDev->selRes, sizeof(rfalNfcaSelRes), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_FDTMIN));
+
+    ST_MEMCPY(&nfcaDev->nfcId1[nfcaDev->nfcId1Len], &cur->clUid[cl][RFAL_NFCA_SDD_CT_LEN], (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN));
+    nfcaDev->nfcId1Len += (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN);
+  }
+
+  while (cur->cascadeLv <= (uint8_t)RFAL_NFCA_SEL_CASCADE_L3) {
+    /*******************************************************************************/
+    /* Anticollision loop, from the bits already known */
+    do {
+      cur->selReq.selCmd = rfalNfcaCLn2SELCMD(cur->cascadeLv);
+      cur->selReq.selPar = rfalNfcaSelPar(cur->bytesTxRx, cur->bitsTxRx);
+
+      ret = rfalRfDev->rfalISO14443ATransceiveAnticollisionFrame((uint8_t *)&cur->selReq, &cur->bytesTxRx, &cur->bitsTxRx, &rxLen, RFAL_NFCA_FDTMIN);
+      stats->sddFrames++;
+
+      if (ret != ERR_RF_COLLISION) {
+        break;
+      }
+
+      /* A collision in the BCC is not a UID branch */
+      if ((cur->bytesTxRx + ((cur->bitsTxRx != 0U) ? 1U : 0U)) > (RFAL_NFCA_CASCADE_1_UID_LEN + RFAL_NFCA_SDD_REQ_LEN)) {
+        return ERR_PROTO;
+      }
+
+      /* Remember the branch with the collision bit at Zero, follow the one at One */
+      if (gNfca.BULK.treeCnt < RFAL_NFCA_BULK_TREE_DEPTH) {
+        node  = &gNfca.BULK.tree[gNfca.BULK.treeCnt];
+        *node = *cur;
+        rfalNfcaBulkSetCollBit(node, false);
+        gNfca.BULK.treeCnt++;
+      } else {
+        stats->treeFull++;
+      }
+      rfalNfcaBulkSetCollBit(cur, true);
+    } while (true);
+
+    if (ret != ERR_NONE) {
+      return ret;
+    }
+
+    /* Check if the received BCC match */
+    if (cur->selReq.bcc != rfalNfcaCalculateBcc(cur->selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN)) {
+      return ERR_PROTO;
+    }
+
+    /*******************************************************************************/
+    /* Anticollision OK, Select this Cascade Level */
+    cur->selReq.selPar = RFAL_NFCA_SEL_SELPAR;
+    EXIT_ON_ERR(ret, rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&cur->selReq, sizeof(rfalNfcaSelReq), (uint8_t *)&nfcaDev->selRes, sizeof(rfalNfcaSelRes), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCA_FDTMIN));
+
+    if (rxLen != sizeof(rfalNfcaSelRes)) {
+      return ERR_PROTO;
+    }
+
+    if (cur->selReq.nfcid1[0] != RFAL_NFCA_SDD_CT) {
+      /* UID Selection complete */
+      ST_MEMCPY(&nfcaDev->nfcId1[nfcaDev->nfcId1Len], cur->selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN);
+      nfcaDev->nfcId1Len += RFAL_NFCA_CASCADE_1_UID_LEN;
+      return ERR_NONE;
+    }
+
+    if (cur->cascadeLv == (uint8_t)RFAL_NFCA_SEL_CASCADE_L3) {
+      break;
+    }
+
+    /* Cascade Tag present, store nfcid1 bytes (excluding cascade tag) and continue for next CL */
+    ST_MEMCPY(&nfcaDev->nfcId1[nfcaDev->nfcId1Len], &cur->selReq.nfcid1[RFAL_NFCA_SDD_CT_LEN], (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN));
+    nfcaDev->nfcId1Len += (RFAL_NFCA_CASCADE_1_UID_LEN - RFAL_NFCA_SDD_CT_LEN);
+    ST_MEMCPY(cur->clUid[cur->cascadeLv], cur->selReq.nfcid1, RFAL_NFCA_CASCADE_1_UID_LEN);
+
+    cur->cascadeLv++;
+    ST_MEMSET(&cur->selReq, 0x00, sizeof(rfalNfcaSelReq));
+    cur->bytesTxRx = RFAL_NFCA_SDD_REQ_LEN;
+    cur->bitsTxRx  = 0U;
+  }
+
+  return ERR_PROTO;
+}
+
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalNfcaPollerSelect(const uint8_t *nfcid1, uint8_t nfcidLen, rfalNfcaSelRes *selRes)
 {
@@ -98,6 +98,14 @@
  * Relax with 3etu: (3*128)/fc as with multiple NFC-A cards, response may take longer (JCOP cards)
  *                            = (1236 + 384)/fc = 1620 / fc                                      */
 #define RFAL_NFCA_FDTMIN          1620U
+
+#ifndef RFAL_NFCA_BULK_TREE_DEPTH
+  #define RFAL_NFCA_BULK_TREE_DEPTH  16U     /*!< Collisions remembered by the bulk inventory, deeper ones are found again from the root */
+#endif
+
+#ifndef RFAL_NFCA_BULK_RETRIES
+  #define RFAL_NFCA_BULK_RETRIES     2U      /*!< Consecutive failed rounds after which the bulk inventory gives up                     */
+#endif
 /*
  ******************************************************************************
  * GLOBAL MACROS
@@ -187,6 +195,19 @@ typedef struct {
   bool                     isSleep;                             /*!< Device sleeping flag                                                       */
 } rfalNfcaListenDevice;
 
+
+/*! NFC-A bulk inventory statistics */
+typedef struct {
+  uint16_t                 cards;                               /*!< Cards resolved and put to sleep                                            */
+  uint16_t                 rounds;                              /*!< SENS_REQ/ALL_REQ rounds                                                    */
+  uint16_t                 resumed;                             /*!< Rounds resumed from a remembered collision                                 */
+  uint16_t                 sddFrames;                           /*!< SDD_REQ frames sent                                                        */
+  uint16_t                 errors;                              /*!< Rounds failed on a transmission or protocol error                          */
+  uint16_t                 treeFull;                            /*!< Collisions not remembered, RFAL_NFCA_BULK_TREE_DEPTH reached               */
+  uint32_t                 duration;                            /*!< Overall inventory duration (us)                                            */
+  uint32_t                 cardsPerSec;                         /*!< Inventory throughput (cards/s)                                             */
+} rfalNfcaBulkStats;
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -72,6 +72,11 @@
 #define RFAL_NFCF_UPDATE_REQ_MAX_SERV              15U    /*!< Max Services number Update request  T3T 1.0  5.4.1.5  */
 #define RFAL_NFCF_UPDATE_REQ_MAX_BLOCK             13U    /*!< Max Blocks number on Update request T3T 1.0  5.4.1.10 */
 
+#define RFAL_NFCF_AIB_RWFLAG_POS                   10U    /*!< Attribute Information Block RWFlag position T3T 1.0 Table 13 */
+#define RFAL_NFCF_AIB_RWFLAG_RW                  0x01U    /*!< Attribute Information Block RWFlag Read/Write T3T 1.0 Table 13 */
+#define RFAL_NFCF_CHECKUPDATE_REQ_NOS_POS          10U    /*!< Check|Update Req NoS position (LEN included)  T3T 1.0 Table 7 */
+#define RFAL_NFCF_BLOCKLISTELEM_SCLO_MASK        0x0FU    /*!< Block List Element Service Code List Order    T3T 1.0 5.6.1 */
+
 
 /*! MRT Check | Update = (Tt3t x ((A+1) + n (B+1)) x 4^E) + dRWTt3t    T3T  5.8
     Max values used: A = 7 ; B = 7 ; E = 3 ; n = 15 (NFC Forum n = 15, JIS n = 32)
@@ -559,4 +564,161 @@ bool RfalNfcClass::rfalNfcfListenerIsT3TReq(const uint8_t *buf, uint16_t bufLen,
   return true;
 }
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcfListenerInitialize(const rfalNfcfListenerParam *param)
+{
+  if ((param == NULL) || (param->blockStore == NULL) || (param->numBlocks == 0U)) {
+    return ERR_PARAM;
+  }
+
+  gNfcfListener.param   = *param;
+  gNfcfListener.enabled = true;
+
+  return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void RfalNfcClass::rfalNfcfListenerDeinitialize(void)
+{
+  ST_MEMSET(&gNfcfListener, 0x00, sizeof(rfalNfcfListener));
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcfListenerProcessT3TReq(const uint8_t *req, uint16_t reqLen, uint8_t *res, uint16_t resBufLen, uint16_t *resLen)
+{
+  uint16_t blockNum[RFAL_NFCF_CHECK_REQ_MAX_BLOCK];
+  uint16_t sc;
+  uint16_t reqIt;
+  uint16_t resIt;
+  uint8_t  cmd;
+  uint8_t  nos;
+  uint8_t  nob;
+  uint8_t  maxNob;
+  uint8_t  st2;
+  uint8_t  i;
+
+  if ((req == NULL) || (res == NULL) || (resLen == NULL) || (resBufLen < (RFAL_NFCF_LENGTH_LEN + RFAL_NFCF_CHECK_RES_MIN_LEN))) {
+    return ERR_PARAM;
+  }
+
+  if (!gNfcfListener.enabled) {
+    return ERR_WRONG_STATE;
+  }
+
+  *resLen = 0U;
+
+  /* Silently ignore anything else than a CHECK/UPDATE addressed to us  T3T 1.0  5.4.1 */
+  if ((reqLen <= RFAL_NFCF_LENGTH_LEN) || (!rfalNfcfListenerIsT3TReq(&req[RFAL_NFCF_LENGTH_LEN], (reqLen - RFAL_NFCF_LENGTH_LEN), NULL)) ||
+      (ST_BYTECMP(&req[RFAL_NFCF_HEADER_LEN], gNfcfListener.param.nfcid2, RFAL_NFCF_NFCID2_LEN) != 0)) {
+    return ERR_NONE;
+  }
+
+  cmd    = req[RFAL_NFCF_LENGTH_LEN];
+  maxNob = ((cmd == (uint8_t)RFAL_NFCF_CMD_READ_WITHOUT_ENCRYPTION) ? RFAL_NFCF_CHECK_REQ_MAX_BLOCK : RFAL_NFCF_UPDATE_REQ_MAX_BLOCK);
+  st2    = RFAL_NFCF_STATUS_FLAG_SUCCESS;
+  nob    = 0U;
+
+  /*******************************************************************************/
+  /* Decode Service Code List in place                                           */
+  reqIt = RFAL_NFCF_CHECKUPDATE_REQ_NOS_POS;
+  nos   = req[reqIt++];
+
+  if ((nos == 0U) || (nos > RFAL_NFCF_CHECK_REQ_MAX_SERV) || (reqLen < (reqIt + ((uint16_t)nos * sizeof(rfalNfcfServ)) + RFAL_NFCF_NOB_LEN))) {
+    st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOS;
+  } else {
+    for (i = 0; i < nos; i++) {
+      sc     = (uint16_t)((uint16_t)req[reqIt] | ((uint16_t)req[reqIt + 1U] << 8U));
+      reqIt += sizeof(rfalNfcfServ);
+
+      if ((sc != RFAL_NFCF_SERVICECODE_RDWR) && ((sc != RFAL_NFCF_SERVICECODE_RDONLY) || (cmd != (uint8_t)RFAL_NFCF_CMD_READ_WITHOUT_ENCRYPTION))) {
+        st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_SC;
+      }
+    }
+  }
+
+  /*******************************************************************************/
+  /* Decode Block List in place                                                  */
+  if (st2 == RFAL_NFCF_STATUS_FLAG_SUCCESS) {
+    nob = req[reqIt++];
+
+    if ((nob == 0U) || (nob > maxNob)) {
+      st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOB;
+    }
+
+    for (i = 0; ((i < nob) && (st2 == RFAL_NFCF_STATUS_FLAG_SUCCESS)); i++) {
+      if (reqLen < (reqIt + RFAL_NFCF_BLOCKLISTELEM_MAX_LEN - 1U)) {
+        st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOB;
+        break;
+      }
+
+      if ((req[reqIt] & RFAL_NFCF_BLOCKLISTELEM_SCLO_MASK) >= nos) {
+        st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_SCLO;
+        break;
+      }
+
+      if ((req[reqIt] & RFAL_NFCF_BLOCKLISTELEM_LEN_BIT) != 0U) {                      /* 2 byte Block List Element */
+        blockNum[i] = req[reqIt + 1U];
+        reqIt      += (RFAL_NFCF_BLOCKLISTELEM_MAX_LEN - 1U);
+      } else {                                                                          /* 3 byte Block List Element */
+        if (reqLen < (reqIt + RFAL_NFCF_BLOCKLISTELEM_MAX_LEN)) {
+          st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOB;
+          break;
+        }
+        blockNum[i] = (uint16_t)((uint16_t)req[reqIt + 1U] | ((uint16_t)req[reqIt + 2U] << 8U));
+        reqIt      += RFAL_NFCF_BLOCKLISTELEM_MAX_LEN;
+      }
+
+      if (blockNum[i] >= gNfcfListener.param.numBlocks) {
+        st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_BLOCK;
+      }
+    }
+  }
+
+  /*******************************************************************************/
+  /* Compose response: LEN | Response Code | NFCID2 | ST1 | ST2 [| NoB | Data]   */
+  resIt = RFAL_NFCF_LENGTH_LEN;
+  res[resIt++] = (uint8_t)(cmd + 1U);
+  ST_MEMCPY(&res[resIt], gNfcfListener.param.nfcid2, RFAL_NFCF_NFCID2_LEN);
+  resIt += RFAL_NFCF_NFCID2_LEN;
+  resIt += (RFAL_NFCF_CHECKUPDATE_RES_NOB_POS - RFAL_NFCF_CHECKUPDATE_RES_ST1_POS);   /* ST1 ST2 filled below */
+
+  if (st2 == RFAL_NFCF_STATUS_FLAG_SUCCESS) {
+    if (cmd == (uint8_t)RFAL_NFCF_CMD_READ_WITHOUT_ENCRYPTION) {
+      if (resBufLen < (resIt + RFAL_NFCF_NOB_LEN + ((uint16_t)nob * RFAL_NFCF_BLOCK_LEN))) {
+        st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOB;
+      } else {
+        res[resIt++] = nob;
+        for (i = 0; i < nob; i++) {
+          ST_MEMCPY(&res[resIt], &gNfcfListener.param.blockStore[(uint32_t)blockNum[i] * RFAL_NFCF_BLOCK_LEN], RFAL_NFCF_BLOCK_LEN);
+          resIt += RFAL_NFCF_BLOCK_LEN;
+        }
+      }
+    } else {
+      if (gNfcfListener.param.blockStore[RFAL_NFCF_AIB_RWFLAG_POS] != RFAL_NFCF_AIB_RWFLAG_RW) {
+        st2 = RFAL_NFCF_STATUS_FLAG2_ACCESS_DENIED;
+      } else if (reqLen < (reqIt + ((uint16_t)nob * RFAL_NFCF_BLOCK_LEN))) {
+        st2 = RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOB;
+      } else {
+        for (i = 0; i < nob; i++) {
+          ST_MEMCPY(&gNfcfListener.param.blockStore[(uint32_t)blockNum[i] * RFAL_NFCF_BLOCK_LEN], &req[reqIt], RFAL_NFCF_BLOCK_LEN);
+          reqIt += RFAL_NFCF_BLOCK_LEN;
+        }
+      }
+    }
+  }
+
+  if (st2 != RFAL_NFCF_STATUS_FLAG_SUCCESS) {
+    resIt = (RFAL_NFCF_LENGTH_LEN + RFAL_NFCF_CHECKUPDATE_RES_NOB_POS);              /* No block data on error */
+  }
+
+  res[RFAL_NFCF_LENGTH_LEN + RFAL_NFCF_CHECKUPDATE_RES_ST1_POS] = ((st2 == RFAL_NFCF_STATUS_FLAG_SUCCESS) ? RFAL_NFCF_STATUS_FLAG_SUCCESS : RFAL_NFCF_STATUS_FLAG_ERROR);
+  res[RFAL_NFCF_LENGTH_LEN + RFAL_NFCF_CHECKUPDATE_RES_ST2_POS] = st2;
+  res[0]  = (uint8_t)resIt;
+  *resLen = resIt;
+
+  return ERR_NONE;
+}
+
 #endif /* RFAL_FEATURE_NFCF */
\ No newline at end of file
@@ -116,6 +116,13 @@
 #define RFAL_NFCF_SERVICECODE_RDONLY           0x000BU   /*!< NDEF Service Code as Read-Only                 T3T 1.0 7.2.1 */
 #define RFAL_NFCF_SERVICECODE_RDWR             0x0009U   /*!< NDEF Service Code as Read and Write            T3T 1.0 7.2.1 */
 
+#define RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOS       0xA1U   /*!< Status Flag 2 illegal Number of Service        JIS X6319-4  */
+#define RFAL_NFCF_STATUS_FLAG2_ILLEGAL_NOB       0xA2U   /*!< Status Flag 2 illegal Number of Block          JIS X6319-4  */
+#define RFAL_NFCF_STATUS_FLAG2_ILLEGAL_SCLO      0xA3U   /*!< Status Flag 2 illegal Service Code List Order  JIS X6319-4  */
+#define RFAL_NFCF_STATUS_FLAG2_ACCESS_DENIED     0xA5U   /*!< Status Flag 2 access denied (read-only)        JIS X6319-4  */
+#define RFAL_NFCF_STATUS_FLAG2_ILLEGAL_SC        0xA6U   /*!< Status Flag 2 illegal Service Code             JIS X6319-4  */
+#define RFAL_NFCF_STATUS_FLAG2_ILLEGAL_BLOCK     0xA8U   /*!< Status Flag 2 illegal Block Number             JIS X6319-4  */
+
 #define RFAL_NFCF_TEST_LB_CMD0                   0xD8U /*!< T3T loopback CMD0                 ETSI TS 102 695-1  5.6.4.4.2 */
 #define RFAL_NFCF_TEST_LB_CMD1                   0x00U /*!< T3T loopback CMD1                 ETSI TS 102 695-1  5.6.4.4.2 */
 
@@ -195,6 +202,20 @@ typedef struct {
 } rfalNfcfServBlockListParam;
 
 
+/*! T3T Listener (card emulation) parameters   T3T 1.0  7.1 */
+typedef struct {
+  uint8_t               nfcid2[RFAL_NFCF_NFCID2_LEN]; /*!< NFCID2 the requests shall be addressed to              */
+  uint8_t               *blockStore;  /*!< Block store: block 0 Attribute Information Block, then NDEF data blocks */
+  uint16_t              numBlocks;    /*!< Number of blocks in the store, Attribute Information Block included     */
+} rfalNfcfListenerParam;
+
+/*! T3T Listener (card emulation) context */
+typedef struct {
+  bool                  enabled;      /*!< Card emulation engine enabled      */
+  rfalNfcfListenerParam param;        /*!< Block store served by the engine   */
+} rfalNfcfListener;
+
+
 /*! Structure/Buffer to hold the SENSF_RES with LEN byte prepended                                 */
 typedef struct {
   uint8_t           LEN;                                /*!< NFC-F LEN byte                      */
@@ -456,6 +456,63 @@ ReturnCode RfalNfcClass::rfalNfcvPollerReadSingleBlock(uint8_t flags, const uint
   return rfalNfcvPollerTransceiveReq(RFAL_NFCV_CMD_READ_SINGLE_BLOCK, flags, RFAL_NFCV_PARAM_SKIP, uid, &bn, sizeof(uint8_t), rxBuf, rxBufLen, rcvLen);
 }
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcvPollerStartReadSingleBlock(uint8_t flags, const uint8_t *uid, uint8_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
+  rfalNfcvGenericReq req;
+  uint8_t            msgIt;
+
+  if ((rxBuf == NULL) || (rcvLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  msgIt = 0;
+
+  /* Compute Request Command, as rfalNfcvPollerTransceiveReq() */
+  req.REQ_FLAG = (uint8_t)(flags & (~((uint32_t)RFAL_NFCV_REQ_FLAG_ADDRESS)));
+  req.CMD      = (uint8_t)RFAL_NFCV_CMD_READ_SINGLE_BLOCK;
+
+  if (uid != NULL) {
+    req.REQ_FLAG |= (uint8_t)RFAL_NFCV_REQ_FLAG_ADDRESS;
+    ST_MEMCPY(&req.payload.data[msgIt], uid, RFAL_NFCV_UID_LEN);
+    msgIt += RFAL_NFCV_UID_LEN;
+  }
+  req.payload.data[msgIt++] = blockNum;
+
+  gRfalNfcv.rxBuf  = rxBuf;
+  gRfalNfcv.rcvLen = rcvLen;
+
+  /* Send Command, the answer is retrieved by rfalNfcvPollerGetReadSingleBlockStatus() */
+  return rfalRfDev->rfalTransceiveBlockingTx((uint8_t *)&req, (RFAL_NFCV_CMD_LEN + RFAL_NFCV_FLAG_LEN + (uint16_t)msgIt), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_NFCV_FDT_MAX);
+}
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalNfcvPollerGetReadSingleBlockStatus(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_BUSY(ret, rfalRfDev->rfalGetTransceiveStatus());
+
+  /* Convert bits to bytes */
+  *gRfalNfcv.rcvLen = rfalConvBitsToBytes(*gRfalNfcv.rcvLen);
+
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  /* Check if the response minimum length has been received */
+  if ((*gRfalNfcv.rcvLen) < (uint8_t)RFAL_NFCV_FLAG_LEN) {
+    return ERR_PROTO;
+  }
+
+  /* Check if an error has been signalled */
+  if ((gRfalNfcv.rxBuf[RFAL_NFCV_FLAG_POS] & (uint8_t)RFAL_NFCV_RES_FLAG_ERROR) != 0U) {
+    return rfalNfcvParseError(gRfalNfcv.rxBuf[RFAL_NFCV_DATASTART_POS]);
+  }
+
+  return ERR_NONE;
+}
+
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalNfcvPollerWriteSingleBlock(uint8_t flags, const uint8_t *uid, uint8_t blockNum, const uint8_t *wrData, uint8_t blockLen)
 {
@@ -241,6 +241,13 @@ typedef struct {
 } rfalNfcvListenDevice;
 
 
+/*! RFAL NFC-V instance */
+typedef struct {
+  uint8_t                *rxBuf;      /*!< Response of the request in progress */
+  uint16_t               *rcvLen;     /*!< Received length                     */
+} rfalNfcv;
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -86,6 +86,9 @@
  ******************************************************************************
  */
 
+#define st25tbTimerStart( timer, time_ms ) (timer) = timerCalculateTimer((uint16_t)(time_ms))  /*!< Configures and starts the t2 timer */
+#define st25tbTimerisExpired( timer )      timerIsExpired( timer )                             /*!< Checks t2 timer has expired        */
+
 /*
 ******************************************************************************
 * GLOBAL TYPES
@@ -127,68 +130,186 @@ typedef struct {
 
 /*!
  *****************************************************************************
- * \brief  ST25TB Poller Do Collision Resolution
+ * \brief  ST25TB Poller Start TxRx
+ *
+ * This method sends a ST25TB command and leaves the response to be retrieved
+ * by rfalSt25tbPollerGetTxRxStatus()
+ *
+ * \param[in]  txBuf     : command to be sent
+ * \param[in]  txBufLen  : command length
+ * \param[out] rxData    : location to copy the response to, NULL if none
+ * \param[in]  rxDataLen : expected response length
+ * \param[in]  fwt       : Frame Waiting Time
  *
- * This method performs ST25TB Collision resolution loop for each slot
+ * \return ERR_NONE if the command has been sent or a standard error code
+ *****************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartTxRx(const uint8_t *txBuf, uint16_t txBufLen, uint8_t *rxData, uint16_t rxDataLen, uint32_t fwt)
+{
+  gRfalSt25tb.TR.rxData    = rxData;
+  gRfalSt25tb.TR.rxDataLen = rxDataLen;
+
+  return rfalRfDev->rfalTransceiveBlockingTx((uint8_t *)txBuf, txBufLen, gRfalSt25tb.TR.rxBuf, sizeof(gRfalSt25tb.TR.rxBuf), &gRfalSt25tb.TR.rxLen, RFAL_TXRX_FLAGS_DEFAULT, fwt);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Poller Get TxRx Status
  *
- * \param[in]  devLimit      : device limit value, and size st25tbDevList
- * \param[out] st25tbDevList : ST35TB listener device info
- * \param[out] devCnt        : Devices found counter
+ * This method checks the response length and copies the response to the
+ * location given to rfalSt25tbPollerStartTxRx()
  *
- * \return colPending         : true if a collision was detected
+ * \return ERR_BUSY  : Transceive ongoing
+ * \return ERR_PROTO : Response with an unexpected length
+ * \return ERR_NONE  : No error
  *****************************************************************************
  */
-bool RfalNfcClass::rfalSt25tbPollerDoCollisionResolution(uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt)
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetTxRxStatus(void)
 {
-  uint8_t    i;
-  uint8_t    chipId;
   ReturnCode ret;
-  bool col;
 
-  col = false;
+  EXIT_ON_BUSY(ret, rfalRfDev->rfalGetTransceiveStatus());
 
-  for (i = 0; i < RFAL_ST25TB_SLOTS; i++) {
-    delay(1);  /* Wait t2: Answer to new request delay  */
+  /* Convert bits to bytes */
+  gRfalSt25tb.TR.rxLen = rfalConvBitsToBytes(gRfalSt25tb.TR.rxLen);
 
-    if (i == 0U) {
-      /* Step 2: Send Pcall16 */
-      ret = rfalSt25tbPollerPcall(&chipId);
-    } else {
-      /* Step 3-17: Send Pcall16 */
-      ret = rfalSt25tbPollerSlotMarker(i, &chipId);
-    }
+  if (ret != ERR_NONE) {
+    return ret;
+  }
 
-    if (ret == ERR_NONE) {
-      /* Found another device */
-      st25tbDevList[*devCnt].chipID       = chipId;
-      st25tbDevList[*devCnt].isDeselected = false;
+  /* Check for valid response length */
+  if (gRfalSt25tb.TR.rxLen != gRfalSt25tb.TR.rxDataLen) {
+    return ERR_PROTO;
+  }
 
-      /* Select Device, retrieve its UID  */
-      ret = rfalSt25tbPollerSelect(chipId);
+  if (gRfalSt25tb.TR.rxData != NULL) {
+    ST_MEMCPY(gRfalSt25tb.TR.rxData, gRfalSt25tb.TR.rxBuf, gRfalSt25tb.TR.rxDataLen);
+  }
 
-      /* By Selecting this device, the previous gets Deselected */
-      if ((*devCnt) > 0U) {
-        st25tbDevList[(*devCnt) - 1U].isDeselected = true;
-      }
+  return ERR_NONE;
+}
 
-      if (ERR_NONE == ret) {
-        ret = rfalSt25tbPollerGetUID(&st25tbDevList[*devCnt].UID);
-      }
 
-      if (ERR_NONE == ret) {
-        (*devCnt)++;
-      }
-    } else if ((ret == ERR_CRC) || (ret == ERR_FRAMING)) {
-      col = true;
-    } else {
-      /* MISRA 15.7 - Empty else */
-    }
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Poller Collision Resolution Next Slot
+ *
+ * This method moves the collision resolution to the next slot: it starts the
+ * slotted loop after the Initiate step, restarts it while collisions are
+ * pending and ends it once the device limit is reached
+ *****************************************************************************
+ */
+void RfalNfcClass::rfalSt25tbPollerNextSlot(void)
+{
+  if ((*gRfalSt25tb.CR.devCnt) >= gRfalSt25tb.CR.devLimit) {
+    gRfalSt25tb.CR.state = RFAL_ST25TB_CR_END;
+    return;
+  }
 
-    if (*devCnt >= devLimit) {
-      break;
+  if (!gRfalSt25tb.CR.slotted) {
+    /* Always proceed to Pcall16 anticollision as phase differences of tags can lead to no tag recognized, even if there is one */
+    gRfalSt25tb.CR.slotted    = true;
+    gRfalSt25tb.CR.curSlotNum = 0U;
+  } else if ((gRfalSt25tb.CR.curSlotNum + 1U) < RFAL_ST25TB_SLOTS) {
+    gRfalSt25tb.CR.curSlotNum++;
+  } else if (gRfalSt25tb.CR.colPend) {
+    /* Collision detected, run the slotted loop again */
+    gRfalSt25tb.CR.curSlotNum = 0U;
+    gRfalSt25tb.CR.colPend    = false;
+  } else {
+    gRfalSt25tb.CR.state = RFAL_ST25TB_CR_END;
+    return;
+  }
+
+  /* Wait t2: Answer to new request delay  */
+  st25tbTimerStart(gRfalSt25tb.CR.tmr, 1U);
+  gRfalSt25tb.CR.state = RFAL_ST25TB_CR_SLOT_TX;
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Poller Batch Stats
+ *
+ * This method computes the duration and throughput of a batch access
+ *****************************************************************************
+ */
+void RfalNfcClass::rfalSt25tbPollerBatchStats(rfalSt25tbBatchStats *stats, uint32_t startTime)
+{
+  stats->duration    = (micros() - startTime);
+  stats->bytesPerSec = ((stats->duration != 0U) ? (uint32_t)(((uint64_t)stats->blocks * RFAL_ST25TB_BLOCK_LEN * 1000000U) / stats->duration) : 0U);
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Poller Batch Read Block
+ *
+ * This method reads a block straight into its place in the caller's image,
+ * repeating the Read Block on transmission errors
+ *****************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalSt25tbPollerBatchReadBlock(uint8_t blockAddress, uint8_t *blockData, rfalSt25tbBatchStats *stats)
+{
+  ReturnCode ret;
+  uint8_t    retries;
+
+  retries = 0U;
+  for (;;) {
+    EXIT_ON_ERR(ret, rfalSt25tbPollerStartReadBlock(blockAddress, (rfalSt25tbBlock *)blockData));
+    rfalRunBlocking(ret, rfalSt25tbPollerGetReadBlockStatus());
+
+    if (((ret != ERR_CRC) && (ret != ERR_FRAMING)) || (retries >= RFAL_ST25TB_BATCH_RETRIES)) {
+      return ret;
     }
+
+    retries++;
+    stats->retries++;
+  }
+}
+
+
+/*!
+ *****************************************************************************
+ * \brief  ST25TB Poller Batch Write Block
+ *
+ * This method writes a block and returns as soon as tW has elapsed. The
+ * block is only read back here if a transmission error occurred while it
+ * was being committed
+ *****************************************************************************
+ */
+ReturnCode RfalNfcClass::rfalSt25tbPollerBatchWriteBlock(uint8_t blockAddress, const uint8_t *blockData, rfalSt25tbBatchStats *stats)
+{
+  ReturnCode      ret;
+  rfalSt25tbBlock tmpBlockData;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartWriteBlock(blockAddress, (const rfalSt25tbBlock *)blockData));
+
+  /* No answer is expected: the write is done on timeout, once FWT + tW has elapsed */
+  rfalRunBlocking(ret, rfalRfDev->rfalGetTransceiveStatus());
+
+  if (ret == ERR_TIMEOUT) {
+    return ERR_NONE;
   }
-  return col;
+
+  /* Check if an unexpected answer was received */
+  if (ret == ERR_NONE) {
+    return ERR_PROTO;
+  }
+
+  /* Check whether a transmission error occurred */
+  if ((ret != ERR_CRC) && (ret != ERR_FRAMING) && (ret != ERR_NOMEM) && (ret != ERR_RF_COLLISION)) {
+    return ret;
+  }
+
+  /* Maybe noise while committing data: wait maximum programming time and verify this block */
+  rfalRfDev->rfalSetGT((RFAL_ST25TB_FWT + RFAL_ST25TB_TW));
+  rfalRfDev->rfalFieldOnAndStartGT();
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerBatchReadBlock(blockAddress, tmpBlockData, stats));
+
+  return ((ST_BYTECMP(tmpBlockData, blockData, RFAL_ST25TB_BLOCK_LEN) == 0) ? ERR_NONE : ERR_PROTO);
 }
 
 
@@ -215,23 +336,34 @@ ReturnCode RfalNfcClass::rfalSt25tbPollerInitialize(void)
 ReturnCode RfalNfcClass::rfalSt25tbPollerCheckPresence(uint8_t *chipId)
 {
   ReturnCode ret;
-  uint8_t    chipIdRes;
 
-  chipIdRes = 0x00;
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartCheckPresence(chipId));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetCheckPresenceStatus());
+
+  return ret;
+}
+
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartCheckPresence(uint8_t *chipId)
+{
   /* Send Initiate Request */
-  ret = rfalSt25tbPollerInitiate(&chipIdRes);
+  return rfalSt25tbPollerStartInitiate(chipId);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetCheckPresenceStatus(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_BUSY(ret, rfalSt25tbPollerGetInitiateStatus());
 
   /*  Check if a transmission error was detected */
   if ((ret == ERR_CRC) || (ret == ERR_FRAMING)) {
     return ERR_NONE;
   }
 
-  /* Copy chip ID if requested */
-  if (chipId != NULL) {
-    *chipId = chipIdRes;
-  }
-
   return ret;
 }
 
@@ -239,37 +371,51 @@ ReturnCode RfalNfcClass::rfalSt25tbPollerCheckPresence(uint8_t *chipId)
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalSt25tbPollerInitiate(uint8_t *chipId)
 {
-  ReturnCode            ret;
-  uint16_t              rxLen;
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartInitiate(chipId));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetInitiateStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartInitiate(uint8_t *chipId)
+{
   rfalSt25tbInitiateReq initiateReq;
-  uint8_t               rxBuf[RFAL_ST25TB_CHIP_ID_LEN + RFAL_ST25TB_CRC_LEN]; /* In case we receive less data that CRC, RF layer will not remove the CRC from buffer */
 
   /* Compute Initiate Request */
   initiateReq.cmd1   = RFAL_ST25TB_INITIATE_CMD1;
   initiateReq.cmd2   = RFAL_ST25TB_INITIATE_CMD2;
 
-  /* Send Initiate Request */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&initiateReq, sizeof(rfalSt25tbInitiateReq), (uint8_t *)rxBuf, sizeof(rxBuf), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  /* Send Initiate Request, in case less data than CRC is received RF layer will not remove the CRC from buffer */
+  return rfalSt25tbPollerStartTxRx((uint8_t *)&initiateReq, sizeof(rfalSt25tbInitiateReq), chipId, RFAL_ST25TB_CHIP_ID_LEN, RFAL_ST25TB_FWT);
+}
 
-  /* Check for valid Select Response   */
-  if ((ret == ERR_NONE) && (rxLen != RFAL_ST25TB_CHIP_ID_LEN)) {
-    return ERR_PROTO;
-  }
 
-  /* Copy chip ID if requested */
-  if (chipId != NULL) {
-    *chipId = *rxBuf;
-  }
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetInitiateStatus(void)
+{
+  return rfalSt25tbPollerGetTxRxStatus();
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerPcall(uint8_t *chipId)
+{
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartPcall(chipId));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetPcallStatus());
 
   return ret;
 }
 
 
 /*******************************************************************************/
-ReturnCode RfalNfcClass::rfalSt25tbPollerPcall(uint8_t *chipId)
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartPcall(uint8_t *chipId)
 {
-  ReturnCode         ret;
-  uint16_t           rxLen;
   rfalSt25tbPcallReq pcallReq;
 
   /* Compute Pcal16 Request */
@@ -277,14 +423,14 @@ ReturnCode RfalNfcClass::rfalSt25tbPollerPcall(uint8_t *chipId)
   pcallReq.cmd2   = RFAL_ST25TB_PCALL_CMD2;
 
   /* Send Pcal16 Request */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&pcallReq, sizeof(rfalSt25tbPcallReq), (uint8_t *)chipId, RFAL_ST25TB_CHIP_ID_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  return rfalSt25tbPollerStartTxRx((uint8_t *)&pcallReq, sizeof(rfalSt25tbPcallReq), chipId, RFAL_ST25TB_CHIP_ID_LEN, RFAL_ST25TB_FWT);
+}
 
-  /* Check for valid Select Response   */
-  if ((ret == ERR_NONE) && (rxLen != RFAL_ST25TB_CHIP_ID_LEN)) {
-    return ERR_PROTO;
-  }
 
-  return ret;
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetPcallStatus(void)
+{
+  return rfalSt25tbPollerGetTxRxStatus();
 }
 
 
@@ -292,8 +438,18 @@ ReturnCode RfalNfcClass::rfalSt25tbPollerPcall(uint8_t *chipId)
 ReturnCode RfalNfcClass::rfalSt25tbPollerSlotMarker(uint8_t slotNum, uint8_t *chipIdRes)
 {
   ReturnCode ret;
-  uint16_t   rxLen;
-  uint8_t    slotMarker;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartSlotMarker(slotNum, chipIdRes));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetSlotMarkerStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartSlotMarker(uint8_t slotNum, uint8_t *chipIdRes)
+{
+  uint8_t slotMarker;
 
   if ((slotNum == 0U) || (slotNum > 15U)) {
     return ERR_PARAM;
@@ -302,36 +458,55 @@ ReturnCode RfalNfcClass::rfalSt25tbPollerSlotMarker(uint8_t slotNum, uint8_t *ch
   /* Compute SlotMarker */
   slotMarker = (((slotNum & RFAL_ST25TB_SLOTNUM_MASK) << RFAL_ST25TB_SLOTNUM_SHIFT) | RFAL_ST25TB_PCALL_CMD1);
 
-
   /* Send SlotMarker */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&slotMarker, RFAL_ST25TB_CMD_LEN, (uint8_t *)chipIdRes, RFAL_ST25TB_CHIP_ID_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  return rfalSt25tbPollerStartTxRx(&slotMarker, RFAL_ST25TB_CMD_LEN, chipIdRes, RFAL_ST25TB_CHIP_ID_LEN, RFAL_ST25TB_FWT);
+}
 
-  /* Check for valid ChipID Response   */
-  if ((ret == ERR_NONE) && (rxLen != RFAL_ST25TB_CHIP_ID_LEN)) {
-    return ERR_PROTO;
-  }
 
-  return ret;
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetSlotMarkerStatus(void)
+{
+  return rfalSt25tbPollerGetTxRxStatus();
 }
 
 
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalSt25tbPollerSelect(uint8_t chipId)
 {
-  ReturnCode          ret;
-  uint16_t            rxLen;
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartSelect(chipId));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetSelectStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartSelect(uint8_t chipId)
+{
   rfalSt25tbSelectReq selectReq;
-  uint8_t             chipIdRes;
 
   /* Compute Select Request */
   selectReq.cmd    = RFAL_ST25TB_SELECT_CMD;
   selectReq.chipId = chipId;
 
+  gRfalSt25tb.TR.chipId = chipId;
+
   /* Send Select Request */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&selectReq, sizeof(rfalSt25tbSelectReq), (uint8_t *)&chipIdRes, RFAL_ST25TB_CHIP_ID_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  return rfalSt25tbPollerStartTxRx((uint8_t *)&selectReq, sizeof(rfalSt25tbSelectReq), NULL, RFAL_ST25TB_CHIP_ID_LEN, RFAL_ST25TB_FWT);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetSelectStatus(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_BUSY(ret, rfalSt25tbPollerGetTxRxStatus());
 
   /* Check for valid Select Response   */
-  if ((ret == ERR_NONE) && ((rxLen != RFAL_ST25TB_CHIP_ID_LEN) || (chipIdRes != chipId))) {
+  if ((ret == ERR_NONE) && (gRfalSt25tb.TR.rxBuf[0] != gRfalSt25tb.TR.chipId)) {
     return ERR_PROTO;
   }
 
@@ -343,63 +518,177 @@ ReturnCode RfalNfcClass::rfalSt25tbPollerSelect(uint8_t chipId)
 ReturnCode RfalNfcClass::rfalSt25tbPollerGetUID(rfalSt25tbUID *UID)
 {
   ReturnCode ret;
-  uint16_t   rxLen;
-  uint8_t    getUidReq;
 
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartGetUID(UID));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetUIDStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartGetUID(rfalSt25tbUID *UID)
+{
+  uint8_t getUidReq;
 
   /* Compute Get UID Request */
   getUidReq = RFAL_ST25TB_GET_UID_CMD;
 
-  /* Send Select Request */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&getUidReq, RFAL_ST25TB_CMD_LEN, (uint8_t *)UID, sizeof(rfalSt25tbUID), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  /* Send Get UID Request */
+  return rfalSt25tbPollerStartTxRx(&getUidReq, RFAL_ST25TB_CMD_LEN, (uint8_t *)UID, RFAL_ST25TB_UID_LEN, RFAL_ST25TB_FWT);
+}
 
-  /* Check for valid UID Response */
-  if ((ret == ERR_NONE) && (rxLen != RFAL_ST25TB_UID_LEN)) {
-    return ERR_PROTO;
-  }
 
-  return ret;
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetUIDStatus(void)
+{
+  return rfalSt25tbPollerGetTxRxStatus();
 }
 
 
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalSt25tbPollerCollisionResolution(uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt)
 {
-
-  uint8_t    chipId;
   ReturnCode ret;
-  bool       detected;  /* collision or device was detected */
 
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartCollisionResolution(devLimit, st25tbDevList, devCnt));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetCollisionResolutionStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartCollisionResolution(uint8_t devLimit, rfalSt25tbListenDevice *st25tbDevList, uint8_t *devCnt)
+{
   if ((st25tbDevList == NULL) || (devCnt == NULL) || (devLimit == 0U)) {
     return ERR_PARAM;
   }
 
   *devCnt = 0;
 
+  /* Store parameters */
+  gRfalSt25tb.CR.devLimit      = devLimit;
+  gRfalSt25tb.CR.st25tbDevList = st25tbDevList;
+  gRfalSt25tb.CR.devCnt        = devCnt;
+  gRfalSt25tb.CR.curSlotNum    = 0U;
+  gRfalSt25tb.CR.slotted       = false;
+  gRfalSt25tb.CR.colPend       = false;
+  gRfalSt25tb.CR.tmr           = RFAL_TIMING_NONE;
+
   /* Step 1: Send Initiate */
-  ret = rfalSt25tbPollerInitiate(&chipId);
-  if (ret == ERR_NONE) {
-    /* If only 1 answer is detected */
-    st25tbDevList[*devCnt].chipID       = chipId;
-    st25tbDevList[*devCnt].isDeselected = false;
+  gRfalSt25tb.CR.state = RFAL_ST25TB_CR_INITIATE;
+  return rfalSt25tbPollerStartInitiate(&gRfalSt25tb.CR.chipId);
+}
 
-    /* Retrieve its UID and keep it Selected*/
-    ret = rfalSt25tbPollerSelect(chipId);
 
-    if (ERR_NONE == ret) {
-      ret = rfalSt25tbPollerGetUID(&st25tbDevList[*devCnt].UID);
-    }
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetCollisionResolutionStatus(void)
+{
+  ReturnCode              ret;
+  rfalSt25tbListenDevice *dev;
 
-    if (ERR_NONE == ret) {
-      (*devCnt)++;
-    }
-  }
-  /* Always proceed to Pcall16 anticollision as phase differences of tags can lead to no tag recognized, even if there is one */
-  if (*devCnt < devLimit) {
-    /* Multiple device responses */
-    do {
-      detected = rfalSt25tbPollerDoCollisionResolution(devLimit, st25tbDevList, devCnt);
-    } while ((detected == true) && (*devCnt < devLimit));
+  dev = &gRfalSt25tb.CR.st25tbDevList[*gRfalSt25tb.CR.devCnt];
+
+  switch (gRfalSt25tb.CR.state) {
+    /*******************************************************************************/
+    case RFAL_ST25TB_CR_INITIATE:
+
+      EXIT_ON_BUSY(ret, rfalSt25tbPollerGetInitiateStatus());
+
+      if (ret == ERR_NONE) {
+        /* If only 1 answer is detected retrieve its UID and keep it Selected */
+        dev->chipID       = gRfalSt25tb.CR.chipId;
+        dev->isDeselected = false;
+
+        EXIT_ON_ERR(ret, rfalSt25tbPollerStartSelect(gRfalSt25tb.CR.chipId));
+        gRfalSt25tb.CR.state = RFAL_ST25TB_CR_SELECT;
+      } else {
+        rfalSt25tbPollerNextSlot();
+      }
+      return ERR_BUSY;
+
+
+    /*******************************************************************************/
+    case RFAL_ST25TB_CR_SLOT_TX:
+
+      if (!st25tbTimerisExpired(gRfalSt25tb.CR.tmr)) {
+        return ERR_BUSY;
+      }
+
+      if (gRfalSt25tb.CR.curSlotNum == 0U) {
+        /* Step 2: Send Pcall16 */
+        EXIT_ON_ERR(ret, rfalSt25tbPollerStartPcall(&gRfalSt25tb.CR.chipId));
+      } else {
+        /* Step 3-17: Send SlotMarker */
+        EXIT_ON_ERR(ret, rfalSt25tbPollerStartSlotMarker(gRfalSt25tb.CR.curSlotNum, &gRfalSt25tb.CR.chipId));
+      }
+
+      gRfalSt25tb.CR.state = RFAL_ST25TB_CR_SLOT;
+      return ERR_BUSY;
+
+
+    /*******************************************************************************/
+    case RFAL_ST25TB_CR_SLOT:
+
+      EXIT_ON_BUSY(ret, rfalSt25tbPollerGetSlotMarkerStatus());
+
+      if (ret == ERR_NONE) {
+        /* Found another device */
+        dev->chipID       = gRfalSt25tb.CR.chipId;
+        dev->isDeselected = false;
+
+        /* Select Device, retrieve its UID  */
+        EXIT_ON_ERR(ret, rfalSt25tbPollerStartSelect(gRfalSt25tb.CR.chipId));
+        gRfalSt25tb.CR.state = RFAL_ST25TB_CR_SELECT;
+        return ERR_BUSY;
+      }
+
+      if ((ret == ERR_CRC) || (ret == ERR_FRAMING)) {
+        gRfalSt25tb.CR.colPend = true;
+      }
+
+      rfalSt25tbPollerNextSlot();
+      return ERR_BUSY;
+
+
+    /*******************************************************************************/
+    case RFAL_ST25TB_CR_SELECT:
+
+      EXIT_ON_BUSY(ret, rfalSt25tbPollerGetSelectStatus());
+
+      /* By Selecting this device, the previous gets Deselected */
+      if (gRfalSt25tb.CR.slotted && ((*gRfalSt25tb.CR.devCnt) > 0U)) {
+        gRfalSt25tb.CR.st25tbDevList[(*gRfalSt25tb.CR.devCnt) - 1U].isDeselected = true;
+      }
+
+      if (ret == ERR_NONE) {
+        EXIT_ON_ERR(ret, rfalSt25tbPollerStartGetUID(&dev->UID));
+        gRfalSt25tb.CR.state = RFAL_ST25TB_CR_GET_UID;
+      } else {
+        rfalSt25tbPollerNextSlot();
+      }
+      return ERR_BUSY;
+
+
+    /*******************************************************************************/
+    case RFAL_ST25TB_CR_GET_UID:
+
+      EXIT_ON_BUSY(ret, rfalSt25tbPollerGetUIDStatus());
+
+      if (ret == ERR_NONE) {
+        (*gRfalSt25tb.CR.devCnt)++;
+      }
+
+      rfalSt25tbPollerNextSlot();
+      return ERR_BUSY;
+
+
+    /*******************************************************************************/
+    case RFAL_ST25TB_CR_END:
+    default:
+      /* MISRA 16.4: no empty default statement (a comment being enough) */
+      break;
   }
 
   return ERR_NONE;
@@ -409,96 +698,279 @@ ReturnCode RfalNfcClass::rfalSt25tbPollerCollisionResolution(uint8_t devLimit, r
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalSt25tbPollerReadBlock(uint8_t blockAddress, rfalSt25tbBlock *blockData)
 {
-  ReturnCode             ret;
-  uint16_t               rxLen;
-  rfalSt25tbReadBlockReq readBlockReq;
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartReadBlock(blockAddress, blockData));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetReadBlockStatus());
+
+  return ret;
+}
+
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartReadBlock(uint8_t blockAddress, rfalSt25tbBlock *blockData)
+{
+  rfalSt25tbReadBlockReq readBlockReq;
 
   /* Compute Read Block Request */
   readBlockReq.cmd     = RFAL_ST25TB_READ_BLOCK_CMD;
   readBlockReq.address = blockAddress;
 
   /* Send Read Block Request */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&readBlockReq, sizeof(rfalSt25tbReadBlockReq), (uint8_t *)blockData, sizeof(rfalSt25tbBlock), &rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  return rfalSt25tbPollerStartTxRx((uint8_t *)&readBlockReq, sizeof(rfalSt25tbReadBlockReq), (uint8_t *)blockData, RFAL_ST25TB_BLOCK_LEN, RFAL_ST25TB_FWT);
+}
 
-  /* Check for valid UID Response */
-  if ((ret == ERR_NONE) && (rxLen != RFAL_ST25TB_BLOCK_LEN)) {
-    return ERR_PROTO;
-  }
 
-  return ret;
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetReadBlockStatus(void)
+{
+  return rfalSt25tbPollerGetTxRxStatus();
 }
 
 
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalSt25tbPollerWriteBlock(uint8_t blockAddress, const rfalSt25tbBlock *blockData)
 {
-  ReturnCode              ret;
-  uint16_t                rxLen;
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartWriteBlock(blockAddress, blockData));
+  rfalRunBlocking(ret, rfalSt25tbPollerGetWriteBlockStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartWriteBlock(uint8_t blockAddress, const rfalSt25tbBlock *blockData)
+{
   rfalSt25tbWriteBlockReq writeBlockReq;
-  rfalSt25tbBlock         tmpBlockData;
 
+  if (blockData == NULL) {
+    return ERR_PARAM;
+  }
 
   /* Compute Write Block Request */
   writeBlockReq.cmd     = RFAL_ST25TB_WRITE_BLOCK_CMD;
   writeBlockReq.address = blockAddress;
   ST_MEMCPY(&writeBlockReq.data, blockData, RFAL_ST25TB_BLOCK_LEN);
 
+  /* Keep the data to be verified once programmed */
+  gRfalSt25tb.TR.address = blockAddress;
+  ST_MEMCPY(gRfalSt25tb.TR.wrData, blockData, RFAL_ST25TB_BLOCK_LEN);
+  gRfalSt25tb.TR.wrState = RFAL_ST25TB_WR_WRITE;
+
   /* Send Write Block Request */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&writeBlockReq, sizeof(rfalSt25tbWriteBlockReq), tmpBlockData, RFAL_ST25TB_BLOCK_LEN, &rxLen, RFAL_TXRX_FLAGS_DEFAULT, (RFAL_ST25TB_FWT + RFAL_ST25TB_TW));
+  return rfalSt25tbPollerStartTxRx((uint8_t *)&writeBlockReq, sizeof(rfalSt25tbWriteBlockReq), NULL, 0, (RFAL_ST25TB_FWT + RFAL_ST25TB_TW));
+}
 
-  /* Check if there was any error besides timeout */
-  if (ret != ERR_TIMEOUT) {
-    /* Check if an unexpected answer was received */
-    if (ret == ERR_NONE) {
-      return ERR_PROTO;
-    }
 
-    /* Check whether a transmission error occurred */
-    if ((ret != ERR_CRC) && (ret != ERR_FRAMING) && (ret != ERR_NOMEM) && (ret != ERR_RF_COLLISION)) {
-      return ret;
-    }
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetWriteBlockStatus(void)
+{
+  ReturnCode ret;
 
-    /* If a transmission error occurred (maybe noise while committing data) wait maximum programming time and verify data afterwards */
-    rfalRfDev->rfalSetGT((RFAL_ST25TB_FWT + RFAL_ST25TB_TW));
-    rfalRfDev->rfalFieldOnAndStartGT();
+  switch (gRfalSt25tb.TR.wrState) {
+    /*******************************************************************************/
+    case RFAL_ST25TB_WR_WRITE:
 
-  }
+      EXIT_ON_BUSY(ret, rfalRfDev->rfalGetTransceiveStatus());
 
-  ret = rfalSt25tbPollerReadBlock(blockAddress, &tmpBlockData);
-  if (ret == ERR_NONE) {
-    if (ST_BYTECMP(&tmpBlockData, blockData, RFAL_ST25TB_BLOCK_LEN) == 0) {
-      return ERR_NONE;
-    }
-    return ERR_PROTO;
+      /* Check if there was any error besides timeout */
+      if (ret != ERR_TIMEOUT) {
+        /* Check if an unexpected answer was received */
+        if (ret == ERR_NONE) {
+          return ERR_PROTO;
+        }
+
+        /* Check whether a transmission error occurred */
+        if ((ret != ERR_CRC) && (ret != ERR_FRAMING) && (ret != ERR_NOMEM) && (ret != ERR_RF_COLLISION)) {
+          return ret;
+        }
+
+        /* If a transmission error occurred (maybe noise while committing data) wait maximum programming time and verify data afterwards */
+        rfalRfDev->rfalSetGT((RFAL_ST25TB_FWT + RFAL_ST25TB_TW));
+        rfalRfDev->rfalFieldOnAndStartGT();
+      }
+
+      gRfalSt25tb.TR.wrState = RFAL_ST25TB_WR_GT;
+      return ERR_BUSY;
+
+
+    /*******************************************************************************/
+    case RFAL_ST25TB_WR_GT:
+
+      if (!rfalRfDev->rfalIsGTExpired()) {
+        return ERR_BUSY;
+      }
+
+      EXIT_ON_ERR(ret, rfalSt25tbPollerStartReadBlock(gRfalSt25tb.TR.address, NULL));
+
+      gRfalSt25tb.TR.wrState = RFAL_ST25TB_WR_VERIFY;
+      return ERR_BUSY;
+
+
+    /*******************************************************************************/
+    case RFAL_ST25TB_WR_VERIFY:
+    default:
+
+      EXIT_ON_BUSY(ret, rfalSt25tbPollerGetReadBlockStatus());
+
+      if (ret == ERR_NONE) {
+        if (ST_BYTECMP(gRfalSt25tb.TR.rxBuf, gRfalSt25tb.TR.wrData, RFAL_ST25TB_BLOCK_LEN) == 0) {
+          return ERR_NONE;
+        }
+        return ERR_PROTO;
+      }
+      return ret;
   }
-  return ret;
 }
 
 
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalSt25tbPollerCompletion(void)
 {
-  uint8_t  completionReq;
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartCompletion());
+  rfalRunBlocking(ret, rfalSt25tbPollerGetCompletionStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartCompletion(void)
+{
+  uint8_t completionReq;
 
   /* Compute Completion Request */
   completionReq = RFAL_ST25TB_COMPLETION_CMD;
 
   /* Send Completion Request, no response is expected */
-  return rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&completionReq, RFAL_ST25TB_CMD_LEN, NULL, 0, NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  return rfalRfDev->rfalTransceiveBlockingTx(&completionReq, RFAL_ST25TB_CMD_LEN, NULL, 0, NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetCompletionStatus(void)
+{
+  return rfalRfDev->rfalGetTransceiveStatus();
 }
 
 
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalSt25tbPollerResetToInventory(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalSt25tbPollerStartResetToInventory());
+  rfalRunBlocking(ret, rfalSt25tbPollerGetResetToInventoryStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerStartResetToInventory(void)
 {
   uint8_t resetInvReq;
 
-  /* Compute Completion Request */
+  /* Compute Reset to Inventory Request */
   resetInvReq = RFAL_ST25TB_RESET_INV_CMD;
 
-  /* Send Completion Request, no response is expected */
-  return rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&resetInvReq, RFAL_ST25TB_CMD_LEN, NULL, 0, NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+  /* Send Reset to Inventory Request, no response is expected */
+  return rfalRfDev->rfalTransceiveBlockingTx(&resetInvReq, RFAL_ST25TB_CMD_LEN, NULL, 0, NULL, RFAL_TXRX_FLAGS_DEFAULT, RFAL_ST25TB_FWT);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerGetResetToInventoryStatus(void)
+{
+  return rfalRfDev->rfalGetTransceiveStatus();
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerReadBlocks(uint8_t firstBlock, uint16_t numBlocks, uint8_t *buf, uint16_t bufLen, rfalSt25tbBatchStats *stats)
+{
+  ReturnCode           ret;
+  uint16_t             i;
+  uint32_t             startTime;
+  rfalSt25tbBatchStats st;
+
+  if ((buf == NULL) || (numBlocks == 0U) || (((uint16_t)firstBlock + numBlocks) > 256U) || (bufLen < (numBlocks * RFAL_ST25TB_BLOCK_LEN))) {
+    return ERR_PARAM;
+  }
+
+  ST_MEMSET(&st, 0x00, sizeof(rfalSt25tbBatchStats));
+  startTime = micros();
+  ret       = ERR_NONE;
+
+  /* One blocking Read Block per block, each response lands in place in the image */
+  for (i = 0; i < numBlocks; i++) {
+    ret = rfalSt25tbPollerBatchReadBlock((uint8_t)(firstBlock + i), &buf[i * RFAL_ST25TB_BLOCK_LEN], &st);
+    if (ret != ERR_NONE) {
+      break;
+    }
+    st.blocks++;
+  }
+
+  if (stats != NULL) {
+    rfalSt25tbPollerBatchStats(&st, startTime);
+    (*stats) = st;
+  }
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalSt25tbPollerWriteBlocks(uint8_t firstBlock, uint16_t numBlocks, const uint8_t *data, uint16_t dataLen, bool verify, rfalSt25tbBatchStats *stats)
+{
+  ReturnCode           ret;
+  uint16_t             i;
+  uint32_t             startTime;
+  rfalSt25tbBlock      tmpBlockData;
+  rfalSt25tbBatchStats st;
+
+  if ((data == NULL) || (numBlocks == 0U) || (((uint16_t)firstBlock + numBlocks) > 256U) || (dataLen < (numBlocks * RFAL_ST25TB_BLOCK_LEN))) {
+    return ERR_PARAM;
+  }
+
+  ST_MEMSET(&st, 0x00, sizeof(rfalSt25tbBatchStats));
+  startTime = micros();
+  ret       = ERR_NONE;
+
+  /* Write all blocks first, each one only waiting tW */
+  for (i = 0; i < numBlocks; i++) {
+    ret = rfalSt25tbPollerBatchWriteBlock((uint8_t)(firstBlock + i), &data[i * RFAL_ST25TB_BLOCK_LEN], &st);
+    if (ret != ERR_NONE) {
+      break;
+    }
+    st.blocks++;
+  }
+
+  /* Then read them back in a row */
+  if ((ret == ERR_NONE) && verify) {
+    for (i = 0; i < numBlocks; i++) {
+      ret = rfalSt25tbPollerBatchReadBlock((uint8_t)(firstBlock + i), tmpBlockData, &st);
+      if (ret != ERR_NONE) {
+        break;
+      }
+
+      if (ST_BYTECMP(tmpBlockData, &data[i * RFAL_ST25TB_BLOCK_LEN], RFAL_ST25TB_BLOCK_LEN) != 0) {
+        ret = ERR_PROTO;
+        break;
+      }
+    }
+  }
+
+  if (stats != NULL) {
+    rfalSt25tbPollerBatchStats(&st, startTime);
+    (*stats) = st;
+  }
+
+  return ret;
 }
 
-#endif /* RFAL_FEATURE_ST25TB */
\ No newline at end of file
+#endif /* RFAL_FEATURE_ST25TB */
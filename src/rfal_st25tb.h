@@ -71,6 +71,11 @@
 #define RFAL_ST25TB_CRC_LEN          2U       /*!< ST25TB CRC length           */
 #define RFAL_ST25TB_UID_LEN          8U       /*!< ST25TB Unique ID length     */
 #define RFAL_ST25TB_BLOCK_LEN        4U       /*!< ST25TB Data Block length    */
+#define RFAL_ST25TB_SYSTEM_BLOCK     0xFFU    /*!< ST25TB System area address  */
+
+#ifndef RFAL_ST25TB_BATCH_RETRIES
+  #define RFAL_ST25TB_BATCH_RETRIES  2U       /*!< Batch access retries of a block after a transmission error */
+#endif
 
 /*
 ******************************************************************************
@@ -97,6 +102,68 @@ typedef struct {
 } rfalSt25tbListenDevice;
 
 
+/*! ST25TB batch block access statistics                                                          */
+typedef struct {
+  uint16_t              blocks;          /*!< Blocks transferred                                  */
+  uint16_t              retries;         /*!< Block commands repeated after a transmission error  */
+  uint32_t              duration;        /*!< Overall transfer duration (us)                      */
+  uint32_t              bytesPerSec;     /*!< Sustained throughput (bytes/s)                      */
+} rfalSt25tbBatchStats;
+
+
+/*! ST25TB Write Block states                                                                      */
+typedef enum {
+  RFAL_ST25TB_WR_WRITE,                  /*!< Write Block sent, waiting for the programming time  */
+  RFAL_ST25TB_WR_GT,                     /*!< Transmission error, waiting max programming time    */
+  RFAL_ST25TB_WR_VERIFY                  /*!< Read Block sent to verify the written data          */
+} rfalSt25tbWriteState;
+
+
+/*! ST25TB command context (non-blocking commands)                                                 */
+typedef struct {
+  uint8_t               rxBuf[RFAL_ST25TB_UID_LEN + RFAL_ST25TB_CRC_LEN]; /*!< Response buffer (CRC kept on short frames) */
+  uint16_t              rxLen;           /*!< Received length                                     */
+  uint8_t              *rxData;          /*!< Location of the caller's response data              */
+  uint16_t              rxDataLen;       /*!< Expected response length                            */
+  uint8_t               chipId;          /*!< Chip ID expected in the Select response             */
+  uint8_t               address;         /*!< Block address being written                         */
+  rfalSt25tbBlock       wrData;          /*!< Block data being written                            */
+  rfalSt25tbWriteState  wrState;         /*!< Write Block state                                   */
+} rfalSt25tbTxRxParams;
+
+
+/*! ST25TB Collision Resolution states                                                             */
+typedef enum {
+  RFAL_ST25TB_CR_INITIATE,               /*!< Initiate sent, waiting for a single chip ID         */
+  RFAL_ST25TB_CR_SLOT_TX,                /*!< Waiting t2 before the Pcall16 or Slot Marker        */
+  RFAL_ST25TB_CR_SLOT,                   /*!< Pcall16 or Slot Marker sent, waiting for a chip ID  */
+  RFAL_ST25TB_CR_SELECT,                 /*!< Select sent to the device found                     */
+  RFAL_ST25TB_CR_GET_UID,                /*!< Get UID sent to the selected device                 */
+  RFAL_ST25TB_CR_END                     /*!< State for terminating the collision resolution      */
+} rfalSt25tbColResState;
+
+
+/*! ST25TB Collision Resolution context                                                            */
+typedef struct {
+  uint8_t                 devLimit;      /*!< Device limit to be used                             */
+  rfalSt25tbListenDevice *st25tbDevList; /*!< Location of the device list                         */
+  uint8_t                *devCnt;        /*!< Location of the device counter                      */
+  uint8_t                 chipId;        /*!< Chip ID received                                    */
+  uint8_t                 curSlotNum;    /*!< Current Slot number (within slotted loop)           */
+  bool                    slotted;       /*!< Slotted loop started (Initiate step done)           */
+  bool                    colPend;       /*!< Collision detected in the current slotted loop      */
+  uint32_t                tmr;           /*!< t2 timer                                            */
+  rfalSt25tbColResState   state;         /*!< Collision Resolution state                          */
+} rfalSt25tbColResParams;
+
+
+/*! RFAL ST25TB instance */
+typedef struct {
+  rfalSt25tbTxRxParams    TR;            /*!< Command in progress  */
+  rfalSt25tbColResParams  CR;            /*!< Collision Resolution */
+} rfalSt25tb;
+
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
@@ -84,6 +84,9 @@
 #define RFAL_NFCV_FLAG_POS                0U     /*!< Flag byte position                                                */
 #define RFAL_NFCV_FLAG_LEN                1U     /*!< Flag byte length                                                  */
 
+#define RFAL_ST25xV_MB_STREAM_TXBUF_LEN  (RFAL_NFCV_FLAG_LEN + 1U + 1U + RFAL_NFCV_UID_LEN + 1U + RFAL_ST25DV_MB_LEN)  /*!< Write Message: Flags, CMD, Mfg Code, UID, MSGLen, Data */
+#define RFAL_ST25xV_MB_STREAM_RXBUF_LEN  (RFAL_NFCV_FLAG_LEN + RFAL_ST25DV_MB_LEN + RFAL_NFCV_CRC_LEN)               /*!< Read Message response: Flags, Data, CRC                 */
+
 /*
 ******************************************************************************
 * LOCAL FUNCTIONS
@@ -243,6 +246,38 @@ ReturnCode RfalNfcClass::rfalST25xVPollerGenericWriteMessage(uint8_t cmd, uint8_
   return ERR_NONE;
 }
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalST25xVPollerMbWaitStatus(uint8_t flags, const uint8_t *uid, uint8_t mask, uint8_t value, uint16_t timeout, uint16_t *polls)
+{
+  ReturnCode ret;
+  uint8_t    mbCtrl;
+  uint32_t   tmr;
+
+  tmr = timerCalculateTimer(timeout);
+
+  do {
+    EXIT_ON_ERR(ret, rfalST25xVPollerFastReadDynamicConfiguration(flags, uid, RFAL_ST25DV_MB_CTRL_DYN_REG, &mbCtrl));
+    (*polls)++;
+
+    if ((mbCtrl & RFAL_ST25DV_MB_CTRL_MB_EN) == 0U) {
+      return ERR_DISABLED;                                /* Mailbox has been disabled meanwhile */
+    }
+
+    if ((mbCtrl & mask) == value) {
+      return ERR_NONE;
+    }
+  } while (!timerIsExpired(tmr));
+
+  return ERR_TIMEOUT;
+}
+
+/*******************************************************************************/
+void RfalNfcClass::rfalST25xVPollerMbStreamStats(rfalST25xVMbStreamStats *stats, uint32_t startTime)
+{
+  stats->duration    = (millis() - startTime);
+  stats->bytesPerSec = ((stats->duration != 0U) ? (uint32_t)(((uint64_t)stats->bytes * 1000U) / stats->duration) : 0U);
+}
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -521,5 +556,142 @@ ReturnCode RfalNfcClass::rfalST25xVPollerFastReadMessage(uint8_t flags, const ui
   return rfalST25xVPollerGenericReadMessage(RFAL_NFCV_CMD_FAST_READ_MESSAGE, flags, uid, mbPointer, numBytes, rxBuf, rxBufLen, rcvLen);
 }
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalST25xVPollerMbStreamWrite(uint8_t flags, const uint8_t *uid, const uint8_t *data, uint32_t dataLen, uint16_t timeout, rfalST25xVMbStreamStats *stats)
+{
+  ReturnCode              ret;
+  uint32_t                pos;
+  uint16_t                chunkLen;
+  uint32_t                startTime;
+  uint8_t                 msg[RFAL_ST25DV_MB_LEN];
+  uint8_t                 txBuf[RFAL_ST25xV_MB_STREAM_TXBUF_LEN];
+  rfalST25xVMbStreamStats st;
+
+  if ((data == NULL) || (dataLen == 0U) || (dataLen >= RFAL_ST25DV_MB_STREAM_LEN_UNKNOWN)) {
+    return ERR_PARAM;
+  }
+
+  ST_MEMSET(&st, 0x00, sizeof(rfalST25xVMbStreamStats));
+  startTime = millis();
+  ret       = ERR_NONE;
+  pos       = 0U;
+
+  while (pos < dataLen) {
+    /* RF may only put a message once the host has read the previous one (RF_PUT_MSG cleared) */
+    ret = rfalST25xVPollerMbWaitStatus(flags, uid, (RFAL_ST25DV_MB_CTRL_HOST_PUT_MSG | RFAL_ST25DV_MB_CTRL_RF_PUT_MSG), 0x00U, timeout, &st.statusPolls);
+    if (ret != ERR_NONE) {
+      break;
+    }
+
+    /* MSGLength is the number of Data bytes minus 1 */
+    if (pos == 0U) {
+      /* First message starts with the stream header: total payload length */
+      chunkLen = (uint16_t)MIN(dataLen, (RFAL_ST25DV_MB_LEN - RFAL_ST25DV_MB_STREAM_HDR_LEN));
+      msg[0] = (uint8_t)(dataLen >> 24U);
+      msg[1] = (uint8_t)(dataLen >> 16U);
+      msg[2] = (uint8_t)(dataLen >> 8U);
+      msg[3] = (uint8_t)(dataLen);
+      ST_MEMCPY(&msg[RFAL_ST25DV_MB_STREAM_HDR_LEN], data, chunkLen);
+
+      ret = rfalST25xVPollerFastWriteMessage(flags, uid, (uint8_t)((chunkLen + RFAL_ST25DV_MB_STREAM_HDR_LEN) - 1U), msg, txBuf, sizeof(txBuf));
+    } else {
+      chunkLen = (uint16_t)MIN((dataLen - pos), RFAL_ST25DV_MB_LEN);
+
+      ret = rfalST25xVPollerFastWriteMessage(flags, uid, (uint8_t)(chunkLen - 1U), &data[pos], txBuf, sizeof(txBuf));
+    }
+    if (ret != ERR_NONE) {
+      break;
+    }
+
+    pos += chunkLen;
+    st.bytes += chunkLen;
+    st.messages++;
+  }
+
+  if (stats != NULL) {
+    rfalST25xVPollerMbStreamStats(&st, startTime);
+    (*stats) = st;
+  }
+
+  return ret;
+}
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalST25xVPollerMbStreamRead(uint8_t flags, const uint8_t *uid, uint8_t *buf, uint32_t bufLen, uint32_t *rcvdLen, uint16_t timeout, rfalST25xVMbStreamStats *stats)
+{
+  ReturnCode              ret;
+  uint16_t                rcvLen;
+  uint16_t                msgLen;
+  uint16_t                cpyLen;
+  uint32_t                startTime;
+  uint32_t                totalLen;
+  const uint8_t          *msg;
+  bool                    lastFull;
+  uint8_t                 rxBuf[RFAL_ST25xV_MB_STREAM_RXBUF_LEN];
+  rfalST25xVMbStreamStats st;
+
+  if ((buf == NULL) || (bufLen == 0U) || (rcvdLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  ST_MEMSET(&st, 0x00, sizeof(rfalST25xVMbStreamStats));
+  startTime = millis();
+  ret       = ERR_NONE;
+  totalLen  = RFAL_ST25DV_MB_STREAM_LEN_UNKNOWN;
+  lastFull  = false;
+
+  do {
+    /* Wait until the host has put a message */
+    ret = rfalST25xVPollerMbWaitStatus(flags, uid, RFAL_ST25DV_MB_CTRL_HOST_PUT_MSG, RFAL_ST25DV_MB_CTRL_HOST_PUT_MSG, timeout, &st.statusPolls);
+    if ((ret == ERR_TIMEOUT) && (totalLen == RFAL_ST25DV_MB_STREAM_LEN_UNKNOWN) && lastFull) {
+      ret = ERR_NONE;                                      /* Length unknown and no message after a full one: end of stream */
+      break;
+    }
+    if (ret != ERR_NONE) {
+      break;
+    }
+
+    /* MBPointer and Number of bytes set to 00h return the full message, no need to read MB_LEN_Dyn */
+    ret = rfalST25xVPollerFastReadMessage(flags, uid, 0x00U, 0x00U, rxBuf, sizeof(rxBuf), &rcvLen);
+    if (ret != ERR_NONE) {
+      break;
+    }
+
+    msg      = &rxBuf[RFAL_NFCV_FLAG_LEN];
+    msgLen   = (rcvLen - RFAL_NFCV_FLAG_LEN);
+    lastFull = (msgLen == RFAL_ST25DV_MB_LEN);
+
+    /* First message starts with the stream header: total payload length */
+    if (st.messages == 0U) {
+      if (msgLen < RFAL_ST25DV_MB_STREAM_HDR_LEN) {
+        ret = ERR_PROTO;
+        break;
+      }
+      totalLen = GETU32(msg);
+      msg     += RFAL_ST25DV_MB_STREAM_HDR_LEN;
+      msgLen  -= RFAL_ST25DV_MB_STREAM_HDR_LEN;
+    }
+
+    cpyLen = (uint16_t)MIN(msgLen, (bufLen - st.bytes));
+    ST_MEMCPY(&buf[st.bytes], msg, cpyLen);
+
+    st.bytes += cpyLen;
+    st.messages++;
+
+    if (cpyLen < msgLen) {
+      ret = ERR_NOMEM;                                     /* Message did not fit in the remaining buffer */
+      break;
+    }
+  } while ((totalLen == RFAL_ST25DV_MB_STREAM_LEN_UNKNOWN) ? lastFull : (st.bytes < totalLen));   /* Announced length received, or a non full message ends a stream of unknown length */
+
+  *rcvdLen = st.bytes;
+
+  if (stats != NULL) {
+    rfalST25xVPollerMbStreamStats(&st, startTime);
+    (*stats) = st;
+  }
+
+  return ret;
+}
 
 #endif /* RFAL_FEATURE_ST25xV */
\ No newline at end of file
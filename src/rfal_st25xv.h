@@ -51,8 +51,9 @@
  ******************************************************************************
  */
 #include "st_errno.h"
-#include "rfal_nfc.h"
+#include "rfal_config.h"
 #include "rfal_rf.h"
+#include "rfal_nfcv.h"
 
 /*
 ******************************************************************************
@@ -73,6 +74,35 @@
 
 #define RFAL_NFCV_BLOCKNUM_M24LR_LEN       2U      /*!< Block Number length of MR24LR tags: 16 bits                */
 
+#define RFAL_ST25DV_MB_LEN                 256U    /*!< ST25DV Fast Transfer Mode Mailbox length                   */
+#define RFAL_ST25DV_MB_CTRL_DYN_REG        0x0DU   /*!< MB_CTRL_Dyn dynamic register pointer                       */
+
+#define RFAL_ST25DV_MB_CTRL_MB_EN          0x01U   /*!< MB_CTRL_Dyn: Mailbox enabled                               */
+#define RFAL_ST25DV_MB_CTRL_HOST_PUT_MSG   0x02U   /*!< MB_CTRL_Dyn: Message put by host, not yet read by RF      */
+#define RFAL_ST25DV_MB_CTRL_RF_PUT_MSG     0x04U   /*!< MB_CTRL_Dyn: Message put by RF, not yet read by host      */
+#define RFAL_ST25DV_MB_CTRL_HOST_MISS_MSG  0x10U   /*!< MB_CTRL_Dyn: Host message not read by RF before watchdog   */
+#define RFAL_ST25DV_MB_CTRL_RF_MISS_MSG    0x20U   /*!< MB_CTRL_Dyn: RF message not read by host before watchdog   */
+
+#define RFAL_ST25DV_MB_STREAM_TIMEOUT      1000U   /*!< Default time (ms) to wait for the host per Mailbox message */
+#define RFAL_ST25DV_MB_STREAM_HDR_LEN      4U      /*!< Stream header: total payload length, Big Endian, in the first message */
+#define RFAL_ST25DV_MB_STREAM_LEN_UNKNOWN  0xFFFFFFFFUL /*!< Stream header length when the host does not know it in advance */
+
+
+/*
+******************************************************************************
+* GLOBAL TYPES
+******************************************************************************
+*/
+
+/*! ST25DV Mailbox stream statistics                                                      */
+typedef struct {
+  uint32_t                bytes;           /*!< Payload bytes transferred                     */
+  uint16_t                messages;        /*!< Mailbox messages transferred                  */
+  uint16_t                statusPolls;     /*!< MB_CTRL_Dyn reads while waiting for the host  */
+  uint32_t                duration;        /*!< Overall transfer duration (ms)                */
+  uint32_t                bytesPerSec;     /*!< Sustained throughput (bytes/s)                */
+} rfalST25xVMbStreamStats;
+
 
 
 #endif /* RFAL_ST25xV_H */
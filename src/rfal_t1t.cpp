@@ -105,6 +105,22 @@ typedef struct {
   uint8_t data;                              /*!< DAT                       */
 } rfalT1TWriteRes;
 
+
+/*! NFC-A T1T (Topaz) RSEG_REQ, READ8_REQ, WRITE-E8_REQ and WRITE-NE8_REQ   T1T 1.2  Table 5 */
+typedef struct {
+  uint8_t cmd;                               /*!< T1T cmd                   */
+  uint8_t add;                               /*!< ADDS or ADD8              */
+  uint8_t data[RFAL_T1T_BLOCK_LEN];          /*!< DATA (0x00 for reads)     */
+  uint8_t uid[RFAL_T1T_UID_LEN];             /*!< UID                       */
+} rfalT1TBlockReq;
+
+
+/*! NFC-A T1T (Topaz) READ8_RES, WRITE-E8_RES and WRITE-NE8_RES   T1T 1.2  Table 5 */
+typedef struct {
+  uint8_t add;                               /*!< ADD8                      */
+  uint8_t data[RFAL_T1T_BLOCK_LEN];          /*!< DATA                      */
+} rfalT1TBlockRes;
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTIONS
@@ -129,9 +145,19 @@ ReturnCode RfalNfcClass::rfalT1TPollerInitialize(void)
 /*******************************************************************************/
 ReturnCode RfalNfcClass::rfalT1TPollerRid(rfalT1TRidRes *ridRes)
 {
-  ReturnCode     ret;
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalT1TPollerStartRid(ridRes));
+  rfalRunBlocking(ret, rfalT1TPollerGetRidStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT1TPollerStartRid(rfalT1TRidRes *ridRes)
+{
   rfalT1TRidReq  ridReq;
-  uint16_t       rcvdLen;
 
   if (ridRes == NULL) {
     return ERR_PARAM;
@@ -141,10 +167,27 @@ ReturnCode RfalNfcClass::rfalT1TPollerRid(rfalT1TRidRes *ridRes)
   ST_MEMSET(&ridReq, 0x00, sizeof(rfalT1TRidReq));
   ridReq.cmd = (uint8_t)RFAL_T1T_CMD_RID;
 
-  EXIT_ON_ERR(ret, rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&ridReq, sizeof(rfalT1TRidReq), (uint8_t *)ridRes, sizeof(rfalT1TRidRes), &rcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ));
+  gRfalT1T.ridRes = ridRes;
+
+  return rfalRfDev->rfalTransceiveBlockingTx((uint8_t *)&ridReq, sizeof(rfalT1TRidReq), (uint8_t *)ridRes, sizeof(rfalT1TRidRes), &gRfalT1T.rxLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT1TPollerGetRidStatus(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_BUSY(ret, rfalRfDev->rfalGetTransceiveStatus());
+  if (ret != ERR_NONE) {
+    return ret;
+  }
+
+  /* Convert bits to bytes */
+  gRfalT1T.rxLen = rfalConvBitsToBytes(gRfalT1T.rxLen);
 
   /* Check expected RID response length and the HR0   Digital 2.0 (Candidate) 11.6.2.1 */
-  if ((rcvdLen != sizeof(rfalT1TRidRes)) || ((ridRes->hr0 & RFAL_T1T_RID_RES_HR0_MASK) != RFAL_T1T_RID_RES_HR0_VAL)) {
+  if ((gRfalT1T.rxLen != sizeof(rfalT1TRidRes)) || ((gRfalT1T.ridRes->hr0 & RFAL_T1T_RID_RES_HR0_MASK) != RFAL_T1T_RID_RES_HR0_VAL)) {
     return ERR_PROTO;
   }
 
@@ -198,4 +241,96 @@ ReturnCode RfalNfcClass::rfalT1TPollerWrite(const uint8_t *uid, uint8_t address,
 }
 
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT1TPollerRseg(const uint8_t *uid, uint8_t segment, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rxRcvdLen)
+{
+  rfalT1TBlockReq rsegReq;
+
+  if ((rxBuf == NULL) || (uid == NULL) || (rxRcvdLen == NULL)) {
+    return ERR_PARAM;
+  }
+
+  /* Compute RSEG command: segment on the upper nibble of ADDS, data set to 0x00 */
+  ST_MEMSET(&rsegReq, 0x00, sizeof(rfalT1TBlockReq));
+  rsegReq.cmd = (uint8_t)RFAL_T1T_CMD_RSEG;
+  rsegReq.add = (uint8_t)(segment << 4U);
+  ST_MEMCPY(rsegReq.uid, uid, RFAL_T1T_UID_LEN);
+
+  return rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&rsegReq, sizeof(rfalT1TBlockReq), rxBuf, rxBufLen, rxRcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT1TPollerRead8(const uint8_t *uid, uint8_t block, uint8_t *data)
+{
+  rfalT1TBlockReq readReq;
+  rfalT1TBlockRes readRes;
+  uint16_t        rxRcvdLen;
+  ReturnCode      err;
+
+  if ((uid == NULL) || (data == NULL)) {
+    return ERR_PARAM;
+  }
+
+  ST_MEMSET(&readReq, 0x00, sizeof(rfalT1TBlockReq));
+  readReq.cmd = (uint8_t)RFAL_T1T_CMD_READ8;
+  readReq.add = block;
+  ST_MEMCPY(readReq.uid, uid, RFAL_T1T_UID_LEN);
+
+  err = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&readReq, sizeof(rfalT1TBlockReq), (uint8_t *)&readRes, sizeof(rfalT1TBlockRes), &rxRcvdLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_T1T_DRD_READ);
+
+  if (err == ERR_NONE) {
+    if ((readRes.add != block) || (rxRcvdLen != sizeof(rfalT1TBlockRes))) {
+      return ERR_PROTO;
+    }
+    ST_MEMCPY(data, readRes.data, RFAL_T1T_BLOCK_LEN);
+  }
+  return err;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT1TPollerWriteBlock(const uint8_t *uid, uint8_t block, const uint8_t *data, bool erase)
+{
+  rfalT1TBlockReq writeReq;
+  rfalT1TBlockRes writeRes;
+  uint16_t        rxRcvdLen;
+  ReturnCode      err;
+
+  if ((uid == NULL) || (data == NULL)) {
+    return ERR_PARAM;
+  }
+
+  writeReq.cmd = (uint8_t)(erase ? RFAL_T1T_CMD_WRITE_E8 : RFAL_T1T_CMD_WRITE_NE8);
+  writeReq.add = block;
+  ST_MEMCPY(writeReq.data, data, RFAL_T1T_BLOCK_LEN);
+  ST_MEMCPY(writeReq.uid, uid, RFAL_T1T_UID_LEN);
+
+  err = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&writeReq, sizeof(rfalT1TBlockReq), (uint8_t *)&writeRes, sizeof(rfalT1TBlockRes), &rxRcvdLen,
+                                              RFAL_TXRX_FLAGS_DEFAULT, (erase ? RFAL_T1T_DRD_WRITE_E : RFAL_T1T_DRD_WRITE));
+
+  if (err == ERR_NONE) {
+    /* WRITE-E8 echoes the written data, WRITE-NE8 the resulting OR of old and new data */
+    if ((writeRes.add != block) || (rxRcvdLen != sizeof(rfalT1TBlockRes)) || (erase && (ST_BYTECMP(writeRes.data, data, RFAL_T1T_BLOCK_LEN) != 0))) {
+      return ERR_PROTO;
+    }
+  }
+  return err;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT1TPollerWriteE8(const uint8_t *uid, uint8_t block, const uint8_t *data)
+{
+  return rfalT1TPollerWriteBlock(uid, block, data, true);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT1TPollerWriteNE8(const uint8_t *uid, uint8_t block, const uint8_t *data)
+{
+  return rfalT1TPollerWriteBlock(uid, block, data, false);
+}
+
+
 #endif /* RFAL_FEATURE_T1T */
\ No newline at end of file
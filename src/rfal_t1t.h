@@ -74,6 +74,11 @@
 
 #define RFAL_T1T_HR0_NDEF_MASK      0xF0   /*!< T1T HR0 NDEF capability mask  T1T 1.2 2.2.2 */
 #define RFAL_T1T_HR0_NDEF_SUPPORT   0x10   /*!< T1T HR0 NDEF capable value    T1T 1.2 2.2.2 */
+#define RFAL_T1T_HR0_DYNAMIC_MEM   0x02   /*!< T1T HR0 low nibble of a dynamic memory tag  */
+
+#define RFAL_T1T_BLOCK_LEN             8   /*!< T1T block length (READ8, WRITE-E8, WRITE-NE8) */
+#define RFAL_T1T_SEGMENT_LEN         128   /*!< T1T segment length (RSEG): 16 blocks         */
+#define RFAL_T1T_STATIC_MEM_LEN      120   /*!< T1T static memory length (RALL): 15 blocks   */
 
 
 /*! NFC-A T1T (Topaz) command set */
@@ -82,7 +87,11 @@ typedef enum {
   RFAL_T1T_CMD_RALL     = 0x00,          /*!< T1T Read All                                */
   RFAL_T1T_CMD_READ     = 0x01,          /*!< T1T Read                                    */
   RFAL_T1T_CMD_WRITE_E  = 0x53,          /*!< T1T Write with erase (single byte)          */
-  RFAL_T1T_CMD_WRITE_NE = 0x1A           /*!< T1T Write with no erase (single byte)       */
+  RFAL_T1T_CMD_WRITE_NE = 0x1A,          /*!< T1T Write with no erase (single byte)       */
+  RFAL_T1T_CMD_RSEG     = 0x10,          /*!< T1T Read segment (dynamic memory)           */
+  RFAL_T1T_CMD_READ8    = 0x02,          /*!< T1T Read block (dynamic memory)             */
+  RFAL_T1T_CMD_WRITE_E8 = 0x54,          /*!< T1T Write block with erase (dynamic memory) */
+  RFAL_T1T_CMD_WRITE_NE8 = 0x1B          /*!< T1T Write block with no erase (dyn. memory) */
 } rfalT1Tcmds;
 
 
@@ -100,6 +109,13 @@ typedef struct {
   uint8_t uid[RFAL_T1T_UID_LEN];         /*!< T1T UID                                     */
 } rfalT1TRidRes;
 
+
+/*! RFAL T1T instance */
+typedef struct {
+  rfalT1TRidRes *ridRes;                 /*!< Location of the RID_RES in progress         */
+  uint16_t       rxLen;                  /*!< Received length                             */
+} rfalT1T;
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES
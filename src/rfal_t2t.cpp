@@ -123,7 +123,18 @@ typedef struct {
 
 ReturnCode RfalNfcClass::rfalT2TPollerRead(uint8_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
 {
-  ReturnCode      ret;
+  ReturnCode ret;
+
+  EXIT_ON_ERR(ret, rfalT2TPollerStartRead(blockNum, rxBuf, rxBufLen, rcvLen));
+  rfalRunBlocking(ret, rfalT2TPollerGetReadStatus());
+
+  return ret;
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT2TPollerStartRead(uint8_t blockNum, uint8_t *rxBuf, uint16_t rxBufLen, uint16_t *rcvLen)
+{
   rfalT2TReadReq  req;
 
   if ((rxBuf == NULL) || (rcvLen == NULL)) {
@@ -133,11 +144,26 @@ ReturnCode RfalNfcClass::rfalT2TPollerRead(uint8_t blockNum, uint8_t *rxBuf, uin
   req.code = (uint8_t)RFAL_T2T_CMD_READ;
   req.blNo = blockNum;
 
-  /* Transceive Command */
-  ret = rfalRfDev->rfalTransceiveBlockingTxRx((uint8_t *)&req, sizeof(rfalT2TReadReq), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_READ_MAX);
+  gRfalT2T.rxBuf  = rxBuf;
+  gRfalT2T.rcvLen = rcvLen;
+
+  /* Send Command, the answer is retrieved by rfalT2TPollerGetReadStatus() */
+  return rfalRfDev->rfalTransceiveBlockingTx((uint8_t *)&req, sizeof(rfalT2TReadReq), rxBuf, rxBufLen, rcvLen, RFAL_TXRX_FLAGS_DEFAULT, RFAL_FDT_POLL_READ_MAX);
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT2TPollerGetReadStatus(void)
+{
+  ReturnCode ret;
+
+  EXIT_ON_BUSY(ret, rfalRfDev->rfalGetTransceiveStatus());
+
+  /* Convert bits to bytes */
+  *gRfalT2T.rcvLen = rfalConvBitsToBytes(*gRfalT2T.rcvLen);
 
   /* T2T 1.0 5.2.1.7 The Reader/Writer SHALL treat a NACK in response to a READ Command as a Protocol Error */
-  if ((ret == ERR_INCOMPLETE_BYTE) && (*rcvLen == RFAL_T2T_ACK_NACK_LEN) && ((*rxBuf & RFAL_T2T_ACK_MASK) != RFAL_T2T_ACK)) {
+  if ((ret == ERR_INCOMPLETE_BYTE) && (*gRfalT2T.rcvLen == RFAL_T2T_ACK_NACK_LEN) && ((*gRfalT2T.rxBuf & RFAL_T2T_ACK_MASK) != RFAL_T2T_ACK)) {
     return ERR_PROTO;
   }
   return ret;
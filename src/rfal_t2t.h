@@ -80,6 +80,12 @@
 ******************************************************************************
 */
 
+/*! RFAL T2T instance */
+typedef struct {
+  uint8_t  *rxBuf;                                        /*!< Location of the READ data in progress */
+  uint16_t *rcvLen;                                       /*!< Received length                       */
+} rfalT2T;
+
 
 /*
 ******************************************************************************
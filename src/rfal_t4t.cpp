@@ -398,4 +398,185 @@ ReturnCode RfalNfcClass::rfalT4TPollerComposeWriteDataODO(rfalIsoDepApduBufForma
   return rfalT4TPollerComposeCAPDU(&cAPDU);
 }
 
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT4TListenerInitialize(const rfalT4tListenerParam *param)
+{
+  const uint8_t *cc;
+
+  if ((param == NULL) || (param->ccFile == NULL) || ((param->ndefFile == NULL) && (param->ndefFileWr == NULL))) {
+    return ERR_PARAM;
+  }
+
+  /* Writable view, when provided, must be the very same NDEF file */
+  if ((param->ndefFile != NULL) && (param->ndefFileWr != NULL) && (param->ndefFile != param->ndefFileWr)) {
+    return ERR_PARAM;
+  }
+
+  /* CC shall contain at least the header and the NDEF File Control TLV  T4T 1.0 5.1 */
+  cc = param->ccFile;
+  if ((param->ccFileLen < RFAL_T4T_CC_MIN_LEN) || (cc[7] != RFAL_T4T_CC_NDEF_FILE_CTRL_TLV_T) || (param->ndefFileLen < RFAL_T4T_NLEN_LEN)) {
+    return ERR_PARAM;
+  }
+
+  ST_MEMSET(&gT4tListener, 0x00, sizeof(rfalT4tListener));
+
+  gT4tListener.param = *param;
+  if (gT4tListener.param.ndefFile == NULL) {
+    gT4tListener.param.ndefFile = gT4tListener.param.ndefFileWr;
+  }
+
+  gT4tListener.ndefFileId     = GETU16(&cc[9]);
+  gT4tListener.isApplSelected = false;
+  gT4tListener.curFile        = RFAL_T4T_LISTENER_FILE_NONE;
+  gT4tListener.enabled        = true;
+
+  return ERR_NONE;
+}
+
+
+/*******************************************************************************/
+void RfalNfcClass::rfalT4TListenerDeinitialize(void)
+{
+  ST_MEMSET(&gT4tListener, 0x00, sizeof(rfalT4tListener));
+}
+
+
+/*******************************************************************************/
+ReturnCode RfalNfcClass::rfalT4TListenerProcessCApdu(const uint8_t *cApdu, uint16_t cApduLen, uint8_t *rApdu, uint16_t rApduBufLen, uint16_t *rApduLen)
+{
+  static const uint8_t RFAL_T4T_AID_NDEF[] = {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01};  /*!< AID_NDEF v2.0 or higher   T4T 1.0  4.3.3 */
+
+  const uint8_t *file;
+  uint16_t       fileLen;
+  uint16_t       offset;
+  uint16_t       fid;
+  uint16_t       len;
+  uint16_t       sw;
+
+  if ((cApdu == NULL) || (rApdu == NULL) || (rApduLen == NULL) || (rApduBufLen < RFAL_T4T_MAX_RAPDU_SW1SW2_LEN)) {
+    return ERR_PARAM;
+  }
+
+  if (!gT4tListener.enabled) {
+    return ERR_WRONG_STATE;
+  }
+
+  *rApduLen = 0U;
+  sw        = RFAL_T4T_ISO7816_STATUS_COMPLETE;
+
+  /* CLA INS P1 P2 [Lc Data] [Le] */
+  if (cApduLen < RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN) {
+    sw = RFAL_T4T_ISO7816_STATUS_WRONG_LENGTH;
+  } else if (cApdu[0] != RFAL_T4T_CLA) {
+    sw = RFAL_T4T_ISO7816_STATUS_CLA_NOT_SUPPORTED;
+  } else {
+    offset = GETU16(&cApdu[2]);
+
+    switch (cApdu[1]) {
+      /*******************************************************************************/
+      case (uint8_t)RFAL_T4T_INS_SELECT:
+
+        if ((cApduLen < (RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN + RFAL_T4T_LC_LEN)) || (cApduLen < (RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN + RFAL_T4T_LC_LEN + (uint16_t)cApdu[4]))) {
+          sw = RFAL_T4T_ISO7816_STATUS_WRONG_LENGTH;
+          break;
+        }
+
+        if (cApdu[2] == RFAL_T4T_ISO7816_P1_SELECT_BY_DF_NAME) {
+          /* NDEF Tag Application Select  T4T 1.0 5.4.2 */
+          gT4tListener.curFile        = RFAL_T4T_LISTENER_FILE_NONE;
+          gT4tListener.isApplSelected = ((cApdu[4] == RFAL_T4T_NDEF_APP_AID_LEN) && (ST_BYTECMP(&cApdu[5], RFAL_T4T_AID_NDEF, RFAL_T4T_NDEF_APP_AID_LEN) == 0));
+          if (!gT4tListener.isApplSelected) {
+            sw = RFAL_T4T_ISO7816_STATUS_FILE_NOT_FOUND;
+          }
+        } else if (cApdu[2] == RFAL_T4T_ISO7816_P1_SELECT_BY_FILEID) {
+          /* Capability Container / NDEF Select  T4T 1.0 5.4.3 & 5.4.5 */
+          if ((cApdu[4] != RFAL_T4T_FID_LEN) || (!gT4tListener.isApplSelected)) {
+            sw = RFAL_T4T_ISO7816_STATUS_FILE_NOT_FOUND;
+            break;
+          }
+
+          fid = GETU16(&cApdu[5]);
+          if (fid == RFAL_T4T_CC_FILE_ID) {
+            gT4tListener.curFile = RFAL_T4T_LISTENER_FILE_CC;
+          } else if (fid == gT4tListener.ndefFileId) {
+            gT4tListener.curFile = RFAL_T4T_LISTENER_FILE_NDEF;
+          } else {
+            sw = RFAL_T4T_ISO7816_STATUS_FILE_NOT_FOUND;
+          }
+        } else {
+          sw = RFAL_T4T_ISO7816_STATUS_INCORRECT_P1P2;
+        }
+        break;
+
+      /*******************************************************************************/
+      case (uint8_t)RFAL_T4T_INS_READBINARY:
+
+        if (gT4tListener.curFile == RFAL_T4T_LISTENER_FILE_NONE) {
+          sw = RFAL_T4T_ISO7816_STATUS_CMD_NOT_ALLOWED;
+          break;
+        }
+
+        if (cApduLen != (RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN + RFAL_T4T_LE_LEN)) {
+          sw = RFAL_T4T_ISO7816_STATUS_WRONG_LENGTH;
+          break;
+        }
+
+        file    = ((gT4tListener.curFile == RFAL_T4T_LISTENER_FILE_CC) ? gT4tListener.param.ccFile    : gT4tListener.param.ndefFile);
+        fileLen = ((gT4tListener.curFile == RFAL_T4T_LISTENER_FILE_CC) ? gT4tListener.param.ccFileLen : gT4tListener.param.ndefFileLen);
+
+        if (offset > fileLen) {
+          sw = RFAL_T4T_ISO7816_STATUS_WRONG_OFFSET;
+          break;
+        }
+
+        /* Le of 00h means 256 bytes, answer with what is available up to the end of the file */
+        len = ((cApdu[4] == 0U) ? 256U : (uint16_t)cApdu[4]);
+        len = MIN(len, (fileLen - offset));
+        len = MIN(len, (rApduBufLen - RFAL_T4T_MAX_RAPDU_SW1SW2_LEN));
+
+        ST_MEMCPY(rApdu, &file[offset], len);
+        *rApduLen = len;
+        break;
+
+      /*******************************************************************************/
+      case (uint8_t)RFAL_T4T_INS_UPDATEBINARY:
+
+        if (gT4tListener.curFile == RFAL_T4T_LISTENER_FILE_NONE) {
+          sw = RFAL_T4T_ISO7816_STATUS_CMD_NOT_ALLOWED;
+          break;
+        }
+
+        /* CC is read-only, NDEF file writable only if a RAM view is given and the CC grants write access */
+        if ((gT4tListener.curFile != RFAL_T4T_LISTENER_FILE_NDEF) || (gT4tListener.param.ndefFileWr == NULL) || (gT4tListener.param.ccFile[14] != RFAL_T4T_CC_ACCESS_GRANTED)) {
+          sw = RFAL_T4T_ISO7816_STATUS_SECURITY_NOT_SATISFIED;
+          break;
+        }
+
+        if ((cApduLen < (RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN + RFAL_T4T_LC_LEN)) || (cApduLen != (RFAL_T4T_MAX_CAPDU_PROLOGUE_LEN + RFAL_T4T_LC_LEN + (uint16_t)cApdu[4]))) {
+          sw = RFAL_T4T_ISO7816_STATUS_WRONG_LENGTH;
+          break;
+        }
+
+        if (((uint32_t)offset + (uint32_t)cApdu[4]) > (uint32_t)gT4tListener.param.ndefFileLen) {
+          sw = RFAL_T4T_ISO7816_STATUS_WRONG_OFFSET;
+          break;
+        }
+
+        ST_MEMCPY(&gT4tListener.param.ndefFileWr[offset], &cApdu[5], cApdu[4]);
+        break;
+
+      /*******************************************************************************/
+      default:
+        sw = RFAL_T4T_ISO7816_STATUS_INS_NOT_SUPPORTED;
+        break;
+    }
+  }
+
+  /* Append SW1 SW2 */
+  rApdu[(*rApduLen)++] = (uint8_t)(sw >> 8U);
+  rApdu[(*rApduLen)++] = (uint8_t)(sw);
+
+  return ERR_NONE;
+}
+
 #endif /* RFAL_FEATURE_T4T */
\ No newline at end of file
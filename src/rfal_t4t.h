@@ -88,6 +88,22 @@
 #define RFAL_T4T_ISO7816_P2_SELECT_NO_RESPONSE_DATA           0x0CU                          /*!< b4b3      P2 value for No response data                         */
 
 #define RFAL_T4T_ISO7816_STATUS_COMPLETE                      0x9000U                        /*!< Command completed \ Normal processing - No further qualification*/
+#define RFAL_T4T_ISO7816_STATUS_WRONG_LENGTH                  0x6700U                        /*!< Wrong length                                                    */
+#define RFAL_T4T_ISO7816_STATUS_SECURITY_NOT_SATISFIED        0x6982U                        /*!< Security status not satisfied                                   */
+#define RFAL_T4T_ISO7816_STATUS_CMD_NOT_ALLOWED               0x6986U                        /*!< Command not allowed (no current EF)                             */
+#define RFAL_T4T_ISO7816_STATUS_FILE_NOT_FOUND                0x6A82U                        /*!< File or application not found                                   */
+#define RFAL_T4T_ISO7816_STATUS_INCORRECT_P1P2                0x6A86U                        /*!< Incorrect parameters P1-P2                                      */
+#define RFAL_T4T_ISO7816_STATUS_WRONG_OFFSET                  0x6B00U                        /*!< Wrong parameters P1-P2 (offset outside the EF)                  */
+#define RFAL_T4T_ISO7816_STATUS_INS_NOT_SUPPORTED             0x6D00U                        /*!< Instruction code not supported or invalid                       */
+#define RFAL_T4T_ISO7816_STATUS_CLA_NOT_SUPPORTED             0x6E00U                        /*!< Class not supported                                             */
+
+#define RFAL_T4T_CC_FILE_ID                                   0xE103U                        /*!< Capability Container file identifier  T4T 1.0  5.1.1            */
+#define RFAL_T4T_CC_MIN_LEN                                     15U                          /*!< Minimum CC file length (header + NDEF File Control TLV)         */
+#define RFAL_T4T_CC_NDEF_FILE_CTRL_TLV_T                      0x04U                          /*!< NDEF File Control TLV Tag                                       */
+#define RFAL_T4T_CC_ACCESS_GRANTED                            0x00U                          /*!< Read/Write access condition: access granted without security    */
+#define RFAL_T4T_NDEF_APP_AID_LEN                                7U                          /*!< NDEF Tag Application AID length                                 */
+#define RFAL_T4T_FID_LEN                                         2U                          /*!< File identifier length                                          */
+#define RFAL_T4T_NLEN_LEN                                        2U                          /*!< NDEF file NLEN field length                                     */
 
 
 /*
@@ -136,6 +152,31 @@ typedef enum {
   RFAL_T4T_INS_UPDATEBINARY_ODO = 0xD7U                      /*!< T4T UpdateBinay using ODO                          */
 } rfalT4tCmds;
 
+/*! T4T Listener (card emulation) parameters */
+typedef struct {
+  const uint8_t            *ccFile;                          /*!< Capability Container file content (may reside in flash)      */
+  uint16_t                 ccFileLen;                        /*!< Capability Container file length                              */
+  const uint8_t            *ndefFile;                        /*!< NDEF file content, NLEN + NDEF message (may reside in flash)  */
+  uint8_t                  *ndefFileWr;                      /*!< Writable view of the NDEF file, NULL if read-only             */
+  uint16_t                 ndefFileLen;                      /*!< NDEF file size                                                */
+} rfalT4tListenerParam;
+
+/*! T4T Listener currently selected file */
+typedef enum {
+  RFAL_T4T_LISTENER_FILE_NONE = 0,                           /*!< No EF selected                                     */
+  RFAL_T4T_LISTENER_FILE_CC   = 1,                           /*!< Capability Container EF selected                   */
+  RFAL_T4T_LISTENER_FILE_NDEF = 2                            /*!< NDEF EF selected                                   */
+} rfalT4tListenerFile;
+
+/*! T4T Listener (card emulation) context */
+typedef struct {
+  bool                     enabled;                          /*!< Card emulation engine enabled                      */
+  rfalT4tListenerParam     param;                            /*!< Files served by the engine                         */
+  uint16_t                 ndefFileId;                       /*!< NDEF file identifier as announced in the CC        */
+  bool                     isApplSelected;                   /*!< NDEF Tag Application selected                      */
+  rfalT4tListenerFile      curFile;                          /*!< Currently selected EF                              */
+} rfalT4tListener;
+
 /*
 ******************************************************************************
 * GLOBAL FUNCTION PROTOTYPES